@@ -0,0 +1,34 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_BENCH_H
+#define FOSSIL_TYPE_BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/* Monotonic enough for benchmarks and available wherever C11 is. */
+static inline uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Prints one result row: name, nanoseconds per element, and a checksum. */
+static inline void bench_report(const char *name, uint64_t ns, uint64_t elements, uint64_t checksum) {
+    printf("%-28s %8.3f ns/op  (checksum %llu)\n", name,
+           elements ? (double)ns / (double)elements : 0.0, (unsigned long long)checksum);
+}
+
+#endif /* FOSSIL_TYPE_BENCH_H */
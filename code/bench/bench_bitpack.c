@@ -0,0 +1,74 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <math.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Packs an 8M-value i64 column of timestamp-like values (a slowly
+ * rising base plus 12 bits of jitter) and decodes it back. The
+ * baseline is a plain copy of the raw column, which is what reading
+ * it costs today; the packed column is about a fifth of the bytes, and
+ * the encode checksum is its size.
+ * Random block access decodes one block in every 64.
+ */
+
+#define BENCH_VALUES (1u << 23)
+
+int main(void) {
+    int64_t *src = (int64_t *)malloc(BENCH_VALUES * sizeof(int64_t));
+    int64_t *out = (int64_t *)malloc(BENCH_VALUES * sizeof(int64_t));
+    if (!src || !out) return 1;
+
+    srand(42);
+    for (size_t i = 0; i < BENCH_VALUES; i++) src[i] = 1700000000000LL + (int64_t)(i / 8) + (rand() & 0xFFF);
+    memset(out, 0, BENCH_VALUES * sizeof(int64_t));
+
+    uint64_t start = bench_now_ns();
+    memcpy(out, src, BENCH_VALUES * sizeof(int64_t));
+    bench_report("raw i64 copy", bench_now_ns() - start, BENCH_VALUES, (uint64_t)out[BENCH_VALUES - 1]);
+
+    fossil_type_bitpack p;
+    fossil_type_bitpack_init(&p);
+    start = bench_now_ns();
+    if (fossil_type_bitpack_encode(&p, src, FOSSIL_TYPE_KIND_I64, BENCH_VALUES, FOSSIL_TYPE_BITPACK_BLOCK) != 0) return 1;
+    bench_report("bitpack encode", bench_now_ns() - start, BENCH_VALUES, fossil_type_bitpack_bytes(&p));
+
+    memset(out, 0, BENCH_VALUES * sizeof(int64_t));
+    start = bench_now_ns();
+    fossil_type_bitpack_decode(&p, out);
+    bench_report("bitpack decode", bench_now_ns() - start, BENCH_VALUES, (uint64_t)out[BENCH_VALUES - 1]);
+    if (memcmp(src, out, BENCH_VALUES * sizeof(int64_t)) != 0) {
+        fprintf(stderr, "decoded column differs from the input\n");
+        return 1;
+    }
+
+    uint64_t sum = 0;
+    start = bench_now_ns();
+    for (size_t b = 0; b < p.block_count; b += 64) {
+        fossil_type_bitpack_decode_block(&p, b, out);
+        sum += (uint64_t)out[0];
+    }
+    bench_report("bitpack block access", bench_now_ns() - start, (p.block_count + 63) / 64 * p.block_size, sum);
+
+
+    fossil_type_bitpack_free(&p);
+    free(src);
+    free(out);
+    return 0;
+}
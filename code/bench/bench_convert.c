@@ -0,0 +1,117 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Narrows 4M values with each policy and compares against the
+ * per-element loops storage code writes by hand: i64 -> i16 with a
+ * branchy clamp, and f64 -> i32 with explicit NaN and range tests.
+ * Values are mostly in range, with one in 64 outside it.
+ */
+
+#define BENCH_VALUES (1u << 22)
+
+static uint64_t bench_sum16(const int16_t *v, size_t n) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < n; i++) sum = sum * 31u + (uint16_t)v[i];
+    return sum;
+}
+
+static uint64_t bench_sum32(const int32_t *v, size_t n) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < n; i++) sum = sum * 31u + (uint32_t)v[i];
+    return sum;
+}
+
+int main(void) {
+    int64_t *wide = (int64_t *)malloc(BENCH_VALUES * sizeof(int64_t));
+    double *reals = (double *)malloc(BENCH_VALUES * sizeof(double));
+    int16_t *narrow = (int16_t *)malloc(BENCH_VALUES * sizeof(int16_t));
+    int32_t *ints = (int32_t *)malloc(BENCH_VALUES * sizeof(int32_t));
+    if (!wide || !reals || !narrow || !ints) return 1;
+
+    memset(narrow, 0, BENCH_VALUES * sizeof(int16_t));
+    memset(ints, 0, BENCH_VALUES * sizeof(int32_t));
+    srand(42);
+    for (size_t i = 0; i < BENCH_VALUES; i++) {
+        wide[i] = (int64_t)(rand() % 65536) - 32768;
+        reals[i] = ((double)rand() / RAND_MAX - 0.5) * 4e9;
+        if (rand() % 64 == 0) wide[i] *= 3;
+        else reals[i] /= 4.0;
+    }
+
+    uint64_t start = bench_now_ns();
+    for (size_t i = 0; i < BENCH_VALUES; i++) {
+        int64_t v = wide[i];
+        if (v < INT16_MIN) narrow[i] = INT16_MIN;
+        else if (v > INT16_MAX) narrow[i] = INT16_MAX;
+        else narrow[i] = (int16_t)v;
+    }
+    uint64_t ns = bench_now_ns() - start;
+    uint64_t loop16 = bench_sum16(narrow, BENCH_VALUES);
+    bench_report("i64->i16 clamp loop", ns, BENCH_VALUES, loop16);
+
+    start = bench_now_ns();
+    fossil_type_convert(narrow, FOSSIL_TYPE_KIND_I16, wide, FOSSIL_TYPE_KIND_I64, BENCH_VALUES,
+                        FOSSIL_TYPE_CONVERT_SATURATE, NULL);
+    ns = bench_now_ns() - start;
+    uint64_t sat16 = bench_sum16(narrow, BENCH_VALUES);
+    bench_report("i64->i16 saturate kernel", ns, BENCH_VALUES, sat16);
+
+    start = bench_now_ns();
+    fossil_type_convert(narrow, FOSSIL_TYPE_KIND_I16, wide, FOSSIL_TYPE_KIND_I64, BENCH_VALUES,
+                        FOSSIL_TYPE_CONVERT_WRAP, NULL);
+    bench_report("i64->i16 wrap kernel", bench_now_ns() - start, BENCH_VALUES, bench_sum16(narrow, BENCH_VALUES));
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < BENCH_VALUES; i++) {
+        double x = reals[i];
+        if (x != x) ints[i] = 0;
+        else if (x <= (double)INT32_MIN) ints[i] = INT32_MIN;
+        else if (x >= (double)INT32_MAX) ints[i] = INT32_MAX;
+        else ints[i] = (int32_t)x;
+    }
+    ns = bench_now_ns() - start;
+    uint64_t loop32 = bench_sum32(ints, BENCH_VALUES);
+    bench_report("f64->i32 clamp loop", ns, BENCH_VALUES, loop32);
+
+    start = bench_now_ns();
+    fossil_type_convert(ints, FOSSIL_TYPE_KIND_I32, reals, FOSSIL_TYPE_KIND_F64, BENCH_VALUES,
+                        FOSSIL_TYPE_CONVERT_SATURATE, NULL);
+    ns = bench_now_ns() - start;
+    uint64_t sat32 = bench_sum32(ints, BENCH_VALUES);
+    bench_report("f64->i32 saturate kernel", ns, BENCH_VALUES, sat32);
+
+    /* Every value fits i32, so the checked run validates and converts the whole array. */
+    size_t fail = 0;
+    start = bench_now_ns();
+    fossil_type_convert(ints, FOSSIL_TYPE_KIND_I32, wide, FOSSIL_TYPE_KIND_I64, BENCH_VALUES,
+                        FOSSIL_TYPE_CONVERT_CHECKED, &fail);
+    bench_report("i64->i32 checked kernel", bench_now_ns() - start, BENCH_VALUES, fail);
+
+    free(wide);
+    free(reals);
+    free(narrow);
+    free(ints);
+
+    if (loop16 != sat16 || loop32 != sat32 || fail != FOSSIL_TYPE_RANGE_NPOS) {
+        fprintf(stderr, "result mismatch between variants\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * Sizes an 8M-value i64 column and an 8M-value f64 column. The
+ * baseline is the loop the storage layer ran before: track min and max
+ * per value, then walk the candidate types comparing against their
+ * long double limits. The scans fold the same information in one
+ * vectorized pass, and the pool variant splits it across threads.
+ */
+
+#define BENCH_VALUES (1u << 23)
+
+int main(void) {
+    int64_t *ints = (int64_t *)malloc(BENCH_VALUES * sizeof(int64_t));
+    double *reals = (double *)malloc(BENCH_VALUES * sizeof(double));
+    if (!ints || !reals) return 1;
+
+    srand(42);
+    for (size_t i = 0; i < BENCH_VALUES; i++) {
+        ints[i] = (int64_t)(rand() % 60000) - 1000;
+        reals[i] = (double)(rand() % 1000) * 0.25;
+    }
+
+    static const char *ladder[] = {"u8", "i8", "u16", "i16", "u32", "i32", "u64", "i64"};
+    uint64_t start = bench_now_ns();
+    int64_t lo = INT64_MAX, hi = INT64_MIN;
+    for (size_t i = 0; i < BENCH_VALUES; i++) {
+        if (ints[i] < lo) lo = ints[i];
+        if (ints[i] > hi) hi = ints[i];
+    }
+    size_t pick = 0;
+    while (pick < 7) {
+        const fossil_type_limits *l = fossil_type_limits_get(ladder[pick]);
+        if ((long double)lo >= l->min_value && (long double)hi <= l->max_value) break;
+        pick++;
+    }
+    uint64_t naive = fossil_type_limits_kind_of(ladder[pick]);
+    bench_report("i64 min/max loop", bench_now_ns() - start, BENCH_VALUES, naive);
+
+    fossil_type_infer_result r;
+    start = bench_now_ns();
+    fossil_type_infer_i64(ints, BENCH_VALUES, &r);
+    uint64_t serial = r.kind;
+    bench_report("i64 infer scan", bench_now_ns() - start, BENCH_VALUES, serial);
+
+    tribool_pool pool;
+    if (fossil_type_tribool_pool_init(&pool, 0) != 0) return 1;
+    start = bench_now_ns();
+    fossil_type_infer_i64_par(&pool, ints, BENCH_VALUES, &r);
+    uint64_t par = r.kind;
+    bench_report("i64 infer scan, pool", bench_now_ns() - start, BENCH_VALUES, par);
+
+    start = bench_now_ns();
+    double flo = HUGE_VAL, fhi = -HUGE_VAL;
+    int integral = 1, exact = 1;
+    for (size_t i = 0; i < BENCH_VALUES; i++) {
+        double x = reals[i];
+        if (x < flo) flo = x;
+        if (x > fhi) fhi = x;
+        if (x != (double)(int64_t)x) integral = 0;
+        if (x != (double)(float)x) exact = 0;
+    }
+    uint64_t naive_f = (uint64_t)(integral * 2 + exact) + (flo < fhi);
+    bench_report("f64 per-value loop", bench_now_ns() - start, BENCH_VALUES, naive_f);
+
+    start = bench_now_ns();
+    fossil_type_infer_f64(reals, BENCH_VALUES, &r);
+    uint64_t scan_f = (uint64_t)(r.integral * 2 + (r.kind == FOSSIL_TYPE_KIND_F32)) + (r.min.f64 < r.max.f64);
+    bench_report("f64 infer scan", bench_now_ns() - start, BENCH_VALUES, scan_f);
+
+    fossil_type_tribool_pool_free(&pool);
+    free(ints);
+    free(reals);
+
+    if (naive != serial || serial != par || naive_f != scan_f) {
+        fprintf(stderr, "result mismatch between variants\n");
+        return 1;
+    }
+    return 0;
+}
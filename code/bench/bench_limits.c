@@ -0,0 +1,78 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Resolves 1M type lookups drawn uniformly from every known type ID three
+ * ways: the linear strcmp scan fossil_type_limits_get used to do, the
+ * current switch-based fossil_type_limits_get, and the direct index behind
+ * fossil_type_limits_get_by_kind. The scan cost grows with the position of
+ * the ID in the table, so the uniform mix reports its average case.
+ */
+
+#define BENCH_LOOKUPS (1u << 20)
+
+/* The previous implementation, kept here as the baseline. */
+static const fossil_type_limits *bench_scan(const char *type_id) {
+    if (!type_id) return NULL;
+    for (int k = 0; k < FOSSIL_TYPE_KIND_COUNT; k++) {
+        const fossil_type_limits *l = fossil_type_limits_get_by_kind((fossil_type_limits_kind)k);
+        if (strcmp(l->type_id, type_id) == 0) return l;
+    }
+    return NULL;
+}
+
+int main(void) {
+    const char *ids[FOSSIL_TYPE_KIND_COUNT];
+    const char **queries = (const char **)malloc(BENCH_LOOKUPS * sizeof(*queries));
+    fossil_type_limits_kind *kinds = (fossil_type_limits_kind *)malloc(BENCH_LOOKUPS * sizeof(*kinds));
+    if (!queries || !kinds) return 1;
+
+    for (int k = 0; k < FOSSIL_TYPE_KIND_COUNT; k++)
+        ids[k] = fossil_type_limits_get_by_kind((fossil_type_limits_kind)k)->type_id;
+
+    srand(42);
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++) {
+        kinds[i] = (fossil_type_limits_kind)(rand() % FOSSIL_TYPE_KIND_COUNT);
+        queries[i] = ids[kinds[i]];
+    }
+
+    uint64_t start = bench_now_ns();
+    uint64_t scan = 0;
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++) scan += bench_scan(queries[i])->size;
+    bench_report("linear strcmp scan", bench_now_ns() - start, BENCH_LOOKUPS, scan);
+
+    start = bench_now_ns();
+    uint64_t lookup = 0;
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++) lookup += fossil_type_limits_get(queries[i])->size;
+    bench_report("limits_get (switch)", bench_now_ns() - start, BENCH_LOOKUPS, lookup);
+
+    start = bench_now_ns();
+    uint64_t by_kind = 0;
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++) by_kind += fossil_type_limits_get_by_kind(kinds[i])->size;
+    bench_report("limits_get_by_kind", bench_now_ns() - start, BENCH_LOOKUPS, by_kind);
+
+    free(queries);
+    free(kinds);
+
+    if (scan != lookup || lookup != by_kind) {
+        fprintf(stderr, "result mismatch between variants\n");
+        return 1;
+    }
+    return 0;
+}
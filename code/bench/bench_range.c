@@ -0,0 +1,71 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <stdlib.h>
+
+/*
+ * Validates 16M i64 values against i16 three ways: the per-value loop
+ * ingest used to run with Limits::min()/max() as long double, the exact
+ * integer fits check per value, and the batch kernel. One value in 1024
+ * is out of range so the result is non-trivial.
+ */
+
+#define BENCH_VALUES (1u << 24)
+
+int main(void) {
+    int64_t *src = (int64_t *)malloc(BENCH_VALUES * sizeof(int64_t));
+    uint64_t *bitmap = (uint64_t *)malloc(FOSSIL_TYPE_RANGE_BITMAP_WORDS(BENCH_VALUES) * sizeof(uint64_t));
+    if (!src || !bitmap) return 1;
+
+    srand(42);
+    for (size_t i = 0; i < BENCH_VALUES; i++) {
+        src[i] = (int64_t)(rand() % 65536) - 32768;
+        if (rand() % 1024 == 0) src[i] += (rand() & 1) ? 65536 : -65536;
+    }
+
+    const fossil_type_limits *lim = fossil_type_limits_get("i16");
+    uint64_t start = bench_now_ns();
+    uint64_t per_value = 0;
+    for (size_t i = 0; i < BENCH_VALUES; i++) {
+        long double v = (long double)src[i];
+        per_value += (uint64_t)(v < lim->min_value || v > lim->max_value);
+    }
+    bench_report("per value, long double", bench_now_ns() - start, BENCH_VALUES, per_value);
+
+    start = bench_now_ns();
+    uint64_t fits = 0;
+    for (size_t i = 0; i < BENCH_VALUES; i++) fits += (uint64_t)!fossil_type_limits_fits_i64(lim, src[i]);
+    bench_report("per value, exact fits", bench_now_ns() - start, BENCH_VALUES, fits);
+
+    fossil_type_range_result r;
+    start = bench_now_ns();
+    fossil_type_range_check_i64(src, BENCH_VALUES, FOSSIL_TYPE_KIND_I16, &r, NULL);
+    uint64_t batch = r.violations;
+    bench_report("batch kernel, count", bench_now_ns() - start, BENCH_VALUES, batch);
+
+    start = bench_now_ns();
+    fossil_type_range_check_i64(src, BENCH_VALUES, FOSSIL_TYPE_KIND_I16, &r, bitmap);
+    bench_report("batch kernel, bitmap", bench_now_ns() - start, BENCH_VALUES, r.violations);
+
+    free(src);
+    free(bitmap);
+
+    if (per_value != fits || fits != batch || batch != r.violations) {
+        fprintf(stderr, "result mismatch between variants\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Registers 256 application types, then resolves 1M lookups drawn
+ * uniformly from them. The baseline is the mutex-guarded array an
+ * application keeps beside the built-in table today, searched with
+ * strcmp under the lock. fossil_type_limits_get probes the published
+ * hash table without locking; built-in IDs are timed too, to show they
+ * still take the switch and never reach the registry.
+ */
+
+#define BENCH_TYPES 256
+#define BENCH_LOOKUPS (1u << 20)
+
+typedef struct bench_entry {
+    char id[16];
+    fossil_type_limits limits;
+} bench_entry;
+
+static bench_entry bench_app[BENCH_TYPES];
+static pthread_mutex_t bench_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* The locked list, kept here as the baseline. */
+static const fossil_type_limits *bench_locked(const char *type_id) {
+    const fossil_type_limits *l = NULL;
+    pthread_mutex_lock(&bench_lock);
+    for (size_t i = 0; i < BENCH_TYPES; i++) {
+        if (strcmp(bench_app[i].id, type_id) == 0) {
+            l = &bench_app[i].limits;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&bench_lock);
+    return l;
+}
+
+int main(void) {
+    const char **queries = (const char **)malloc(BENCH_LOOKUPS * sizeof(*queries));
+    const char **builtin = (const char **)malloc(BENCH_LOOKUPS * sizeof(*builtin));
+    if (!queries || !builtin) return 1;
+
+    for (size_t i = 0; i < BENCH_TYPES; i++) {
+        fossil_type_registration reg = {NULL, FOSSIL_TYPE_KIND_U32, 0, i, 0, 0};
+        snprintf(bench_app[i].id, sizeof(bench_app[i].id), "app_type_%zu", i);
+        reg.type_id = bench_app[i].id;
+        if (fossil_type_registry_add(&reg) != 0) return 1;
+        bench_app[i].limits = *fossil_type_limits_get(bench_app[i].id);
+    }
+
+    srand(42);
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++) {
+        queries[i] = bench_app[rand() % BENCH_TYPES].id;
+        builtin[i] = fossil_type_limits_get_by_kind((fossil_type_limits_kind)(rand() % FOSSIL_TYPE_KIND_COUNT))->type_id;
+    }
+
+    uint64_t start = bench_now_ns();
+    uint64_t locked = 0;
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++) locked += bench_locked(queries[i])->max_uint;
+    bench_report("mutex + strcmp list", bench_now_ns() - start, BENCH_LOOKUPS, locked);
+
+    start = bench_now_ns();
+    uint64_t registry = 0;
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++) registry += fossil_type_limits_get(queries[i])->max_uint;
+    bench_report("limits_get (registry)", bench_now_ns() - start, BENCH_LOOKUPS, registry);
+
+    start = bench_now_ns();
+    uint64_t sizes = 0;
+    for (size_t i = 0; i < BENCH_LOOKUPS; i++) sizes += fossil_type_limits_get(builtin[i])->size;
+    bench_report("limits_get (built in)", bench_now_ns() - start, BENCH_LOOKUPS, sizes);
+
+    free(queries);
+    free(builtin);
+    fossil_type_registry_reset();
+
+    if (locked != registry) {
+        fprintf(stderr, "result mismatch between variants\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <stdlib.h>
+
+/*
+ * Evaluates one 200-node rule over 64 input columns of 1M rows, first the
+ * way rule engines usually do it (a recursive walk of the tree per row,
+ * calling the scalar ops) and then compiled to bytecode and run by the
+ * block VM over packed vectors. The walk revisits shared subtrees on every
+ * path that reaches them; the compiled form evaluates each node once, and
+ * only the nodes reachable from the root.
+ */
+
+#define BENCH_ROWS  (1u << 20)
+#define BENCH_COLS  64u
+#define BENCH_NODES 200u
+
+typedef struct bench_node {
+    int op; /* 0 input, 1 not, 2 and, 3 or */
+    unsigned a, b;
+} bench_node;
+
+static bench_node bench_tree[BENCH_NODES];
+static tribool *bench_cols[BENCH_COLS];
+
+static tribool bench_eval(unsigned id, size_t row) {
+    const bench_node *n = &bench_tree[id];
+    switch (n->op) {
+    case 0: return bench_cols[n->a][row];
+    case 1: return fossil_type_tribool_not(bench_eval(n->a, row));
+    case 2: return fossil_type_tribool_and(bench_eval(n->a, row), bench_eval(n->b, row));
+    default: return fossil_type_tribool_or(bench_eval(n->a, row), bench_eval(n->b, row));
+    }
+}
+
+int main(void) {
+    tribool_vec packed[BENCH_COLS], out;
+    const tribool_vec *inputs[BENCH_COLS];
+    tribool_expr e;
+    tribool_program p;
+    tribool_expr_id ids[BENCH_NODES];
+
+    srand(42);
+    for (unsigned c = 0; c < BENCH_COLS; c++) {
+        bench_cols[c] = (tribool *)malloc(BENCH_ROWS * sizeof(tribool));
+        if (!bench_cols[c]) return 1;
+        for (size_t r = 0; r < BENCH_ROWS; r++) bench_cols[c][r] = (tribool)(rand() % 3);
+        fossil_type_tribool_vec_init(&packed[c], 0);
+        fossil_type_tribool_vec_pack(&packed[c], bench_cols[c], BENCH_ROWS);
+        inputs[c] = &packed[c];
+    }
+
+    /* A random tree: the first 64 nodes read the columns, the rest combine earlier nodes. */
+    fossil_type_tribool_expr_init(&e);
+    for (unsigned i = 0; i < BENCH_NODES; i++) {
+        bench_node *n = &bench_tree[i];
+        if (i < BENCH_COLS) {
+            n->op = 0;
+            n->a = i;
+            ids[i] = fossil_type_tribool_expr_input(&e, i);
+            continue;
+        }
+        n->op = 1 + rand() % 3;
+        n->a = i - 1 - (unsigned)rand() % (i < 8 ? i : 8);
+        n->b = (unsigned)rand() % i;
+        ids[i] = n->op == 1 ? fossil_type_tribool_expr_not(&e, ids[n->a])
+               : n->op == 2 ? fossil_type_tribool_expr_and(&e, ids[n->a], ids[n->b])
+               : fossil_type_tribool_expr_or(&e, ids[n->a], ids[n->b]);
+    }
+
+    uint64_t start = bench_now_ns();
+    uint64_t walked = 0;
+    for (size_t r = 0; r < BENCH_ROWS; r++) walked = walked * 3u + (uint64_t)bench_eval(BENCH_NODES - 1, r);
+    bench_report("recursive walk per row", bench_now_ns() - start, BENCH_ROWS, walked);
+
+    fossil_type_tribool_program_init(&p);
+    fossil_type_tribool_vec_init(&out, 0);
+    start = bench_now_ns();
+    fossil_type_tribool_program_compile(&p, &e, ids[BENCH_NODES - 1]);
+    uint64_t compiled_ns = bench_now_ns() - start;
+    start = bench_now_ns();
+    fossil_type_tribool_program_run(&p, &out, inputs, BENCH_COLS);
+    uint64_t ns = bench_now_ns() - start;
+    uint64_t vm = 0;
+    for (size_t r = 0; r < BENCH_ROWS; r++) vm = vm * 3u + (uint64_t)fossil_type_tribool_vec_get(&out, r);
+    bench_report("bytecode VM, packed", ns, BENCH_ROWS, vm);
+    printf("%zu nodes, %zu instructions, %zu registers, compiled in %llu ns\n",
+           fossil_type_tribool_expr_count(&e), p.length, p.registers, (unsigned long long)compiled_ns);
+
+    fossil_type_tribool_program_free(&p);
+    fossil_type_tribool_expr_free(&e);
+    fossil_type_tribool_vec_free(&out);
+    for (unsigned c = 0; c < BENCH_COLS; c++) {
+        fossil_type_tribool_vec_free(&packed[c]);
+        free(bench_cols[c]);
+    }
+
+    if (walked != vm) {
+        fprintf(stderr, "result mismatch between variants\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <cstdlib>
+
+/*
+ * Evaluates the rule p0 AND (p1 OR p2) over 1M rows with three costly
+ * predicates, eagerly through Tribool's operators and lazily through the
+ * expression templates, under value mixes seen in practice: a selective
+ * first filter (mostly FALSE), evenly mixed values, and sparse data
+ * (mostly UNKNOWN, which never short-circuits). Reports time per row and
+ * the number of predicate calls each form makes.
+ */
+
+namespace {
+
+constexpr size_t bench_rows = 1u << 20;
+
+struct Mix {
+    const char *name;
+    int pct_false, pct_true; // the rest is UNKNOWN
+};
+
+constexpr Mix bench_mixes[] = {
+    {"selective (80% F)", 80, 15},
+    {"mixed (1/3 each)", 33, 33},
+    {"sparse (60% U)", 20, 20},
+};
+
+tribool bench_cols[3][bench_rows];
+size_t bench_calls;
+uint32_t bench_sink;
+
+// A predicate with some real work in it, so skipping it matters.
+fossil::type::Tribool bench_predicate(int col, size_t row) {
+    bench_calls++;
+    uint32_t h = (uint32_t)row * 2654435761u;
+    for (int i = 0; i < 32; i++) h = (h ^ (h >> 15)) * 0x2c1b3c6du;
+    bench_sink ^= h;
+    return fossil::type::Tribool(bench_cols[col][row]);
+}
+
+void bench_fill(const Mix& mix) {
+    for (int c = 0; c < 3; c++) {
+        for (size_t r = 0; r < bench_rows; r++) {
+            int x = rand() % 100;
+            bench_cols[c][r] = x < mix.pct_false ? FOSSIL_TYPE_TRIBOOL_FALSE
+                             : x < mix.pct_false + mix.pct_true ? FOSSIL_TYPE_TRIBOOL_TRUE
+                             : FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    using fossil::type::Tribool;
+    using fossil::type::lazy;
+    int ok = 1;
+    srand(42);
+
+    for (const Mix& mix : bench_mixes) {
+        bench_fill(mix);
+        printf("%s\n", mix.name);
+
+        bench_calls = 0;
+        uint64_t eager = 0;
+        uint64_t start = bench_now_ns();
+        for (size_t r = 0; r < bench_rows; r++) {
+            Tribool v = bench_predicate(0, r) && (bench_predicate(1, r) || bench_predicate(2, r));
+            eager = eager * 3u + (uint64_t)v.to_storage();
+        }
+        bench_report("  eager operators", bench_now_ns() - start, bench_rows, eager);
+        size_t eager_calls = bench_calls;
+
+        bench_calls = 0;
+        uint64_t deferred = 0;
+        start = bench_now_ns();
+        for (size_t r = 0; r < bench_rows; r++) {
+            auto rule = lazy([r] { return bench_predicate(0, r); }) &&
+                        (lazy([r] { return bench_predicate(1, r); }) || lazy([r] { return bench_predicate(2, r); }));
+            deferred = deferred * 3u + (uint64_t)rule.eval().to_storage();
+        }
+        bench_report("  lazy templates", bench_now_ns() - start, bench_rows, deferred);
+
+        printf("  predicate calls: eager %zu, lazy %zu (%.1f%% skipped)\n", eager_calls, bench_calls,
+               100.0 * (double)(eager_calls - bench_calls) / (double)eager_calls);
+        ok &= eager == deferred;
+    }
+
+    if (!ok) {
+        fprintf(stderr, "result mismatch between variants\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <stdlib.h>
+
+/*
+ * Evaluates the five-input rule (a AND b) OR (c AND d) OR e over 1M rows
+ * three ways: the scalar lookup per row, the packed LUT evaluator, and the
+ * same rule composed from the built-in packed AND/OR kernels. The LUT cost
+ * does not depend on the rule, so this is the worst case for it: a rule the
+ * built-in kernels express in four passes.
+ */
+
+#define BENCH_ROWS   (1u << 20)
+#define BENCH_INPUTS 5u
+
+static tribool bench_rule(const tribool *in, void *user) {
+    (void)user;
+    tribool ab = fossil_type_tribool_and(in[0], in[1]);
+    tribool cd = fossil_type_tribool_and(in[2], in[3]);
+    return fossil_type_tribool_or(fossil_type_tribool_or(ab, cd), in[4]);
+}
+
+static uint64_t bench_checksum(const tribool_vec *v) {
+    uint64_t sum = 0;
+    for (size_t r = 0; r < v->length; r++) sum = sum * 3u + (uint64_t)fossil_type_tribool_vec_get(v, r);
+    return sum;
+}
+
+int main(void) {
+    tribool *cols[BENCH_INPUTS];
+    tribool_vec packed[BENCH_INPUTS], out, tmp;
+    const tribool_vec *inputs[BENCH_INPUTS];
+    tribool_lut lut;
+
+    srand(42);
+    for (unsigned c = 0; c < BENCH_INPUTS; c++) {
+        cols[c] = (tribool *)malloc(BENCH_ROWS * sizeof(tribool));
+        if (!cols[c]) return 1;
+        for (size_t r = 0; r < BENCH_ROWS; r++) cols[c][r] = (tribool)(rand() % 3);
+        fossil_type_tribool_vec_init(&packed[c], 0);
+        fossil_type_tribool_vec_pack(&packed[c], cols[c], BENCH_ROWS);
+        inputs[c] = &packed[c];
+    }
+    fossil_type_tribool_lut_compile_fn(&lut, BENCH_INPUTS, bench_rule, NULL);
+
+    uint64_t start = bench_now_ns();
+    uint64_t scalar = 0;
+    for (size_t r = 0; r < BENCH_ROWS; r++) {
+        tribool row[BENCH_INPUTS];
+        for (unsigned c = 0; c < BENCH_INPUTS; c++) row[c] = cols[c][r];
+        scalar = scalar * 3u + (uint64_t)fossil_type_tribool_lut_eval(&lut, row);
+    }
+    bench_report("scalar lookup per row", bench_now_ns() - start, BENCH_ROWS, scalar);
+
+    fossil_type_tribool_vec_init(&out, 0);
+    start = bench_now_ns();
+    fossil_type_tribool_lut_run(&lut, &out, inputs, BENCH_INPUTS);
+    uint64_t ns = bench_now_ns() - start;
+    uint64_t packed_lut = bench_checksum(&out);
+    bench_report("LUT gather, packed", ns, BENCH_ROWS, packed_lut);
+
+    fossil_type_tribool_vec_init(&tmp, 0);
+    start = bench_now_ns();
+    fossil_type_tribool_vec_and(&out, &packed[0], &packed[1]);
+    fossil_type_tribool_vec_and(&tmp, &packed[2], &packed[3]);
+    fossil_type_tribool_vec_or(&out, &out, &tmp);
+    fossil_type_tribool_vec_or(&out, &out, &packed[4]);
+    ns = bench_now_ns() - start;
+    uint64_t builtin = bench_checksum(&out);
+    bench_report("built-in AND/OR, packed", ns, BENCH_ROWS, builtin);
+
+    fossil_type_tribool_vec_free(&out);
+    fossil_type_tribool_vec_free(&tmp);
+    for (unsigned c = 0; c < BENCH_INPUTS; c++) {
+        fossil_type_tribool_vec_free(&packed[c]);
+        free(cols[c]);
+    }
+
+    if (scalar != packed_lut || packed_lut != builtin) {
+        fprintf(stderr, "result mismatch between variants\n");
+        return 1;
+    }
+    return 0;
+}
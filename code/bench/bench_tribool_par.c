@@ -0,0 +1,92 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/framework.h"
+#include "bench.h"
+
+#include <stdlib.h>
+
+/*
+ * Scaling of the pooled bulk operations over a 256M-lane vector (64 MiB
+ * per operand), from 1 to 64 threads: element-wise AND, a full-scan
+ * all() (every lane TRUE but the last, so no chunk settles early) and
+ * count_true(). Each row is checked against the serial result; speedup
+ * is relative to the single-thread pool.
+ */
+
+#define BENCH_LANES ((size_t)1 << 28)
+
+static const size_t bench_threads[] = {1, 2, 4, 8, 16, 32, 64};
+
+int main(void) {
+    tribool_vec a, b, dst, flat;
+    fossil_type_tribool_vec_init(&a, BENCH_LANES);
+    fossil_type_tribool_vec_init(&b, BENCH_LANES);
+    fossil_type_tribool_vec_init(&dst, 0);
+    fossil_type_tribool_vec_init(&flat, BENCH_LANES);
+    if (!a.words || !b.words || !flat.words) return 1;
+
+    srand(42);
+    for (size_t w = 0; w < FOSSIL_TYPE_TRIBOOL_VEC_WORDS(BENCH_LANES); w++) {
+        uint64_t x = ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+        uint64_t y = ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+        /* Turn the 11 lanes of a random word into UNKNOWN. */
+        a.words[w] = x & ~((x & 0x5555555555555555ULL) & ((x >> 1) & 0x5555555555555555ULL));
+        b.words[w] = y & ~((y & 0x5555555555555555ULL) & ((y >> 1) & 0x5555555555555555ULL));
+    }
+    fossil_type_tribool_vec_fill(&flat, FOSSIL_TYPE_TRIBOOL_TRUE);
+    fossil_type_tribool_vec_set(&flat, BENCH_LANES - 1, FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+
+    fossil_type_tribool_vec_and(&dst, &a, &b);
+    size_t want_and = fossil_type_tribool_vec_count_true(&dst);
+    size_t want_count = fossil_type_tribool_vec_count_true(&a);
+    tribool want_all = fossil_type_tribool_vec_all(&flat);
+
+    printf("%-8s %14s %14s %14s\n", "threads", "and ns/lane", "all ns/lane", "count ns/lane");
+    double base[3] = {0, 0, 0};
+    int ok = 1;
+    for (size_t t = 0; t < sizeof(bench_threads) / sizeof(bench_threads[0]); t++) {
+        tribool_pool pool;
+        if (fossil_type_tribool_pool_init(&pool, bench_threads[t]) != 0) return 1;
+        double ns[3];
+
+        uint64_t start = bench_now_ns();
+        fossil_type_tribool_vec_and_par(&pool, &dst, &a, &b);
+        ns[0] = (double)(bench_now_ns() - start) / (double)BENCH_LANES;
+        ok &= fossil_type_tribool_vec_count_true(&dst) == want_and;
+
+        start = bench_now_ns();
+        ok &= fossil_type_tribool_vec_all_par(&pool, &flat) == want_all;
+        ns[1] = (double)(bench_now_ns() - start) / (double)BENCH_LANES;
+
+        start = bench_now_ns();
+        ok &= fossil_type_tribool_vec_count_true_par(&pool, &a) == want_count;
+        ns[2] = (double)(bench_now_ns() - start) / (double)BENCH_LANES;
+
+        if (t == 0) for (int i = 0; i < 3; i++) base[i] = ns[i];
+        printf("%-8zu %8.4f x%-5.1f %8.4f x%-5.1f %8.4f x%-5.1f\n", pool.threads,
+               ns[0], base[0] / ns[0], ns[1], base[1] / ns[1], ns[2], base[2] / ns[2]);
+        fossil_type_tribool_pool_free(&pool);
+    }
+
+    fossil_type_tribool_vec_free(&a);
+    fossil_type_tribool_vec_free(&b);
+    fossil_type_tribool_vec_free(&dst);
+    fossil_type_tribool_vec_free(&flat);
+
+    if (!ok) {
+        fprintf(stderr, "result mismatch between variants\n");
+        return 1;
+    }
+    return 0;
+}
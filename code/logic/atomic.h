@@ -0,0 +1,175 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_ATOMIC_H
+#define FOSSIL_TYPE_ATOMIC_H
+
+/*
+ * Private header: atomic primitives and futex-style waiting shared by the
+ * lock-free containers. Not installed and not part of the public API.
+ *
+ * Words are declared with FOSSIL_TYPE_ATOMIC from the public headers; these
+ * helpers map onto C11 <stdatomic.h>, the GCC/Clang builtins or the MSVC
+ * Interlocked intrinsics, whichever matches that declaration. Translation
+ * units that wait must define _DEFAULT_SOURCE before any system header so
+ * syscall() is visible on glibc.
+ */
+
+#include "fossil/type/tribool_atomic.h"
+
+#if defined(FOSSIL_TYPE_HAVE_C11_ATOMICS)
+#  include <stdatomic.h>
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+#endif
+
+#if defined(__linux__)
+#  include <limits.h>
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#elif defined(_WIN32)
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+#else
+#  include <sched.h>
+#endif
+
+/* ---------------- Loads, stores and compare-and-swap ---------------- */
+
+static inline uint32_t fossil_type_atomic_load_u32(const fossil_type_atomic_u32 *p) {
+#if defined(FOSSIL_TYPE_HAVE_C11_ATOMICS)
+    return atomic_load_explicit((fossil_type_atomic_u32 *)p, memory_order_acquire);
+#elif defined(_MSC_VER)
+    return (uint32_t)_InterlockedCompareExchange((volatile long *)p, 0, 0);
+#else
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline uint64_t fossil_type_atomic_load_u64(const fossil_type_atomic_u64 *p) {
+#if defined(FOSSIL_TYPE_HAVE_C11_ATOMICS)
+    return atomic_load_explicit((fossil_type_atomic_u64 *)p, memory_order_acquire);
+#elif defined(_MSC_VER)
+    return (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)p, 0, 0);
+#else
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline void fossil_type_atomic_store_u64(fossil_type_atomic_u64 *p, uint64_t v) {
+#if defined(FOSSIL_TYPE_HAVE_C11_ATOMICS)
+    atomic_store_explicit(p, v, memory_order_release);
+#elif defined(_MSC_VER)
+    _InterlockedExchange64((volatile __int64 *)p, (__int64)v);
+#else
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+#endif
+}
+
+static inline void fossil_type_atomic_store_u32(fossil_type_atomic_u32 *p, uint32_t v) {
+#if defined(FOSSIL_TYPE_HAVE_C11_ATOMICS)
+    atomic_store_explicit(p, v, memory_order_release);
+#elif defined(_MSC_VER)
+    _InterlockedExchange((volatile long *)p, (long)v);
+#else
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+#endif
+}
+
+/* Plain initialization before the word is shared. */
+static inline void fossil_type_atomic_init_u32(fossil_type_atomic_u32 *p, uint32_t v) {
+#if defined(FOSSIL_TYPE_HAVE_C11_ATOMICS)
+    atomic_init(p, v);
+#else
+    *p = v;
+#endif
+}
+
+static inline void fossil_type_atomic_init_u64(fossil_type_atomic_u64 *p, uint64_t v) {
+#if defined(FOSSIL_TYPE_HAVE_C11_ATOMICS)
+    atomic_init(p, v);
+#else
+    *p = v;
+#endif
+}
+
+/* Strong CAS with acq_rel ordering; on failure *expected receives the current value. */
+static inline int fossil_type_atomic_cas_u32(fossil_type_atomic_u32 *p, uint32_t *expected, uint32_t desired) {
+#if defined(FOSSIL_TYPE_HAVE_C11_ATOMICS)
+    return atomic_compare_exchange_strong_explicit(p, expected, desired,
+                                                   memory_order_acq_rel, memory_order_acquire);
+#elif defined(_MSC_VER)
+    long prev = _InterlockedCompareExchange((volatile long *)p, (long)desired, (long)*expected);
+    if ((uint32_t)prev == *expected) return 1;
+    *expected = (uint32_t)prev;
+    return 0;
+#else
+    return __atomic_compare_exchange_n(p, expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline int fossil_type_atomic_cas_u64(fossil_type_atomic_u64 *p, uint64_t *expected, uint64_t desired) {
+#if defined(FOSSIL_TYPE_HAVE_C11_ATOMICS)
+    return atomic_compare_exchange_strong_explicit(p, expected, desired,
+                                                   memory_order_acq_rel, memory_order_acquire);
+#elif defined(_MSC_VER)
+    __int64 prev = _InterlockedCompareExchange64((volatile __int64 *)p, (__int64)desired, (__int64)*expected);
+    if ((uint64_t)prev == *expected) return 1;
+    *expected = (uint64_t)prev;
+    return 0;
+#else
+    return __atomic_compare_exchange_n(p, expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/* ---------------- Waiting ---------------- */
+
+/*
+ * Sleeps while the 32-bit word at addr still holds expected. Spurious
+ * returns are allowed, so callers re-check in a loop. Without a futex
+ * this degrades to yielding the processor.
+ */
+static inline void fossil_type_atomic_wait32(const void *addr, uint32_t expected) {
+#if defined(__linux__)
+    syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+#elif defined(_WIN32)
+    (void)addr; (void)expected;
+    SwitchToThread();
+#else
+    (void)addr; (void)expected;
+    sched_yield();
+#endif
+}
+
+/* Wakes every thread sleeping on the 32-bit word at addr. */
+static inline void fossil_type_atomic_wake32(const void *addr) {
+#if defined(__linux__)
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#else
+    (void)addr;
+#endif
+}
+
+#endif /* FOSSIL_TYPE_ATOMIC_H */
@@ -0,0 +1,318 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/bitpack.h"
+#include "simd.h"
+#include <stdlib.h>
+
+/* ======================================================
+ * Widening and narrowing
+ *
+ * Blocks are packed and unpacked as 64-bit values: signed
+ * kinds sign-extend, unsigned kinds zero-extend. Narrowing
+ * keeps the low bits, which restores either exactly.
+ * ====================================================== */
+
+static void widen(uint64_t *out, const void *src, size_t size, int is_signed, size_t n) {
+    switch (size) {
+        case 1:
+            if (is_signed) for (size_t i = 0; i < n; i++) out[i] = (uint64_t)(int64_t)((const int8_t *)src)[i];
+            else for (size_t i = 0; i < n; i++) out[i] = ((const uint8_t *)src)[i];
+            break;
+        case 2:
+            if (is_signed) for (size_t i = 0; i < n; i++) out[i] = (uint64_t)(int64_t)((const int16_t *)src)[i];
+            else for (size_t i = 0; i < n; i++) out[i] = ((const uint16_t *)src)[i];
+            break;
+        case 4:
+            if (is_signed) for (size_t i = 0; i < n; i++) out[i] = (uint64_t)(int64_t)((const int32_t *)src)[i];
+            else for (size_t i = 0; i < n; i++) out[i] = ((const uint32_t *)src)[i];
+            break;
+        default:
+            for (size_t i = 0; i < n; i++) out[i] = ((const uint64_t *)src)[i];
+            break;
+    }
+}
+
+static void narrow(void *dst, const uint64_t *v, size_t size, size_t n) {
+    switch (size) {
+        case 1: for (size_t i = 0; i < n; i++) ((uint8_t *)dst)[i] = (uint8_t)v[i]; break;
+        case 2: for (size_t i = 0; i < n; i++) ((uint16_t *)dst)[i] = (uint16_t)v[i]; break;
+        case 4: for (size_t i = 0; i < n; i++) ((uint32_t *)dst)[i] = (uint32_t)v[i]; break;
+        default: for (size_t i = 0; i < n; i++) ((uint64_t *)dst)[i] = v[i]; break;
+    }
+}
+
+/* ======================================================
+ * Packing
+ * ====================================================== */
+
+#define BITPACK_SIGN 0x8000000000000000ULL
+
+/*
+ * Finds a block's base and width. Unsigned values are biased
+ * by their sign bit so one signed compare orders both; the
+ * bias cancels in the subtraction that gives the range.
+ */
+static void block_frame(const uint64_t *v, size_t n, uint64_t flip, fossil_type_bitpack_block *b) {
+    int64_t lo = INT64_MAX, hi = INT64_MIN;
+    for (size_t i = 0; i < n; i++) {
+        int64_t x = (int64_t)(v[i] ^ flip);
+        lo = x < lo ? x : lo;
+        hi = x > hi ? x : hi;
+    }
+    b->base = (uint64_t)lo ^ flip;
+    b->width = fossil_type_bit_width64((uint64_t)hi - (uint64_t)lo);
+}
+
+static size_t block_words(size_t n, unsigned width) {
+    return (n * width + 63) / 64;
+}
+
+/* Lays the deltas end to end, low bits first; a delta may straddle two words. */
+static void pack_block(uint64_t *out, const uint64_t *v, size_t n, uint64_t base, unsigned width) {
+    if (width == 0) return;
+    uint64_t acc = 0;
+    unsigned fill = 0;
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t d = v[i] - base;
+        acc |= d << fill;
+        fill += width;
+        if (fill >= 64) {
+            out[k++] = acc;
+            fill -= 64;
+            acc = fill ? d >> (width - fill) : 0;
+        }
+    }
+    if (fill) out[k] = acc;
+}
+
+/* ======================================================
+ * Unpacking kernels
+ *
+ * Value i of a block sits at bit i * width. It is the word
+ * holding that bit shifted down, OR the next word shifted
+ * up to supply any high bits that straddle; the next word
+ * always exists thanks to the padding word. Blocks of
+ * width 0 never reach a kernel.
+ * ====================================================== */
+
+typedef void (*bitpack_unpack_fn)(const uint64_t *words, unsigned width, size_t n,
+                                  uint64_t base, uint64_t *out);
+
+static inline uint64_t unpack_one(const uint64_t *words, unsigned width, size_t i) {
+    size_t bit = i * width;
+    size_t k = bit >> 6;
+    unsigned s = (unsigned)(bit & 63);
+    uint64_t mask = width == 64 ? ~0ULL : (1ULL << width) - 1;
+    /* Two shifts keep the count below 64 when s is 0, where the next word contributes nothing. */
+    return ((words[k] >> s) | ((words[k + 1] << 1) << (63 - s))) & mask;
+}
+
+static void unpack_scalar(const uint64_t *words, unsigned width, size_t n, uint64_t base, uint64_t *out) {
+    for (size_t i = 0; i < n; i++) out[i] = base + unpack_one(words, width, i);
+}
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+/*
+ * Four values per step: gather the word holding each one and
+ * the word after it, then shift both into place with per-lane
+ * counts. A count of 64 yields 0 in vpsllvq, so aligned values
+ * need no special case.
+ */
+FOSSIL_TYPE_TARGET_AVX2
+static void unpack_avx2(const uint64_t *words, unsigned width, size_t n, uint64_t base, uint64_t *out) {
+    const long long *w = (const long long *)(const void *)words;
+    const __m256i mask = _mm256_set1_epi64x(width == 64 ? -1LL : (long long)((1ULL << width) - 1));
+    const __m256i b = _mm256_set1_epi64x((long long)base);
+    const __m256i low6 = _mm256_set1_epi64x(63);
+    const __m256i full = _mm256_set1_epi64x(64);
+    const __m256i step = _mm256_set1_epi64x((long long)width * 4);
+    __m256i bit = _mm256_setr_epi64x(0, (long long)width, (long long)width * 2, (long long)width * 3);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i k = _mm256_srli_epi64(bit, 6);
+        __m256i s = _mm256_and_si256(bit, low6);
+        __m256i lo = _mm256_i64gather_epi64(w, k, 8);
+        __m256i hi = _mm256_i64gather_epi64(w + 1, k, 8);
+        __m256i v = _mm256_or_si256(_mm256_srlv_epi64(lo, s), _mm256_sllv_epi64(hi, _mm256_sub_epi64(full, s)));
+        _mm256_storeu_si256((__m256i *)(void *)(out + i), _mm256_add_epi64(_mm256_and_si256(v, mask), b));
+        bit = _mm256_add_epi64(bit, step);
+    }
+    for (; i < n; i++) out[i] = base + unpack_one(words, width, i);
+}
+
+#endif
+
+static bitpack_unpack_fn select_kernel(void) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) return unpack_avx2;
+#endif
+    return unpack_scalar;
+}
+
+/* ======================================================
+ * Public API
+ * ====================================================== */
+
+static const fossil_type_limits *bitpack_limits(fossil_type_limits_kind kind) {
+    const fossil_type_limits *l = fossil_type_limits_get_by_kind(kind);
+    /* bool and tribool are integers in the table, but not columns worth packing. */
+    if (!l || !(l->flags & FOSSIL_TYPE_LIMITS_INTEGER) || (l->flags & FOSSIL_TYPE_LIMITS_LOGIC)) return NULL;
+    return l;
+}
+
+void fossil_type_bitpack_init(fossil_type_bitpack *p) {
+    if (!p) return;
+    p->kind = FOSSIL_TYPE_KIND_U8;
+    p->count = 0;
+    p->block_size = FOSSIL_TYPE_BITPACK_BLOCK;
+    p->block_count = 0;
+    p->blocks = NULL;
+    p->words = NULL;
+    p->word_count = 0;
+}
+
+void fossil_type_bitpack_free(fossil_type_bitpack *p) {
+    if (!p) return;
+    free(p->blocks);
+    free(p->words);
+    fossil_type_bitpack_init(p);
+}
+
+int fossil_type_bitpack_encode(fossil_type_bitpack *p, const void *src, fossil_type_limits_kind kind,
+                               size_t count, size_t block_size) {
+    const fossil_type_limits *l = bitpack_limits(kind);
+    if (!p || !l || (count && !src)) return -1;
+    if (block_size != FOSSIL_TYPE_BITPACK_BLOCK && block_size != FOSSIL_TYPE_BITPACK_BLOCK_SMALL) return -1;
+
+    size_t nblocks = (count + block_size - 1) / block_size;
+    fossil_type_bitpack_block *blocks = NULL;
+    if (nblocks) {
+        blocks = (fossil_type_bitpack_block *)malloc(nblocks * sizeof(fossil_type_bitpack_block));
+        if (!blocks) return -1;
+    }
+
+    int is_signed = (l->flags & FOSSIL_TYPE_LIMITS_SIGNED) != 0;
+    uint64_t flip = is_signed ? 0 : BITPACK_SIGN;
+    uint64_t v[FOSSIL_TYPE_BITPACK_BLOCK];
+    const unsigned char *s = (const unsigned char *)src;
+
+    /* First pass frames every block, so the words can be allocated once. */
+    size_t total = 0;
+    for (size_t b = 0; b < nblocks; b++) {
+        size_t first = b * block_size;
+        size_t n = count - first < block_size ? count - first : block_size;
+        widen(v, s + first * l->size, l->size, is_signed, n);
+        block_frame(v, n, flip, &blocks[b]);
+        blocks[b].offset = total;
+        total += block_words(n, blocks[b].width);
+    }
+
+    uint64_t *words = (uint64_t *)calloc(total + 1, sizeof(uint64_t));
+    if (!words) {
+        free(blocks);
+        return -1;
+    }
+    for (size_t b = 0; b < nblocks; b++) {
+        size_t first = b * block_size;
+        size_t n = count - first < block_size ? count - first : block_size;
+        widen(v, s + first * l->size, l->size, is_signed, n);
+        pack_block(words + blocks[b].offset, v, n, blocks[b].base, blocks[b].width);
+    }
+
+    fossil_type_bitpack_free(p);
+    p->kind = kind;
+    p->count = count;
+    p->block_size = block_size;
+    p->block_count = nblocks;
+    p->blocks = blocks;
+    p->words = words;
+    p->word_count = total;
+    return 0;
+}
+
+int fossil_type_bitpack_encode_id(fossil_type_bitpack *p, const void *src, const char *type_id,
+                                  size_t count, size_t block_size) {
+    fossil_type_limits_kind kind = fossil_type_limits_kind_of(type_id);
+    if (kind == FOSSIL_TYPE_KIND_COUNT) return -1;
+    /* A registered ID may be narrower than its storage kind; its bounds must hold. */
+    const fossil_type_limits *l = fossil_type_limits_get(type_id);
+    if (l != fossil_type_limits_get_by_kind(kind)) {
+        fossil_type_range_result r;
+        if (!p || fossil_type_range_check_limits(src, kind, count, l, &r, NULL) != 0 || r.violations) return -1;
+    }
+    return fossil_type_bitpack_encode(p, src, kind, count, block_size);
+}
+
+static void decode_one_block(const fossil_type_bitpack *p, bitpack_unpack_fn fn, size_t block,
+                             void *dst, size_t size) {
+    const fossil_type_bitpack_block *b = &p->blocks[block];
+    size_t first = block * p->block_size;
+    size_t n = p->count - first < p->block_size ? p->count - first : p->block_size;
+    uint64_t tmp[FOSSIL_TYPE_BITPACK_BLOCK];
+    uint64_t *out = size == sizeof(uint64_t) ? (uint64_t *)dst : tmp;
+
+    if (b->width == 0) {
+        for (size_t i = 0; i < n; i++) out[i] = b->base;
+    } else {
+        fn(p->words + b->offset, b->width, n, b->base, out);
+    }
+    if (out == tmp) narrow(dst, tmp, size, n);
+}
+
+int fossil_type_bitpack_decode(const fossil_type_bitpack *p, void *dst) {
+    const fossil_type_limits *l = p ? bitpack_limits(p->kind) : NULL;
+    if (!l || (p->count && !dst)) return -1;
+    bitpack_unpack_fn fn = select_kernel();
+    unsigned char *d = (unsigned char *)dst;
+    for (size_t b = 0; b < p->block_count; b++) {
+        decode_one_block(p, fn, b, d + b * p->block_size * l->size, l->size);
+    }
+    return 0;
+}
+
+int fossil_type_bitpack_decode_block(const fossil_type_bitpack *p, size_t block, void *dst) {
+    const fossil_type_limits *l = p ? bitpack_limits(p->kind) : NULL;
+    if (!l || !dst || block >= p->block_count) return -1;
+    decode_one_block(p, select_kernel(), block, dst, l->size);
+    return 0;
+}
+
+int fossil_type_bitpack_get(const fossil_type_bitpack *p, size_t index, void *value) {
+    const fossil_type_limits *l = p ? bitpack_limits(p->kind) : NULL;
+    if (!l || !value || index >= p->count) return -1;
+    const fossil_type_bitpack_block *b = &p->blocks[index / p->block_size];
+    uint64_t v = b->base;
+    if (b->width) v += unpack_one(p->words + b->offset, b->width, index % p->block_size);
+    narrow(value, &v, l->size, 1);
+    return 0;
+}
+
+size_t fossil_type_bitpack_bytes(const fossil_type_bitpack *p) {
+    if (!p) return 0;
+    return sizeof(*p) + p->block_count * sizeof(fossil_type_bitpack_block) +
+           (p->words ? (p->word_count + 1) * sizeof(uint64_t) : 0);
+}
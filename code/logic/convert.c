@@ -0,0 +1,312 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/convert.h"
+#include "simd.h"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/* ======================================================
+ * Storage slots
+ *
+ * Kinds collapse onto ten storage types; aliases and char
+ * share the kernel of their width and signedness.
+ * ====================================================== */
+
+enum {
+    SLOT_I8, SLOT_I16, SLOT_I32, SLOT_I64,
+    SLOT_U8, SLOT_U16, SLOT_U32, SLOT_U64,
+    SLOT_F32, SLOT_F64,
+    SLOT_COUNT
+};
+
+static int convert_slot(const fossil_type_limits *l) {
+    if (l->flags & FOSSIL_TYPE_LIMITS_FLOAT) {
+        if (l->size == sizeof(float)) return SLOT_F32;
+        if (l->size == sizeof(double)) return SLOT_F64;
+        return -1;
+    }
+    if (!(l->flags & FOSSIL_TYPE_LIMITS_INTEGER) || (l->flags & FOSSIL_TYPE_LIMITS_LOGIC)) return -1;
+    int base = (l->flags & FOSSIL_TYPE_LIMITS_SIGNED) ? SLOT_I8 : SLOT_U8;
+    switch (l->size) {
+        case 1: return base;
+        case 2: return base + 1;
+        case 4: return base + 2;
+        case 8: return base + 3;
+        default: return -1;
+    }
+}
+
+/* ======================================================
+ * Pair kernels
+ *
+ * One wrap and one saturate kernel per (from, to) pair,
+ * stamped out from the type lists below. The loops are
+ * branch-free selects so the compiler can vectorize each
+ * pair on its own; under AVX2 the same bodies are built a
+ * second time with the wider target enabled.
+ *
+ * Saturating integer kernels clamp in the source type:
+ * the target bounds are intersected with the source range
+ * first, so both fit the source type exactly.
+ * ====================================================== */
+
+typedef struct convert_bounds {
+    int64_t lo;    /* Target minimum, clamped to the source range. */
+    uint64_t hi;   /* Target maximum, clamped to the source range. */
+    double flo;    /* Target minimum as a float source bound. */
+    double fhi;    /* Target maximum + 1 as a float source bound, exclusive. */
+    double fmax;   /* Largest finite value of a float target. */
+} convert_bounds;
+
+typedef void (*convert_fn)(void *dst, const void *src, size_t n, const convert_bounds *b);
+
+/* Float to integer wrap: truncate, then reduce modulo 2^64; NaN and infinities give 0. Scalar fixup only. */
+static uint64_t convert_wrap_bits(double x) {
+    if (!(x == x) || x == HUGE_VAL || x == -HUGE_VAL) return 0;
+    double t = trunc(x);
+    if (t >= -9223372036854775808.0 && t < 9223372036854775808.0) return (uint64_t)(int64_t)t;
+    double r = fmod(t, 18446744073709551616.0);
+    return r < 0 ? 0 - (uint64_t)(-r) : (uint64_t)r;
+}
+
+#define CONVERT_INT_INT_WRAP(F, T)  d[i] = (T)s[i];
+#define CONVERT_INT_INT_SAT(F, T)   {                                           \
+        F v = s[i];                                                             \
+        v = v < (F)b->lo ? (F)b->lo : v;                                        \
+        v = v > (F)b->hi ? (F)b->hi : v;                                        \
+        d[i] = (T)v;                                                            \
+    }
+#define CONVERT_INT_FLT_WRAP(F, T)  d[i] = (T)s[i];
+#define CONVERT_INT_FLT_SAT(F, T)   d[i] = (T)s[i];
+#define CONVERT_FLT_INT_WRAP(F, T)  {                                           \
+        double x = (double)s[i];                                                \
+        uint64_t in = (uint64_t)(fabs(x) < 9223372036854775808.0), bits;       \
+        memcpy(&bits, &x, sizeof(bits));                                        \
+        bits &= 0 - in;                                                         \
+        memcpy(&x, &bits, sizeof(bits));                                        \
+        wide |= in ^ 1;                                                         \
+        d[i] = (T)(uint64_t)(int64_t)x;                                         \
+    }
+#define CONVERT_FLT_INT_SAT(F, T)   {                                           \
+        F x = s[i];                                                             \
+        T r = x < (F)b->flo ? (T)b->lo : (T)0;                                  \
+        r = x >= (F)b->fhi ? (T)b->hi : r;                                      \
+        d[i] = x >= (F)b->flo && x < (F)b->fhi ? (T)x : r;                      \
+    }
+#define CONVERT_FLT_FLT_WRAP(F, T)  {                                           \
+        double x = (double)s[i], a = fabs(x);                                   \
+        d[i] = (T)(a > b->fmax && a < HUGE_VAL ? copysign(HUGE_VAL, x) : x);    \
+    }
+#define CONVERT_FLT_FLT_SAT(F, T)   {                                           \
+        double x = (double)s[i], a = fabs(x);                                   \
+        d[i] = (T)(a > b->fmax && a < HUGE_VAL ? copysign(b->fmax, x) : x);     \
+    }
+
+#define CONVERT_KERNEL(name, attr, F, T, body)                                  \
+    attr static void name(void *dst, const void *src, size_t n,                 \
+                          const convert_bounds *b) {                            \
+        T *d = (T *)dst;                                                        \
+        const F *s = (const F *)src;                                            \
+        (void)b;                                                                \
+        for (size_t i = 0; i < n; i++) body(F, T)                               \
+    }
+
+/*
+ * Float to integer wrap masks every value outside (-2^63, 2^63) to
+ * +0.0 by its bits and truncates, so the loop has no branches and the
+ * convert is always defined. It also notes whether any value was
+ * masked; only then does a scalar pass rewrite those lanes, reducing
+ * modulo 2^64 (NaN and infinities give 0).
+ */
+#define CONVERT_WRAP_KERNEL_FLT_INT(name, attr, F, T, body)                     \
+    attr static void name(void *dst, const void *src, size_t n,                 \
+                          const convert_bounds *b) {                            \
+        T *d = (T *)dst;                                                        \
+        const F *s = (const F *)src;                                            \
+        uint64_t wide = 0;                                                      \
+        (void)b;                                                                \
+        for (size_t i = 0; i < n; i++) body(F, T)                               \
+        for (size_t i = 0; wide && i < n; i++) {                                \
+            double x = (double)s[i];                                            \
+            if (!(fabs(x) < 9223372036854775808.0)) d[i] = (T)convert_wrap_bits(x); \
+        }                                                                       \
+    }
+#define CONVERT_WRAP_KERNEL_INT_INT CONVERT_KERNEL
+#define CONVERT_WRAP_KERNEL_INT_FLT CONVERT_KERNEL
+#define CONVERT_WRAP_KERNEL_FLT_FLT CONVERT_KERNEL
+
+#define CONVERT_TO_LIST(X, f, F, fc)                                            \
+    X(f, F, fc, i8,  int8_t,   INT)                                             \
+    X(f, F, fc, i16, int16_t,  INT)                                             \
+    X(f, F, fc, i32, int32_t,  INT)                                             \
+    X(f, F, fc, i64, int64_t,  INT)                                             \
+    X(f, F, fc, u8,  uint8_t,  INT)                                             \
+    X(f, F, fc, u16, uint16_t, INT)                                             \
+    X(f, F, fc, u32, uint32_t, INT)                                             \
+    X(f, F, fc, u64, uint64_t, INT)                                             \
+    X(f, F, fc, f32, float,    FLT)                                             \
+    X(f, F, fc, f64, double,   FLT)
+
+#define CONVERT_FROM_LIST(X)                                                    \
+    X(i8,  int8_t,   INT)                                                       \
+    X(i16, int16_t,  INT)                                                       \
+    X(i32, int32_t,  INT)                                                       \
+    X(i64, int64_t,  INT)                                                       \
+    X(u8,  uint8_t,  INT)                                                       \
+    X(u16, uint16_t, INT)                                                       \
+    X(u32, uint32_t, INT)                                                       \
+    X(u64, uint64_t, INT)                                                       \
+    X(f32, float,    FLT)                                                       \
+    X(f64, double,   FLT)
+
+#define CONVERT_PAIR(f, F, fc, t, T, tc)                                        \
+    CONVERT_WRAP_KERNEL_##fc##_##tc(convert_##f##_##t##_wrap, , F, T, CONVERT_##fc##_##tc##_WRAP) \
+    CONVERT_KERNEL(convert_##f##_##t##_sat, , F, T, CONVERT_##fc##_##tc##_SAT)
+#define CONVERT_ROW(f, F, fc) CONVERT_TO_LIST(CONVERT_PAIR, f, F, fc)
+CONVERT_FROM_LIST(CONVERT_ROW)
+#undef CONVERT_ROW
+
+#define CONVERT_ENTRY(f, F, fc, t, T, tc) {convert_##f##_##t##_wrap, convert_##f##_##t##_sat},
+#define CONVERT_ROW(f, F, fc) {CONVERT_TO_LIST(CONVERT_ENTRY, f, F, fc)},
+static const convert_fn convert_scalar[SLOT_COUNT][SLOT_COUNT][2] = {
+    CONVERT_FROM_LIST(CONVERT_ROW)
+};
+#undef CONVERT_ROW
+#undef CONVERT_ENTRY
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+#define CONVERT_PAIR_AVX2(f, F, fc, t, T, tc)                                   \
+    CONVERT_WRAP_KERNEL_##fc##_##tc(convert_##f##_##t##_wrap_avx2, FOSSIL_TYPE_TARGET_AVX2, F, T, CONVERT_##fc##_##tc##_WRAP) \
+    CONVERT_KERNEL(convert_##f##_##t##_sat_avx2, FOSSIL_TYPE_TARGET_AVX2, F, T, CONVERT_##fc##_##tc##_SAT)
+#define CONVERT_ROW(f, F, fc) CONVERT_TO_LIST(CONVERT_PAIR_AVX2, f, F, fc)
+CONVERT_FROM_LIST(CONVERT_ROW)
+#undef CONVERT_ROW
+
+#define CONVERT_ENTRY(f, F, fc, t, T, tc) {convert_##f##_##t##_wrap_avx2, convert_##f##_##t##_sat_avx2},
+#define CONVERT_ROW(f, F, fc) {CONVERT_TO_LIST(CONVERT_ENTRY, f, F, fc)},
+static const convert_fn convert_avx2[SLOT_COUNT][SLOT_COUNT][2] = {
+    CONVERT_FROM_LIST(CONVERT_ROW)
+};
+#undef CONVERT_ROW
+#undef CONVERT_ENTRY
+
+#endif
+
+static convert_fn select_kernel(int from, int to, int saturate) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) return convert_avx2[from][to][saturate];
+#endif
+    return convert_scalar[from][to][saturate];
+}
+
+/* ======================================================
+ * Dispatcher
+ * ====================================================== */
+
+/* CHECKED conversions validate and convert in cache-sized chunks; so do clamped SATURATE ones. */
+#define CONVERT_CHUNK 4096
+
+/*
+ * lt carries the bounds values must meet: the storage record of to, or
+ * a registered record stored as to. The kernels convert into the full
+ * storage range; a narrower record is then enforced by the range check
+ * (CHECKED) or by clamping the converted chunk in place with the
+ * storage type's own saturating kernel (SATURATE).
+ */
+static int convert_run(void *dst, const fossil_type_limits *lt, fossil_type_limits_kind to,
+                       const void *src, fossil_type_limits_kind from, size_t count,
+                       fossil_type_convert_policy policy, size_t *fail_index) {
+    if (fail_index) *fail_index = FOSSIL_TYPE_RANGE_NPOS;
+    const fossil_type_limits *ls = fossil_type_limits_get_by_kind(to);
+    const fossil_type_limits *lf = fossil_type_limits_get_by_kind(from);
+    if (!lt || !ls || !lf || (count && (!dst || !src))) return -1;
+    if (policy != FOSSIL_TYPE_CONVERT_WRAP && policy != FOSSIL_TYPE_CONVERT_SATURATE &&
+        policy != FOSSIL_TYPE_CONVERT_CHECKED) return -1;
+
+    int st = convert_slot(ls), sf = convert_slot(lf);
+    if (st < 0 || sf < 0) return -1;
+
+    convert_bounds b;
+    b.lo = ls->min_int > lf->min_int ? ls->min_int : lf->min_int;
+    b.hi = ls->max_uint < lf->max_uint ? ls->max_uint : lf->max_uint;
+    b.flo = (double)ls->min_int;
+    b.fhi = (double)ls->max_uint + 1.0;
+    b.fmax = ls->size == sizeof(float) ? (double)FLT_MAX : DBL_MAX;
+
+    int narrowed = lt->min_int > ls->min_int || lt->max_uint < ls->max_uint;
+    unsigned char *d = (unsigned char *)dst;
+    const unsigned char *s = (const unsigned char *)src;
+
+    if (policy == FOSSIL_TYPE_CONVERT_WRAP || (policy == FOSSIL_TYPE_CONVERT_SATURATE && !narrowed)) {
+        select_kernel(sf, st, policy == FOSSIL_TYPE_CONVERT_SATURATE)(dst, src, count, &b);
+        return 0;
+    }
+
+    if (policy == FOSSIL_TYPE_CONVERT_SATURATE) {
+        convert_fn fn = select_kernel(sf, st, 1), clamp = select_kernel(st, st, 1);
+        convert_bounds c = b;
+        c.lo = lt->min_int;
+        c.hi = lt->max_uint;
+        for (size_t base = 0; base < count; base += CONVERT_CHUNK) {
+            size_t n = count - base < CONVERT_CHUNK ? count - base : CONVERT_CHUNK;
+            fn(d + base * ls->size, s + base * lf->size, n, &b);
+            clamp(d + base * ls->size, d + base * ls->size, n, &c);
+        }
+        return 0;
+    }
+
+    convert_fn fn = select_kernel(sf, st, 0);
+    for (size_t base = 0; base < count; base += CONVERT_CHUNK) {
+        size_t n = count - base < CONVERT_CHUNK ? count - base : CONVERT_CHUNK;
+        fossil_type_range_result r;
+        if (fossil_type_range_check_limits(s + base * lf->size, from, n, lt, &r, NULL) != 0) return -1;
+        if (r.violations) {
+            fn(d + base * ls->size, s + base * lf->size, r.first, &b);
+            if (fail_index) *fail_index = base + r.first;
+            return -1;
+        }
+        fn(d + base * ls->size, s + base * lf->size, n, &b);
+    }
+    return 0;
+}
+
+int fossil_type_convert(void *dst, fossil_type_limits_kind to, const void *src,
+                        fossil_type_limits_kind from, size_t count,
+                        fossil_type_convert_policy policy, size_t *fail_index) {
+    return convert_run(dst, fossil_type_limits_get_by_kind(to), to, src, from, count, policy, fail_index);
+}
+
+int fossil_type_convert_id(void *dst, const char *to, const void *src, const char *from,
+                           size_t count, fossil_type_convert_policy policy, size_t *fail_index) {
+    fossil_type_limits_kind kt = fossil_type_limits_kind_of(to);
+    fossil_type_limits_kind kf = fossil_type_limits_kind_of(from);
+    if (kt == FOSSIL_TYPE_KIND_COUNT || kf == FOSSIL_TYPE_KIND_COUNT) {
+        if (fail_index) *fail_index = FOSSIL_TYPE_RANGE_NPOS;
+        return -1;
+    }
+    return convert_run(dst, fossil_type_limits_get(to), kt, src, kf, count, policy, fail_index);
+}
@@ -0,0 +1,230 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_BITPACK_H
+#define FOSSIL_TYPE_BITPACK_H
+
+#include "types.h"
+#include "limits.h"
+#include "convert.h"
+
+#ifdef __cplusplus
+#include <span>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Frame-of-Reference Bit Packing
+ *
+ * Compresses an integer column (i8..i64, u8..u64, their
+ * h/o/b aliases and char) in blocks of 128 or 256 values.
+ * Each block stores its smallest value as a base and every
+ * value as its distance from that base, using the fewest
+ * bits that hold the block's largest distance: 0 bits for
+ * a constant block, up to 64 for one spanning the whole
+ * type. Deltas are laid end to end, low bits first, so a
+ * block of n values at width w takes n * w / 64 words.
+ *
+ * Every block records where its words start, so any block,
+ * or any single value, decodes without touching the rest.
+ * Decoding round-trips the input exactly.
+ * ====================================================== */
+
+/** Default values per block. */
+#define FOSSIL_TYPE_BITPACK_BLOCK 256
+
+/** The smaller supported block, for columns read in small random pieces. */
+#define FOSSIL_TYPE_BITPACK_BLOCK_SMALL 128
+
+typedef struct fossil_type_bitpack_block {
+    uint64_t base;    /**< Smallest value, sign-extended to 64 bits for signed kinds. */
+    size_t offset;    /**< Index of the block's first word. */
+    unsigned width;   /**< Bits per delta, 0..64. */
+} fossil_type_bitpack_block;
+
+typedef struct fossil_type_bitpack {
+    fossil_type_limits_kind kind;       /**< Element type of the column. */
+    size_t count;                       /**< Number of values. */
+    size_t block_size;                  /**< Values per block; the last block may hold fewer. */
+    size_t block_count;                 /**< Number of blocks. */
+    fossil_type_bitpack_block *blocks;  /**< Per-block base, offset and width. */
+    uint64_t *words;                    /**< Packed deltas, followed by one zero word of padding. */
+    size_t word_count;                  /**< Words holding deltas, not counting the padding. */
+} fossil_type_bitpack;
+
+/**
+ * @brief Initializes an empty packed column.
+ * @param p The column to initialize.
+ */
+void fossil_type_bitpack_init(fossil_type_bitpack *p);
+
+/**
+ * @brief Releases a packed column's storage and leaves it empty.
+ * @param p The column to free.
+ */
+void fossil_type_bitpack_free(fossil_type_bitpack *p);
+
+/**
+ * @brief Packs an array, replacing whatever p held.
+ * @param p An initialized column; left untouched on failure.
+ * @param src Array of count values of the given kind.
+ * @param kind Element type; must be an integer kind.
+ * @param count Number of values.
+ * @param block_size FOSSIL_TYPE_BITPACK_BLOCK or FOSSIL_TYPE_BITPACK_BLOCK_SMALL.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_bitpack_encode(fossil_type_bitpack *p, const void *src, fossil_type_limits_kind kind,
+                               size_t count, size_t block_size);
+
+/**
+ * @brief Packs an array named by type ID, as in fossil_type_limits_get.
+ *
+ * A registered ID is packed as its storage kind once every value is
+ * checked against the registered bounds.
+ *
+ * @return 0 on success, -1 on an unknown or non-integer type ID, a value
+ *         outside a registered ID's bounds, or as for fossil_type_bitpack_encode.
+ */
+int fossil_type_bitpack_encode_id(fossil_type_bitpack *p, const void *src, const char *type_id,
+                                  size_t count, size_t block_size);
+
+/**
+ * @brief Unpacks the whole column.
+ * @param p The packed column.
+ * @param dst Array with room for p->count values of p->kind.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_bitpack_decode(const fossil_type_bitpack *p, void *dst);
+
+/**
+ * @brief Unpacks one block.
+ * @param p The packed column.
+ * @param block Block index in [0, p->block_count).
+ * @param dst Receives the block's values: p->block_size of them, or fewer for the last block.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_bitpack_decode_block(const fossil_type_bitpack *p, size_t block, void *dst);
+
+/**
+ * @brief Reads a single value.
+ * @param p The packed column.
+ * @param index Value index in [0, p->count).
+ * @param value Receives the value as one element of p->kind.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_bitpack_get(const fossil_type_bitpack *p, size_t index, void *value);
+
+/**
+ * @brief Returns the memory the packed column occupies, block table included.
+ * @param p The packed column; NULL gives 0.
+ * @return Size in bytes.
+ */
+size_t fossil_type_bitpack_bytes(const fossil_type_bitpack *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class BitPack {
+    fossil_type_bitpack p;
+
+    template <class V>
+    bool matches() const {
+        static_assert(std::is_integral_v<V> && !std::is_same_v<V, bool>, "BitPack holds integer values");
+        const fossil_type_limits *l = fossil_type_limits_get_by_kind(p.kind);
+        return l && l->size == sizeof(V);
+    }
+
+public:
+    BitPack() { fossil_type_bitpack_init(&p); }
+    BitPack(const BitPack&) = delete;
+    BitPack& operator=(const BitPack&) = delete;
+    ~BitPack() { fossil_type_bitpack_free(&p); }
+
+    /**
+     * @brief Packs a column of native integers; the kind follows from V.
+     */
+    template <class V>
+    bool encode(std::span<const V> values, size_t block_size = FOSSIL_TYPE_BITPACK_BLOCK) {
+        static_assert(std::is_integral_v<V> && !std::is_same_v<V, bool>, "BitPack holds integer values");
+        return fossil_type_bitpack_encode(&p, values.data(), native_kind<V>(), values.size(), block_size) == 0;
+    }
+
+    /**
+     * @brief Unpacks the column; out must hold size() values of the packed width.
+     */
+    template <class V>
+    bool decode(std::span<V> out) const {
+        return matches<V>() && out.size() >= p.count && fossil_type_bitpack_decode(&p, out.data()) == 0;
+    }
+
+    /**
+     * @brief Unpacks one block; out must hold block_size() values of the packed width.
+     */
+    template <class V>
+    bool decode_block(size_t block, std::span<V> out) const {
+        return matches<V>() && out.size() >= p.block_size &&
+               fossil_type_bitpack_decode_block(&p, block, out.data()) == 0;
+    }
+
+    /**
+     * @brief Reads one value; V{} when out of range or of the wrong width.
+     */
+    template <class V>
+    V get(size_t index) const {
+        V v{};
+        if (!matches<V>() || fossil_type_bitpack_get(&p, index, &v) != 0) return V{};
+        return v;
+    }
+
+    size_t size() const { return p.count; }
+    size_t block_size() const { return p.block_size; }
+    size_t block_count() const { return p.block_count; }
+    fossil_type_limits_kind kind() const { return p.kind; }
+
+    /**
+     * @brief Returns the packed footprint in bytes, block table included.
+     */
+    size_t bytes() const { return fossil_type_bitpack_bytes(&p); }
+
+    fossil_type_bitpack* raw() { return &p; }
+    const fossil_type_bitpack* raw() const { return &p; }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_CONVERT_H
+#define FOSSIL_TYPE_CONVERT_H
+
+#include "types.h"
+#include "limits.h"
+#include "range.h"
+
+#ifdef __cplusplus
+#include <type_traits>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Bulk Conversion
+ *
+ * Converts arrays between the fixed-width numeric types:
+ * i8..i64, u8..u64 (and their h/o/b aliases), char, f32
+ * and f64. Every (from, to) pair has its own kernel, so
+ * there is no per-element branch on the types. How values
+ * that do not fit are handled is the caller's choice:
+ *
+ *   WRAP      Integers keep their low bits (two's complement).
+ *             Floats to integers truncate toward zero and
+ *             then wrap; NaN and infinities become 0. f64 to
+ *             f32 overflows to infinity.
+ *   SATURATE  Values clamp to the target's min or max. NaN
+ *             becomes 0; infinities clamp like any other
+ *             out-of-range value. f64 to f32 clamps finite
+ *             values to +/-FLT_MAX.
+ *   CHECKED   Stops at the first value that does not fit, as
+ *             decided by the range checks in range.h (NaN
+ *             never fits an integer). Values before it are
+ *             converted; the rest of dst is left untouched.
+ *
+ * Conversions that cannot go out of range (widening, any
+ * integer to float, f32 to f64) give the same result under
+ * every policy. Infinities and NaN carry over between
+ * float types. dst and src must not overlap.
+ * ====================================================== */
+
+typedef enum fossil_type_convert_policy {
+    FOSSIL_TYPE_CONVERT_WRAP,
+    FOSSIL_TYPE_CONVERT_SATURATE,
+    FOSSIL_TYPE_CONVERT_CHECKED
+} fossil_type_convert_policy;
+
+/**
+ * @brief Converts count values from one type to another.
+ *
+ * @param dst Output with room for count values of type to.
+ * @param to Target type kind.
+ * @param src Array of count values of type from.
+ * @param from Source type kind.
+ * @param count Number of values.
+ * @param policy How values that do not fit are handled.
+ * @param fail_index Receives the index of the value a CHECKED conversion
+ *        stopped at, else FOSSIL_TYPE_RANGE_NPOS; may be NULL.
+ * @return 0 on success; -1 on invalid arguments, unsupported kinds (bool,
+ *         tribool, cstr) or a CHECKED conversion that found a value out
+ *         of range.
+ */
+int fossil_type_convert(void *dst, fossil_type_limits_kind to, const void *src,
+                        fossil_type_limits_kind from, size_t count,
+                        fossil_type_convert_policy policy, size_t *fail_index);
+
+/**
+ * @brief Converts count values between types named by type ID.
+ *
+ * Resolves both IDs with fossil_type_limits_kind_of and then behaves like
+ * fossil_type_convert, except that a registered target keeps its own
+ * bounds: CHECKED stops at values outside the record's min_int/max_uint
+ * and SATURATE clamps to them (NaN becomes 0 and is then clamped). WRAP
+ * still wraps modulo the storage width, so its results may fall outside
+ * a registered range. Values are read and written at the storage kind's
+ * size either way.
+ *
+ * @return 0 on success, -1 on unknown IDs or any fossil_type_convert failure.
+ */
+int fossil_type_convert_id(void *dst, const char *to, const void *src, const char *from,
+                           size_t count, fossil_type_convert_policy policy, size_t *fail_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+/**
+ * @brief Maps a native integer or floating point type to its kind.
+ */
+template <class V>
+constexpr fossil_type_limits_kind native_kind() {
+    static_assert(std::is_arithmetic_v<V> && !std::is_same_v<V, bool> && sizeof(V) <= 8,
+                  "native_kind needs an integer or floating point type");
+    if constexpr (std::is_same_v<V, float>) return FOSSIL_TYPE_KIND_F32;
+    else if constexpr (std::is_same_v<V, double>) return FOSSIL_TYPE_KIND_F64;
+    else if constexpr (std::is_signed_v<V>) {
+        if constexpr (sizeof(V) == 1) return FOSSIL_TYPE_KIND_I8;
+        else if constexpr (sizeof(V) == 2) return FOSSIL_TYPE_KIND_I16;
+        else if constexpr (sizeof(V) == 4) return FOSSIL_TYPE_KIND_I32;
+        else return FOSSIL_TYPE_KIND_I64;
+    } else {
+        if constexpr (sizeof(V) == 1) return FOSSIL_TYPE_KIND_U8;
+        else if constexpr (sizeof(V) == 2) return FOSSIL_TYPE_KIND_U16;
+        else if constexpr (sizeof(V) == 4) return FOSSIL_TYPE_KIND_U32;
+        else return FOSSIL_TYPE_KIND_U64;
+    }
+}
+
+/**
+ * @brief Converts an array of native values, picking the kernel from both element types.
+ *
+ * @return 0 on success, -1 on invalid arguments or a failed CHECKED conversion.
+ */
+template <class To, class From>
+int convert(To *dst, const From *src, size_t count,
+            fossil_type_convert_policy policy = FOSSIL_TYPE_CONVERT_CHECKED,
+            size_t *fail_index = nullptr) {
+    return fossil_type_convert(dst, native_kind<To>(), src, native_kind<From>(), count, policy, fail_index);
+}
+
+} // namespace fossil::type
+
+#endif
+
+#endif
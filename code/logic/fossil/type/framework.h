@@ -28,7 +28,25 @@
 // Include the necessary headers
 #include "types.h"
 #include "tribool.h"
+#include "tribool_vec.h"
+#include "tribool_slice.h"
+#include "tribool_trit.h"
+#include "tribool_rle.h"
+#include "tribool_cmp.h"
+#include "tribool_select.h"
+#include "tribool_atomic.h"
+#include "tribool_expr.h"
+#include "tribool_graph.h"
+#include "tribool_lut.h"
+#include "tribool_par.h"
+#include "tribool_table.h"
+#include "tribool_lazy.h"
 #include "feature.h"
 #include "limits.h"
+#include "range.h"
+#include "convert.h"
+#include "infer.h"
+#include "bitpack.h"
+#include "registry.h"
 
 #endif /* FOSSIL_TYPE_FRAMEWORK_H */
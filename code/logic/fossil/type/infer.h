@@ -0,0 +1,160 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_INFER_H
+#define FOSSIL_TYPE_INFER_H
+
+#include "types.h"
+#include "limits.h"
+#include "tribool_par.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Narrowest-Type Inference
+ *
+ * Scans a column once and recommends the smallest type in
+ * the limits table that holds every value, together with
+ * the value range. Integer candidates are tried by size,
+ * unsigned before signed: u8, i8, u16, i16, u32, i32, u64,
+ * i64. An f64 column whose values are all finite integers
+ * may narrow to one of these; otherwise it is f32 when
+ * every value survives a round trip through float (NaN and
+ * infinities do), else f64. Where an integer type and f32
+ * are the same size the integer type wins.
+ *
+ * An empty column infers u8 with a zero range.
+ * ====================================================== */
+
+/** Values per chunk for the multithreaded scans. */
+#define FOSSIL_TYPE_INFER_GRAIN 65536
+
+/** A value in the input's own type; which member is set depends on the scan. */
+typedef union fossil_type_infer_value {
+    int64_t i64;
+    uint64_t u64;
+    double f64;
+} fossil_type_infer_value;
+
+typedef struct fossil_type_infer_result {
+    fossil_type_limits_kind kind;  /**< Narrowest kind that holds every value. */
+    const char *type_id;           /**< Type ID of kind. */
+    fossil_type_infer_value min;   /**< Smallest value; NaN is skipped for f64, and an all-NaN column reports NaN. */
+    fossil_type_infer_value max;   /**< Largest value, as for min. */
+    bool integral;                 /**< Every value is finite with no fractional part; always true for integer scans. */
+} fossil_type_infer_result;
+
+/**
+ * @brief Infers the narrowest type for a column of signed 64-bit values.
+ * @param src Array of count values.
+ * @param count Number of values.
+ * @param out Receives the recommendation; min and max use the i64 member.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_infer_i64(const int64_t *src, size_t count, fossil_type_infer_result *out);
+
+/**
+ * @brief Infers the narrowest type for a column of unsigned 64-bit values.
+ * @param src Array of count values.
+ * @param count Number of values.
+ * @param out Receives the recommendation; min and max use the u64 member.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_infer_u64(const uint64_t *src, size_t count, fossil_type_infer_result *out);
+
+/**
+ * @brief Infers the narrowest type for a column of doubles.
+ * @param src Array of count values.
+ * @param count Number of values.
+ * @param out Receives the recommendation; min and max use the f64 member.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_infer_f64(const double *src, size_t count, fossil_type_infer_result *out);
+
+/**
+ * @brief Multithreaded fossil_type_infer_i64; scans FOSSIL_TYPE_INFER_GRAIN-value chunks on the pool.
+ * @param pool The pool, or NULL to scan on the calling thread.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_infer_i64_par(tribool_pool *pool, const int64_t *src, size_t count,
+                              fossil_type_infer_result *out);
+
+/**
+ * @brief Multithreaded fossil_type_infer_u64; see fossil_type_infer_i64_par.
+ */
+int fossil_type_infer_u64_par(tribool_pool *pool, const uint64_t *src, size_t count,
+                              fossil_type_infer_result *out);
+
+/**
+ * @brief Multithreaded fossil_type_infer_f64; see fossil_type_infer_i64_par.
+ */
+int fossil_type_infer_f64_par(tribool_pool *pool, const double *src, size_t count,
+                              fossil_type_infer_result *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+#include <span>
+
+namespace fossil::type {
+
+/**
+ * @brief Infers the narrowest type for a column, optionally on a pool.
+ *
+ * @param values The column; int64_t, uint64_t or double.
+ * @param pool Pool to scan on, or nullptr for the calling thread.
+ * @return The recommendation; kind is FOSSIL_TYPE_KIND_COUNT and type_id
+ *         nullptr if the scan failed.
+ */
+template <class V>
+fossil_type_infer_result infer(std::span<const V> values, TriboolPool *pool = nullptr) {
+    static_assert(std::is_same_v<V, int64_t> || std::is_same_v<V, uint64_t> || std::is_same_v<V, double>,
+                  "infer needs int64_t, uint64_t or double values");
+    fossil_type_infer_result r{};
+    tribool_pool *raw = pool ? pool->raw() : nullptr;
+    int rc;
+    if constexpr (std::is_same_v<V, int64_t>) rc = fossil_type_infer_i64_par(raw, values.data(), values.size(), &r);
+    else if constexpr (std::is_same_v<V, uint64_t>) rc = fossil_type_infer_u64_par(raw, values.data(), values.size(), &r);
+    else rc = fossil_type_infer_f64_par(raw, values.data(), values.size(), &r);
+    if (rc != 0) {
+        r = fossil_type_infer_result{};
+        r.kind = FOSSIL_TYPE_KIND_COUNT;
+    }
+    return r;
+}
+
+} // namespace fossil::type
+
+#endif
+
+#endif
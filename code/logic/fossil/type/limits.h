@@ -26,18 +26,66 @@
 #define FOSSIL_TYPE_LIMITS_H
 
 #include <stddef.h>
+#include "types.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Kind flags carried by each limits record. */
+#define FOSSIL_TYPE_LIMITS_INTEGER  0x01u /**< Integer-coded values, bounds in min_int/max_uint. */
+#define FOSSIL_TYPE_LIMITS_SIGNED   0x02u /**< Values may be negative. */
+#define FOSSIL_TYPE_LIMITS_FLOAT    0x04u /**< IEEE-754 floating point. */
+#define FOSSIL_TYPE_LIMITS_LOGIC    0x08u /**< Truth values (bool, tribool). */
+#define FOSSIL_TYPE_LIMITS_VARIABLE 0x10u /**< No fixed value range (cstr). */
+
 typedef struct fossil_type_limits {
     const char* type_id;
-    long double min_value;
-    long double max_value;
+    long double min_value; /**< Smallest value; for f32/f64 the most negative finite value. */
+    long double max_value; /**< Largest value; for f32/f64 the largest finite value. */
     size_t size;
+    int64_t min_int;   /**< Exact lower bound; 0 for unsigned built-in types. */
+    uint64_t max_uint; /**< Exact upper bound. */
+    unsigned flags;    /**< FOSSIL_TYPE_LIMITS_* kind flags. */
 } fossil_type_limits;
 
+/**
+ * @brief Integer identifiers for the type IDs, in limits table order.
+ *
+ * Callers that know the type ahead of time should keep one of these
+ * instead of the string and look it up with fossil_type_limits_get_by_kind,
+ * which is a plain array index.
+ */
+typedef enum fossil_type_limits_kind {
+    FOSSIL_TYPE_KIND_I8,
+    FOSSIL_TYPE_KIND_I16,
+    FOSSIL_TYPE_KIND_I32,
+    FOSSIL_TYPE_KIND_I64,
+    FOSSIL_TYPE_KIND_U8,
+    FOSSIL_TYPE_KIND_U16,
+    FOSSIL_TYPE_KIND_U32,
+    FOSSIL_TYPE_KIND_U64,
+    FOSSIL_TYPE_KIND_H8,
+    FOSSIL_TYPE_KIND_H16,
+    FOSSIL_TYPE_KIND_H32,
+    FOSSIL_TYPE_KIND_H64,
+    FOSSIL_TYPE_KIND_O8,
+    FOSSIL_TYPE_KIND_O16,
+    FOSSIL_TYPE_KIND_O32,
+    FOSSIL_TYPE_KIND_O64,
+    FOSSIL_TYPE_KIND_B8,
+    FOSSIL_TYPE_KIND_B16,
+    FOSSIL_TYPE_KIND_B32,
+    FOSSIL_TYPE_KIND_B64,
+    FOSSIL_TYPE_KIND_F32,
+    FOSSIL_TYPE_KIND_F64,
+    FOSSIL_TYPE_KIND_BOOL,
+    FOSSIL_TYPE_KIND_TRIBOOL,
+    FOSSIL_TYPE_KIND_CHAR,
+    FOSSIL_TYPE_KIND_CSTR,
+    FOSSIL_TYPE_KIND_COUNT
+} fossil_type_limits_kind;
+
 /**
  * @brief Retrieves the limits for the specified type ID.
  *
@@ -53,20 +101,237 @@ typedef struct fossil_type_limits {
  *   - Character:         "char"
  *   - C string:          "cstr"
  *
+ * The lookup switches on the ID length and leading characters and confirms
+ * the one candidate with a single compare, so its cost does not grow with
+ * the table.
+ *
+ * IDs added through the registry (registry.h) are found too, after the
+ * built-in ones, in a lock-free hashed lookup.
+ *
  * @param type_id The identifier of the type to retrieve limits for.
  * @return A pointer to a fossil_type_limits struct containing the limits for the type,
  *         or NULL if the type ID is not recognized.
  */
 const fossil_type_limits *fossil_type_limits_get(const char* type_id);
 
+/**
+ * @brief Retrieves the limits for the specified type kind.
+ *
+ * @param kind The kind of the type to retrieve limits for.
+ * @return A pointer to the limits for the type, or NULL if kind is out of range.
+ */
+const fossil_type_limits *fossil_type_limits_get_by_kind(fossil_type_limits_kind kind);
+
+/**
+ * @brief Maps a type ID to its kind.
+ *
+ * A registered ID maps to the built-in kind its values are stored as.
+ *
+ * @param type_id The identifier of the type.
+ * @return The matching kind, or FOSSIL_TYPE_KIND_COUNT if the ID is not recognized.
+ */
+fossil_type_limits_kind fossil_type_limits_kind_of(const char* type_id);
+
+/* ======================================================
+ * Exact range checks
+ *
+ * These compare against min_int/max_uint only and never
+ * convert to floating point. Integer types fit when the
+ * value is inside their range; float types accept every
+ * integer (range, not precision); cstr and unknown kinds
+ * accept nothing.
+ * ====================================================== */
+
+/**
+ * @brief Checks that a signed value is in range for a limits record.
+ *
+ * @param limits The limits record, may be NULL.
+ * @param value The value to check.
+ * @return true if the value fits, false otherwise or if limits is NULL.
+ */
+static inline bool fossil_type_limits_fits_i64(const fossil_type_limits* limits, int64_t value) {
+    if (!limits || !(limits->flags & (FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_FLOAT))) return false;
+    /* Bitwise, not short-circuit: mixed-sign data would mispredict a branch. */
+    return (value >= limits->min_int) & ((value < 0) | ((uint64_t)value <= limits->max_uint));
+}
+
+/**
+ * @brief Checks that an unsigned value is in range for a limits record.
+ *
+ * @param limits The limits record, may be NULL.
+ * @param value The value to check.
+ * @return true if the value fits, false otherwise or if limits is NULL.
+ */
+static inline bool fossil_type_limits_fits_u64(const fossil_type_limits* limits, uint64_t value) {
+    if (!limits || !(limits->flags & (FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_FLOAT))) return false;
+    /* Only registered types have a positive lower bound. */
+    return (value <= limits->max_uint) & ((limits->min_int <= 0) | (value >= (uint64_t)limits->min_int));
+}
+
+/**
+ * @brief Checks that a signed value is in range for a type kind.
+ *
+ * @param kind The type kind.
+ * @param value The value to check.
+ * @return true if the value fits, false otherwise or if kind is out of range.
+ */
+bool fossil_type_fits_i64(fossil_type_limits_kind kind, int64_t value);
+
+/**
+ * @brief Checks that an unsigned value is in range for a type kind.
+ *
+ * @param kind The type kind.
+ * @param value The value to check.
+ * @return true if the value fits, false otherwise or if kind is out of range.
+ */
+bool fossil_type_fits_u64(fossil_type_limits_kind kind, uint64_t value);
+
 #ifdef __cplusplus
 }
 #endif
 
 
 #ifdef __cplusplus
+#include <limits>
+#include <type_traits>
+#include <stdint.h>
+
 namespace fossil::type {
 
+/* ======================================================
+ * Compile-time type traits
+ *
+ * One specialization per wrapper class in types.h. Values
+ * are known to the compiler, so checks built on them fold
+ * to immediate comparisons; the string lookup below is for
+ * types only known at run time.
+ * ====================================================== */
+
+/**
+ * @brief Compile-time description of a fossil wrapper type.
+ *
+ * Members of every specialization:
+ *   - value_type:  the native type the wrapper holds
+ *   - id:          the limits type ID, or nullptr if the type has none
+ *   - kind:        the limits kind, or FOSSIL_TYPE_KIND_COUNT if the type has none
+ *   - size, alignment
+ *   - is_integer, is_signed, is_floating
+ */
+template <class T>
+struct TypeTraits;
+
+#define FOSSIL_TYPE_TRAITS(Class, Native, Id, Kind)                                  \
+    template <>                                                                       \
+    struct TypeTraits<Class> {                                                        \
+        using value_type = Native;                                                    \
+        static constexpr const char *id = Id;                                         \
+        static constexpr fossil_type_limits_kind kind = Kind;                         \
+        static constexpr size_t size = sizeof(Native);                                \
+        static constexpr size_t alignment = alignof(Native);                          \
+        static constexpr bool is_integer = std::is_integral_v<Native>;                \
+        static constexpr bool is_signed = std::is_signed_v<Native>;                   \
+        static constexpr bool is_floating = std::is_floating_point_v<Native>;         \
+    }
+
+FOSSIL_TYPE_TRAITS(I8,  int8_t,  "i8",  FOSSIL_TYPE_KIND_I8);
+FOSSIL_TYPE_TRAITS(I16, int16_t, "i16", FOSSIL_TYPE_KIND_I16);
+FOSSIL_TYPE_TRAITS(I32, int32_t, "i32", FOSSIL_TYPE_KIND_I32);
+FOSSIL_TYPE_TRAITS(I64, int64_t, "i64", FOSSIL_TYPE_KIND_I64);
+FOSSIL_TYPE_TRAITS(U8,  uint8_t,  "u8",  FOSSIL_TYPE_KIND_U8);
+FOSSIL_TYPE_TRAITS(U16, uint16_t, "u16", FOSSIL_TYPE_KIND_U16);
+FOSSIL_TYPE_TRAITS(U32, uint32_t, "u32", FOSSIL_TYPE_KIND_U32);
+FOSSIL_TYPE_TRAITS(U64, uint64_t, "u64", FOSSIL_TYPE_KIND_U64);
+FOSSIL_TYPE_TRAITS(H8,  uint8_t,  "h8",  FOSSIL_TYPE_KIND_H8);
+FOSSIL_TYPE_TRAITS(H16, uint16_t, "h16", FOSSIL_TYPE_KIND_H16);
+FOSSIL_TYPE_TRAITS(H32, uint32_t, "h32", FOSSIL_TYPE_KIND_H32);
+FOSSIL_TYPE_TRAITS(H64, uint64_t, "h64", FOSSIL_TYPE_KIND_H64);
+FOSSIL_TYPE_TRAITS(O8,  uint8_t,  "o8",  FOSSIL_TYPE_KIND_O8);
+FOSSIL_TYPE_TRAITS(O16, uint16_t, "o16", FOSSIL_TYPE_KIND_O16);
+FOSSIL_TYPE_TRAITS(O32, uint32_t, "o32", FOSSIL_TYPE_KIND_O32);
+FOSSIL_TYPE_TRAITS(O64, uint64_t, "o64", FOSSIL_TYPE_KIND_O64);
+FOSSIL_TYPE_TRAITS(B8,  uint8_t,  "b8",  FOSSIL_TYPE_KIND_B8);
+FOSSIL_TYPE_TRAITS(B16, uint16_t, "b16", FOSSIL_TYPE_KIND_B16);
+FOSSIL_TYPE_TRAITS(B32, uint32_t, "b32", FOSSIL_TYPE_KIND_B32);
+FOSSIL_TYPE_TRAITS(B64, uint64_t, "b64", FOSSIL_TYPE_KIND_B64);
+FOSSIL_TYPE_TRAITS(F32, float,  "f32", FOSSIL_TYPE_KIND_F32);
+FOSSIL_TYPE_TRAITS(F64, double, "f64", FOSSIL_TYPE_KIND_F64);
+FOSSIL_TYPE_TRAITS(Isize, ptrdiff_t, nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Usize, size_t,    nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Char_t, char, "char", FOSSIL_TYPE_KIND_CHAR);
+FOSSIL_TYPE_TRAITS(Cstr, const char *, "cstr", FOSSIL_TYPE_KIND_CSTR);
+FOSSIL_TYPE_TRAITS(Ptr,  void *,       nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Cptr, const void *, nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Handle, void *,     nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Ref,  void *,       nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Atom, const void *, nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Type_id, const char *, nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Symbol,  const char *, nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Flags,   uint64_t, nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Node_id, uint64_t, nullptr, FOSSIL_TYPE_KIND_COUNT);
+FOSSIL_TYPE_TRAITS(Entropy, double,   nullptr, FOSSIL_TYPE_KIND_COUNT);
+
+#undef FOSSIL_TYPE_TRAITS
+
+/* ======================================================
+ * Limits
+ *
+ * TypeLimits<T> gives constexpr bounds for an arithmetic
+ * wrapper type. Limits is the run-time form that looks a
+ * type up by ID or kind.
+ * ====================================================== */
+
+template <class T>
+class TypeLimits {
+    using traits = TypeTraits<T>;
+    static_assert(traits::is_integer || traits::is_floating,
+                  "TypeLimits<T> needs an arithmetic fossil type");
+
+public:
+    using value_type = typename traits::value_type;
+
+    /**
+     * @brief Smallest value of the type, as its native type.
+     */
+    static constexpr value_type min() { return std::numeric_limits<value_type>::lowest(); }
+
+    /**
+     * @brief Largest value of the type, as its native type.
+     */
+    static constexpr value_type max() { return std::numeric_limits<value_type>::max(); }
+
+    /**
+     * @brief Size in bytes of the type.
+     */
+    static constexpr size_t size() { return traits::size; }
+
+    /**
+     * @brief Checks that a value lies in [min(), max()] without converting it first.
+     *
+     * Integers are compared exactly, whatever their signedness. NaN is never
+     * contained.
+     *
+     * @param v The value to check.
+     * @return true if v is representable in the type's range.
+     */
+    template <class V>
+    static constexpr bool contains(V v) {
+        static_assert(std::is_arithmetic_v<V>, "contains() needs an arithmetic value");
+        if constexpr (std::is_integral_v<V> && std::is_integral_v<value_type>) {
+            if constexpr (std::is_signed_v<V>) {
+                if (v < 0) return static_cast<intmax_t>(v) >= static_cast<intmax_t>(min());
+            }
+            return static_cast<uintmax_t>(v) <= static_cast<uintmax_t>(max());
+        } else if constexpr (std::is_integral_v<value_type>) {
+            /* Integer bounds are -2^k and 2^k - 1, so both edges are exact doubles. */
+            return static_cast<double>(v) >= static_cast<double>(min()) &&
+                   static_cast<double>(v) < static_cast<double>(max()) + 1.0;
+        } else {
+            return static_cast<long double>(v) >= static_cast<long double>(min()) &&
+                   static_cast<long double>(v) <= static_cast<long double>(max());
+        }
+    }
+};
+
 class Limits {
     const fossil_type_limits* l;
 public:
@@ -79,11 +344,27 @@ public:
         l=fossil_type_limits_get(id);
     }
 
+    /**
+     * @brief Constructs a new Limits object for the specified type kind.
+     *
+     * @param kind The kind of the type to retrieve limits for.
+     */
+    explicit Limits(fossil_type_limits_kind kind){
+        l=fossil_type_limits_get_by_kind(kind);
+    }
+
     /**
      * @brief Checks if the limits were successfully retrieved for the type.
      *
      * @return true if limits are available, false otherwise.
      */
+    bool valid() const { return l!=nullptr; }
+
+    /**
+     * @brief Retrieves the minimum value for the type.
+     *
+     * @return The minimum value if limits are available, or 0 if not.
+     */
     long double min() const { return l?l->min_value:0; }
 
     /**
@@ -99,6 +380,25 @@ public:
      * @return The size in bytes if limits are available, or 0 if not.
      */
     size_t size() const { return l?l->size:0; }
+
+    /**
+     * @brief Retrieves the FOSSIL_TYPE_LIMITS_* kind flags for the type.
+     *
+     * @return The flags if limits are available, or 0 if not.
+     */
+    unsigned flags() const { return l?l->flags:0; }
+
+    /**
+     * @brief Checks that an integer value is in range, without floating point.
+     *
+     * @return true if the value fits, false otherwise or if limits are unavailable.
+     */
+    template <class V>
+    bool fits(V v) const {
+        static_assert(std::is_integral_v<V>, "fits() needs an integer value");
+        if constexpr (std::is_signed_v<V>) return fossil_type_limits_fits_i64(l, static_cast<int64_t>(v));
+        else return fossil_type_limits_fits_u64(l, static_cast<uint64_t>(v));
+    }
 };
 
 }
@@ -0,0 +1,214 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_RANGE_H
+#define FOSSIL_TYPE_RANGE_H
+
+#include "types.h"
+#include "limits.h"
+
+#ifdef __cplusplus
+#include <type_traits>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Batch Range Validation
+ *
+ * Checks whole arrays of values against the exact bounds of
+ * a target type (min_int/max_uint) in one streaming pass.
+ * Values are compared in their own width, so no element is
+ * widened or converted to long double on the way.
+ *
+ * Every check reports through the same outputs, all of them
+ * optional:
+ *   - result:  number of violations and the first one's index
+ *   - bitmap:  one bit per value, set where the value does not
+ *              fit; needs FOSSIL_TYPE_RANGE_BITMAP_WORDS(count)
+ *              words, and bits past count are written as 0
+ *
+ * Integer targets reject values outside their range. A float
+ * source fits when it truncates toward zero into the range,
+ * so -0.5 fits u8 as 255.5 does, and must not be NaN or an
+ * infinity. Float targets accept every
+ * integer, f32 rejects finite f64 values beyond FLT_MAX, and
+ * infinities and NaN are always representable in a float.
+ * ====================================================== */
+
+/** Index reported when no value violates the range. */
+#define FOSSIL_TYPE_RANGE_NPOS ((size_t)-1)
+
+/** Number of bitmap words needed for n values. */
+#define FOSSIL_TYPE_RANGE_BITMAP_WORDS(n) (((n) + 63) / 64)
+
+typedef struct fossil_type_range_result {
+    size_t violations; /**< Number of values that do not fit. */
+    size_t first;      /**< Index of the first such value, or FOSSIL_TYPE_RANGE_NPOS. */
+} fossil_type_range_result;
+
+/**
+ * @brief Checks signed 8-bit values against a target type.
+ * @param src Array of count values.
+ * @param count Number of values.
+ * @param target Type the values must fit in.
+ * @param result Receives the violation count and first index; may be NULL.
+ * @param bitmap Receives one bit per value; may be NULL.
+ * @return 0 on success, -1 on invalid arguments or a target without a numeric range.
+ */
+int fossil_type_range_check_i8(const int8_t *src, size_t count, fossil_type_limits_kind target,
+                               fossil_type_range_result *result, uint64_t *bitmap);
+
+/** @brief Checks signed 16-bit values; see fossil_type_range_check_i8. */
+int fossil_type_range_check_i16(const int16_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap);
+
+/** @brief Checks signed 32-bit values; see fossil_type_range_check_i8. */
+int fossil_type_range_check_i32(const int32_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap);
+
+/** @brief Checks signed 64-bit values; see fossil_type_range_check_i8. */
+int fossil_type_range_check_i64(const int64_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap);
+
+/** @brief Checks unsigned 8-bit values; see fossil_type_range_check_i8. */
+int fossil_type_range_check_u8(const uint8_t *src, size_t count, fossil_type_limits_kind target,
+                               fossil_type_range_result *result, uint64_t *bitmap);
+
+/** @brief Checks unsigned 16-bit values; see fossil_type_range_check_i8. */
+int fossil_type_range_check_u16(const uint16_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap);
+
+/** @brief Checks unsigned 32-bit values; see fossil_type_range_check_i8. */
+int fossil_type_range_check_u32(const uint32_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap);
+
+/** @brief Checks unsigned 64-bit values; see fossil_type_range_check_i8. */
+int fossil_type_range_check_u64(const uint64_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap);
+
+/** @brief Checks float values; see fossil_type_range_check_i8. */
+int fossil_type_range_check_f32(const float *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap);
+
+/** @brief Checks double values; see fossil_type_range_check_i8. */
+int fossil_type_range_check_f64(const double *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap);
+
+/**
+ * @brief Checks values whose type is only known at run time.
+ *
+ * The source kind selects the kernel from its size and flags, so aliases
+ * such as h16 read as u16, char reads as i8 or u8, and bool as u8.
+ *
+ * @param src Array of count values of the source type.
+ * @param source Type of the values in src; cstr is rejected.
+ * @param count Number of values.
+ * @param target Type the values must fit in.
+ * @param result Receives the violation count and first index; may be NULL.
+ * @param bitmap Receives one bit per value; may be NULL.
+ * @return 0 on success, -1 on invalid arguments or kinds.
+ */
+int fossil_type_range_check(const void *src, fossil_type_limits_kind source, size_t count,
+                            fossil_type_limits_kind target, fossil_type_range_result *result,
+                            uint64_t *bitmap);
+
+/**
+ * @brief Checks values against an explicit limits record.
+ *
+ * Like fossil_type_range_check, but the bounds come from target itself,
+ * so a registered type's record from fossil_type_limits_get is checked
+ * against its own min_int/max_uint rather than those of its storage kind.
+ *
+ * @param target Record with the bounds; must be an integer or float record.
+ * @return 0 on success, -1 on invalid arguments or kinds.
+ */
+int fossil_type_range_check_limits(const void *src, fossil_type_limits_kind source, size_t count,
+                                   const fossil_type_limits *target, fossil_type_range_result *result,
+                                   uint64_t *bitmap);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+/**
+ * @brief Checks an array of native values against a target kind.
+ *
+ * The kernel is picked from the element type, so any integer of 8 to 64
+ * bits, float or double is accepted.
+ *
+ * @return 0 on success, -1 on invalid arguments.
+ */
+template <class V>
+int range_check(const V *src, size_t count, fossil_type_limits_kind target,
+                fossil_type_range_result *result, uint64_t *bitmap = nullptr) {
+    static_assert(std::is_arithmetic_v<V> && !std::is_same_v<V, bool>,
+                  "range_check needs integer or floating point values");
+    if constexpr (std::is_same_v<V, float>) {
+        return fossil_type_range_check_f32(src, count, target, result, bitmap);
+    } else if constexpr (std::is_same_v<V, double>) {
+        return fossil_type_range_check_f64(src, count, target, result, bitmap);
+    } else {
+        static_assert(std::is_integral_v<V> && sizeof(V) <= 8, "unsupported element type");
+        const void *p = src;
+        if constexpr (std::is_signed_v<V>) {
+            if constexpr (sizeof(V) == 1) return fossil_type_range_check_i8(static_cast<const int8_t *>(p), count, target, result, bitmap);
+            else if constexpr (sizeof(V) == 2) return fossil_type_range_check_i16(static_cast<const int16_t *>(p), count, target, result, bitmap);
+            else if constexpr (sizeof(V) == 4) return fossil_type_range_check_i32(static_cast<const int32_t *>(p), count, target, result, bitmap);
+            else return fossil_type_range_check_i64(static_cast<const int64_t *>(p), count, target, result, bitmap);
+        } else {
+            if constexpr (sizeof(V) == 1) return fossil_type_range_check_u8(static_cast<const uint8_t *>(p), count, target, result, bitmap);
+            else if constexpr (sizeof(V) == 2) return fossil_type_range_check_u16(static_cast<const uint16_t *>(p), count, target, result, bitmap);
+            else if constexpr (sizeof(V) == 4) return fossil_type_range_check_u32(static_cast<const uint32_t *>(p), count, target, result, bitmap);
+            else return fossil_type_range_check_u64(static_cast<const uint64_t *>(p), count, target, result, bitmap);
+        }
+    }
+}
+
+/**
+ * @brief Checks that every value fits the wrapper type T.
+ *
+ * @return true if the check ran and found no violations.
+ */
+template <class T, class V>
+bool all_fit(const V *src, size_t count) {
+    fossil_type_range_result r;
+    return range_check(src, count, TypeTraits<T>::kind, &r) == 0 && r.violations == 0;
+}
+
+} // namespace fossil::type
+
+#endif
+
+#endif
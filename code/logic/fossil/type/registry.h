@@ -0,0 +1,181 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_REGISTRY_H
+#define FOSSIL_TYPE_REGISTRY_H
+
+#include "types.h"
+#include "limits.h"
+
+#ifdef __cplusplus
+#include <span>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Registry
+ *
+ * Adds application-defined type IDs (fixed-point values,
+ * enums, identifiers) next to the built-in table. Each is
+ * stored as one of the built-in kinds, at that kind's size,
+ * and carries its own bounds and alignment. Once registered, an ID is
+ * understood wherever a type ID is: fossil_type_limits_get
+ * returns its record, and fossil_type_limits_kind_of (and
+ * so every *_id entry point) resolves it to its storage
+ * kind. The *_id entry points also hold values to the
+ * registered bounds where their policy checks or clamps.
+ * Built-in IDs are always matched first and cannot be
+ * shadowed.
+ *
+ * Registrations are meant for startup and are never
+ * removed. Each one publishes a new immutable hash table
+ * with a single atomic pointer swap; lookups load that
+ * pointer and probe, so readers on any number of threads
+ * never lock, retry or write shared memory. Concurrent
+ * registrations are safe too. Replaced tables are kept
+ * until fossil_type_registry_reset, because a reader may
+ * still be walking one; records keep a stable address for
+ * the same reason.
+ * ====================================================== */
+
+/** What a caller supplies to register a type. */
+typedef struct fossil_type_registration {
+    const char *type_id;           /**< New ID; copied, so it need not outlive the call. */
+    fossil_type_limits_kind kind;  /**< Built-in integer kind the values are stored as; not bool or tribool. */
+    int64_t min_int;               /**< Lower bound, inside the range of kind. */
+    uint64_t max_uint;             /**< Upper bound, inside the range of kind and at least min_int. */
+    size_t size;                   /**< Bytes per value; 0 or exactly the size of kind. */
+    size_t alignment;              /**< Power of two no larger than size; 0 for the size of kind. */
+} fossil_type_registration;
+
+/** A registered type. */
+typedef struct fossil_type_info {
+    fossil_type_limits limits;     /**< Record returned by fossil_type_limits_get; flags come from kind. */
+    size_t alignment;              /**< Required alignment in bytes. */
+    fossil_type_limits_kind kind;  /**< Storage kind that type-ID dispatch resolves to. */
+} fossil_type_info;
+
+/**
+ * @brief Registers one type.
+ *
+ * The bounds become the exact min_int/max_uint checked by
+ * fossil_type_limits_fits_* and the *_id entry points; min_value and
+ * max_value in the record are the same bounds as long double. They
+ * share the encoding of the built-in records, which leaves two kinds
+ * of range out:
+ *   - a range that is entirely negative, since max_uint is unsigned
+ *     and so every upper bound is at least 0;
+ *   - on u64 storage, a lower bound of 2^63 or more, since min_int
+ *     is signed.
+ *
+ * Only integer storage kinds can be registered; bool and tribool
+ * cannot.
+ *
+ * @param reg The type to add.
+ * @return 0 on success, -1 if the ID is taken (built in or registered),
+ *         the description is invalid, or allocation fails.
+ */
+int fossil_type_registry_add(const fossil_type_registration *reg);
+
+/**
+ * @brief Registers several types as one publication; all or none are added.
+ * @param regs Array of count descriptions.
+ * @param count Number of descriptions.
+ * @return 0 on success, -1 as for fossil_type_registry_add (IDs must also differ from each other).
+ */
+int fossil_type_registry_add_many(const fossil_type_registration *regs, size_t count);
+
+/**
+ * @brief Looks up a registered type. Lock-free.
+ * @param type_id The ID to find.
+ * @return The record, or NULL if the ID is built in or unknown.
+ */
+const fossil_type_info *fossil_type_registry_find(const char *type_id);
+
+/**
+ * @brief Returns the number of registered types.
+ */
+size_t fossil_type_registry_count(void);
+
+/**
+ * @brief Returns a registered type by registration order.
+ * @param index Index in [0, fossil_type_registry_count()).
+ * @return The record, or NULL if index is out of range.
+ */
+const fossil_type_info *fossil_type_registry_at(size_t index);
+
+/**
+ * @brief Drops every registered type and frees the retired tables.
+ *
+ * Not safe while any other thread may use the registry, or while
+ * anyone holds a record or limits pointer for a registered type.
+ * Meant for shutdown and tests.
+ */
+void fossil_type_registry_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class TypeRegistry {
+public:
+    TypeRegistry() = delete;
+
+    /**
+     * @brief Registers one type; false if the ID is taken or the description is invalid.
+     */
+    static bool add(const fossil_type_registration& reg) { return fossil_type_registry_add(&reg) == 0; }
+
+    /**
+     * @brief Registers several types at once; all or none are added.
+     */
+    static bool add(std::span<const fossil_type_registration> regs) {
+        return fossil_type_registry_add_many(regs.data(), regs.size()) == 0;
+    }
+
+    /**
+     * @brief Looks up a registered type; nullptr for built-in or unknown IDs.
+     */
+    static const fossil_type_info* find(const char* type_id) { return fossil_type_registry_find(type_id); }
+
+    static size_t size() { return fossil_type_registry_count(); }
+    static const fossil_type_info* at(size_t index) { return fossil_type_registry_at(index); }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
@@ -25,6 +25,9 @@
 #ifndef FOSSIL_TYPE_TRIBOOL_H
 #define FOSSIL_TYPE_TRIBOOL_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -41,6 +44,50 @@ typedef enum fossil_type_tribool {
 
 typedef fossil_type_tribool tribool;
 
+/* ======================================================
+ * Compact Storage
+ *
+ * The enum above is int-sized; fossil_type_tribool8 holds
+ * the same three values in one byte (0 FALSE, 1 TRUE,
+ * 2 UNKNOWN) and is what the limits table reports as the
+ * tribool storage size. Use it for arrays and tables and
+ * widen to tribool for logic.
+ * ====================================================== */
+
+typedef uint8_t fossil_type_tribool8;
+
+typedef fossil_type_tribool8 tribool8;
+
+/**
+ * @brief Narrows a tribool to one byte. Values other than TRUE/FALSE store UNKNOWN.
+ * @param t The tribool to narrow.
+ * @return The one-byte encoding of t.
+ */
+tribool8 fossil_type_tribool8_from(tribool t);
+
+/**
+ * @brief Widens a one-byte tribool. Bytes other than 0/1 read as UNKNOWN.
+ * @param t The byte to widen.
+ * @return The tribool encoded by t.
+ */
+tribool fossil_type_tribool8_to(tribool8 t);
+
+/**
+ * @brief Narrows an array of tribools to one byte each. Buffers must not overlap.
+ * @param dst Output array with room for count bytes.
+ * @param src Array of count tribools.
+ * @param count Number of values to convert.
+ */
+void fossil_type_tribool_narrow(tribool8 *dst, const tribool *src, size_t count);
+
+/**
+ * @brief Widens an array of one-byte tribools. Buffers must not overlap.
+ * @param dst Output array with room for count tribools.
+ * @param src Array of count bytes.
+ * @param count Number of values to convert.
+ */
+void fossil_type_tribool_widen(tribool *dst, const tribool8 *src, size_t count);
+
 /* ======================================================
  * Constructors
  * ====================================================== */
@@ -115,16 +162,312 @@ tribool fossil_type_tribool_or (tribool a, tribool b);
  */
 tribool fossil_type_tribool_not(tribool t);
 
+/* ======================================================
+ * Derived Connectives
+ *
+ * Kleene connectives treat UNKNOWN as "could be either":
+ * XOR and EQUIV are UNKNOWN whenever an operand is, and
+ * IMPLIES is (NOT a) OR b. The Lukasiewicz variants differ
+ * only when both operands are UNKNOWN: U -> U and U <-> U
+ * are TRUE, and U xor U is FALSE.
+ *
+ * consensus and merge work in the knowledge ordering:
+ * consensus keeps what both sides agree on (UNKNOWN where
+ * they differ); merge combines what either side knows,
+ * with TRUE against FALSE giving UNKNOWN.
+ * ====================================================== */
+
+/**
+ * @brief Kleene exclusive OR.
+ * @param a The first operand.
+ * @param b The second operand.
+ * @return UNKNOWN if either is UNKNOWN, else TRUE when they differ.
+ */
+tribool fossil_type_tribool_xor(tribool a, tribool b);
+
+/**
+ * @brief Kleene implication, (NOT a) OR b.
+ * @param a The antecedent.
+ * @param b The consequent.
+ * @return The implication.
+ */
+tribool fossil_type_tribool_implies(tribool a, tribool b);
+
+/**
+ * @brief Kleene equivalence.
+ * @param a The first operand.
+ * @param b The second operand.
+ * @return UNKNOWN if either is UNKNOWN, else TRUE when they are equal.
+ */
+tribool fossil_type_tribool_equiv(tribool a, tribool b);
+
+/**
+ * @brief Lukasiewicz exclusive OR, NOT luk_equiv(a, b).
+ * @param a The first operand.
+ * @param b The second operand.
+ * @return As fossil_type_tribool_xor, except UNKNOWN xor UNKNOWN is FALSE.
+ */
+tribool fossil_type_tribool_luk_xor(tribool a, tribool b);
+
+/**
+ * @brief Lukasiewicz implication.
+ * @param a The antecedent.
+ * @param b The consequent.
+ * @return As fossil_type_tribool_implies, except UNKNOWN -> UNKNOWN is TRUE.
+ */
+tribool fossil_type_tribool_luk_implies(tribool a, tribool b);
+
+/**
+ * @brief Lukasiewicz equivalence.
+ * @param a The first operand.
+ * @param b The second operand.
+ * @return As fossil_type_tribool_equiv, except UNKNOWN <-> UNKNOWN is TRUE.
+ */
+tribool fossil_type_tribool_luk_equiv(tribool a, tribool b);
+
+/**
+ * @brief Knowledge-ordering meet: the value both operands agree on.
+ * @param a The first operand.
+ * @param b The second operand.
+ * @return a if a equals b, else UNKNOWN.
+ */
+tribool fossil_type_tribool_consensus(tribool a, tribool b);
+
+/**
+ * @brief Knowledge-ordering merge: what either operand knows.
+ * @param a The first operand.
+ * @param b The second operand.
+ * @return The known operand if the other is UNKNOWN, a if they agree, else UNKNOWN.
+ */
+tribool fossil_type_tribool_merge(tribool a, tribool b);
+
+/**
+ * @brief Kleene "at least k of n are TRUE".
+ * @param values Array of tribools.
+ * @param count Number of values.
+ * @param k Required number of TRUE values; k == 0 always yields TRUE.
+ * @return TRUE if at least k are TRUE, FALSE if even counting every UNKNOWN
+ *         as TRUE falls short of k, else UNKNOWN.
+ */
+tribool fossil_type_tribool_threshold(const tribool *values, size_t count, size_t k);
+
+/**
+ * @brief Kleene strict majority: threshold with k = count / 2 + 1.
+ * @param values Array of tribools.
+ * @param count Number of values; an empty array yields FALSE.
+ * @return The majority vote.
+ */
+tribool fossil_type_tribool_majority(const tribool *values, size_t count);
+
+/* ======================================================
+ * Reductions
+ *
+ * Bulk queries over plain tribool arrays. Values other
+ * than TRUE/FALSE are treated as UNKNOWN, so the three
+ * counts always add up to count. all/any stop at the
+ * first decisive value.
+ * ====================================================== */
+
+/** Returned by the find functions when nothing matches. */
+#define FOSSIL_TYPE_TRIBOOL_NPOS ((size_t)-1)
+
+/**
+ * @brief Kleene AND over an array: FALSE if any is FALSE, else UNKNOWN if any is UNKNOWN.
+ * @param values Array of tribools.
+ * @param count Number of values; an empty array yields TRUE.
+ * @return The combined tribool.
+ */
+tribool fossil_type_tribool_all(const tribool *values, size_t count);
+
+/**
+ * @brief Kleene OR over an array: TRUE if any is TRUE, else UNKNOWN if any is UNKNOWN.
+ * @param values Array of tribools.
+ * @param count Number of values; an empty array yields FALSE.
+ * @return The combined tribool.
+ */
+tribool fossil_type_tribool_any(const tribool *values, size_t count);
+
+/**
+ * @brief Negated Kleene OR over an array, i.e. NOT any.
+ * @param values Array of tribools.
+ * @param count Number of values; an empty array yields TRUE.
+ * @return The combined tribool.
+ */
+tribool fossil_type_tribool_none(const tribool *values, size_t count);
+
+/**
+ * @brief Counts the TRUE values in an array.
+ * @param values Array of tribools.
+ * @param count Number of values.
+ * @return Number of TRUE values.
+ */
+size_t fossil_type_tribool_count_true(const tribool *values, size_t count);
+
+/**
+ * @brief Counts the FALSE values in an array.
+ * @param values Array of tribools.
+ * @param count Number of values.
+ * @return Number of FALSE values.
+ */
+size_t fossil_type_tribool_count_false(const tribool *values, size_t count);
+
+/**
+ * @brief Counts the UNKNOWN values in an array.
+ * @param values Array of tribools.
+ * @param count Number of values.
+ * @return Number of UNKNOWN values.
+ */
+size_t fossil_type_tribool_count_unknown(const tribool *values, size_t count);
+
+/**
+ * @brief Finds the first UNKNOWN value in an array.
+ * @param values Array of tribools.
+ * @param count Number of values.
+ * @return Index of the first UNKNOWN, or FOSSIL_TYPE_TRIBOOL_NPOS.
+ */
+size_t fossil_type_tribool_find_first_unknown(const tribool *values, size_t count);
+
 #ifdef __cplusplus
 }
 #endif
 
+/* ======================================================
+ * Inline Engine
+ *
+ * Header-only versions of the scalar API above. They are
+ * static inline in C and constexpr in C++, so loops over
+ * them can be folded and auto-vectorized instead of going
+ * through a call per element. The exported functions are
+ * kept for ABI and forward to these.
+ *
+ * The binary operators look the result up in a 2-bit
+ * packed truth table indexed by (a << 2) | b; inputs are
+ * first clamped so anything other than TRUE/FALSE acts
+ * as UNKNOWN.
+ * ====================================================== */
+
+#ifdef __cplusplus
+#  define FOSSIL_TYPE_TRIBOOL_INLINE constexpr inline
+#else
+#  define FOSSIL_TYPE_TRIBOOL_INLINE static inline
+#endif
+
+/** Kleene AND truth table, entry (a << 2) | b at bits 2 * entry. */
+#define FOSSIL_TYPE_TRIBOOL_AND_TABLE 0x00282400u
+
+/** Kleene OR truth table, same layout as the AND table. */
+#define FOSSIL_TYPE_TRIBOOL_OR_TABLE  0x00261524u
+
+/** Kleene NOT table, entry t at bits 2 * t. */
+#define FOSSIL_TYPE_TRIBOOL_NOT_TABLE 0x00000021u
+
+/** Derived connective tables, same layout as the AND table. */
+#define FOSSIL_TYPE_TRIBOOL_XOR_TABLE         0x002A2124u
+#define FOSSIL_TYPE_TRIBOOL_IMPLIES_TABLE     0x00262415u
+#define FOSSIL_TYPE_TRIBOOL_EQUIV_TABLE       0x002A2421u
+#define FOSSIL_TYPE_TRIBOOL_LUK_XOR_TABLE     0x000A2124u
+#define FOSSIL_TYPE_TRIBOOL_LUK_IMPLIES_TABLE 0x00162415u
+#define FOSSIL_TYPE_TRIBOOL_LUK_EQUIV_TABLE   0x001A2421u
+#define FOSSIL_TYPE_TRIBOOL_CONSENSUS_TABLE   0x002A2628u
+#define FOSSIL_TYPE_TRIBOOL_MERGE_TABLE       0x00241608u
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_make_true(void) {
+    return FOSSIL_TYPE_TRIBOOL_TRUE;
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_make_false(void) {
+    return FOSSIL_TYPE_TRIBOOL_FALSE;
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_make_unknown(void) {
+    return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE int fossil_type_tribool_inline_is_true(tribool t) {
+    return t == FOSSIL_TYPE_TRIBOOL_TRUE;
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE int fossil_type_tribool_inline_is_false(tribool t) {
+    return t == FOSSIL_TYPE_TRIBOOL_FALSE;
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE int fossil_type_tribool_inline_is_unknown(tribool t) {
+    return t == FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+}
+
+/* Clamps t into 0..2 (an unsigned min, which vectorizes). */
+FOSSIL_TYPE_TRIBOOL_INLINE unsigned fossil_type_tribool_inline_index(tribool t) {
+    return (unsigned)t < 2u ? (unsigned)t : 2u;
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_and(tribool a, tribool b) {
+    unsigned i = (fossil_type_tribool_inline_index(a) << 2) | fossil_type_tribool_inline_index(b);
+    return (tribool)((FOSSIL_TYPE_TRIBOOL_AND_TABLE >> (i * 2u)) & 3u);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_or(tribool a, tribool b) {
+    unsigned i = (fossil_type_tribool_inline_index(a) << 2) | fossil_type_tribool_inline_index(b);
+    return (tribool)((FOSSIL_TYPE_TRIBOOL_OR_TABLE >> (i * 2u)) & 3u);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_not(tribool t) {
+    return (tribool)((FOSSIL_TYPE_TRIBOOL_NOT_TABLE >> (fossil_type_tribool_inline_index(t) * 2u)) & 3u);
+}
+
+/* Looks (a, b) up in any of the 2-bit binary truth tables above. */
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_lookup(unsigned table, tribool a, tribool b) {
+    unsigned i = (fossil_type_tribool_inline_index(a) << 2) | fossil_type_tribool_inline_index(b);
+    return (tribool)((table >> (i * 2u)) & 3u);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_xor(tribool a, tribool b) {
+    return fossil_type_tribool_inline_lookup(FOSSIL_TYPE_TRIBOOL_XOR_TABLE, a, b);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_implies(tribool a, tribool b) {
+    return fossil_type_tribool_inline_lookup(FOSSIL_TYPE_TRIBOOL_IMPLIES_TABLE, a, b);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_equiv(tribool a, tribool b) {
+    return fossil_type_tribool_inline_lookup(FOSSIL_TYPE_TRIBOOL_EQUIV_TABLE, a, b);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_luk_xor(tribool a, tribool b) {
+    return fossil_type_tribool_inline_lookup(FOSSIL_TYPE_TRIBOOL_LUK_XOR_TABLE, a, b);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_luk_implies(tribool a, tribool b) {
+    return fossil_type_tribool_inline_lookup(FOSSIL_TYPE_TRIBOOL_LUK_IMPLIES_TABLE, a, b);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_luk_equiv(tribool a, tribool b) {
+    return fossil_type_tribool_inline_lookup(FOSSIL_TYPE_TRIBOOL_LUK_EQUIV_TABLE, a, b);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_consensus(tribool a, tribool b) {
+    return fossil_type_tribool_inline_lookup(FOSSIL_TYPE_TRIBOOL_CONSENSUS_TABLE, a, b);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool_inline_merge(tribool a, tribool b) {
+    return fossil_type_tribool_inline_lookup(FOSSIL_TYPE_TRIBOOL_MERGE_TABLE, a, b);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool8 fossil_type_tribool8_inline_from(tribool t) {
+    return (tribool8)fossil_type_tribool_inline_index(t);
+}
+
+FOSSIL_TYPE_TRIBOOL_INLINE tribool fossil_type_tribool8_inline_to(tribool8 t) {
+    return (tribool)(t < 2u ? t : 2u);
+}
+
 
 /* ======================================================
  * C++ Wrapper
  * ====================================================== */
 #ifdef __cplusplus
 
+#include <span>
+
 namespace fossil::type {
 
 class Tribool {
@@ -134,38 +477,49 @@ public:
     /**
      * @brief Default constructor. Initializes the Tribool to UNKNOWN.
      */
-    Tribool() : value(fossil_type_tribool_make_unknown()) {}
+    constexpr Tribool() : value(fossil_type_tribool_inline_make_unknown()) {}
 
     /**
      * @brief Constructs a Tribool from a given tribool value.
      * @param v The tribool value to initialize with.
      */
-    explicit Tribool(tribool v) : value(v) {}
+    constexpr explicit Tribool(tribool v) : value(v) {}
+
+    /**
+     * @brief Constructs a Tribool from its one-byte storage form.
+     * @param v The stored byte; anything but 0/1 reads as UNKNOWN.
+     */
+    constexpr explicit Tribool(tribool8 v) : value(fossil_type_tribool8_inline_to(v)) {}
+
+    /**
+     * @brief Returns the one-byte storage form of this value.
+     */
+    constexpr tribool8 to_storage() const { return fossil_type_tribool8_inline_from(value); }
 
     /**
      * @brief Checks if the Tribool is TRUE.
      * @return true if the value is TRUE, false otherwise.
      */
-    bool is_true() const    { return fossil_type_tribool_is_true(value); }
+    constexpr bool is_true() const    { return fossil_type_tribool_inline_is_true(value); }
 
     /**
      * @brief Checks if the Tribool is FALSE.
      * @return true if the value is FALSE, false otherwise.
      */
-    bool is_false() const   { return fossil_type_tribool_is_false(value); }
+    constexpr bool is_false() const   { return fossil_type_tribool_inline_is_false(value); }
 
     /**
      * @brief Checks if the Tribool is UNKNOWN.
      * @return true if the value is UNKNOWN, false otherwise.
      */
-    bool is_unknown() const { return fossil_type_tribool_is_unknown(value); }
+    constexpr bool is_unknown() const { return fossil_type_tribool_inline_is_unknown(value); }
 
     /**
      * @brief Logical NOT operator for Tribool.
      * @return A new Tribool representing the logical NOT of this value.
      */
-    Tribool operator!() const {
-        return Tribool(fossil_type_tribool_not(value));
+    constexpr Tribool operator!() const {
+        return Tribool(fossil_type_tribool_inline_not(value));
     }
 
     /**
@@ -173,8 +527,8 @@ public:
      * @param rhs The right-hand side Tribool operand.
      * @return A new Tribool representing the logical AND of this and rhs.
      */
-    Tribool operator&&(const Tribool& rhs) const {
-        return Tribool(fossil_type_tribool_and(value, rhs.value));
+    constexpr Tribool operator&&(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_and(value, rhs.value));
     }
 
     /**
@@ -182,13 +536,182 @@ public:
      * @param rhs The right-hand side Tribool operand.
      * @return A new Tribool representing the logical OR of this and rhs.
      */
-    Tribool operator||(const Tribool& rhs) const {
-        return Tribool(fossil_type_tribool_or(value, rhs.value));
+    constexpr Tribool operator||(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_or(value, rhs.value));
+    }
+
+    /**
+     * @brief Kleene exclusive OR.
+     */
+    constexpr Tribool operator^(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_xor(value, rhs.value));
+    }
+
+    /**
+     * @brief Kleene implication, this -> rhs.
+     */
+    constexpr Tribool implies(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_implies(value, rhs.value));
+    }
+
+    /**
+     * @brief Kleene equivalence.
+     */
+    constexpr Tribool equiv(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_equiv(value, rhs.value));
+    }
+
+    /**
+     * @brief Lukasiewicz exclusive OR.
+     */
+    constexpr Tribool luk_xor(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_luk_xor(value, rhs.value));
+    }
+
+    /**
+     * @brief Lukasiewicz implication, this -> rhs.
+     */
+    constexpr Tribool luk_implies(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_luk_implies(value, rhs.value));
+    }
+
+    /**
+     * @brief Lukasiewicz equivalence.
+     */
+    constexpr Tribool luk_equiv(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_luk_equiv(value, rhs.value));
+    }
+
+    /**
+     * @brief The value both sides agree on, else UNKNOWN.
+     */
+    constexpr Tribool consensus(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_consensus(value, rhs.value));
+    }
+
+    /**
+     * @brief What either side knows; TRUE against FALSE gives UNKNOWN.
+     */
+    constexpr Tribool merge(const Tribool& rhs) const {
+        return Tribool(fossil_type_tribool_inline_merge(value, rhs.value));
+    }
+
+    constexpr operator tribool() const { return value; }
+
+    /**
+     * @brief Kleene AND over a span of tribools.
+     * @param values The values to combine; empty yields TRUE.
+     * @return FALSE if any is FALSE, else UNKNOWN if any is UNKNOWN, else TRUE.
+     */
+    static Tribool all(std::span<const tribool> values) {
+        return Tribool(fossil_type_tribool_all(values.data(), values.size()));
+    }
+
+    /**
+     * @brief Kleene OR over a span of tribools.
+     * @param values The values to combine; empty yields FALSE.
+     * @return TRUE if any is TRUE, else UNKNOWN if any is UNKNOWN, else FALSE.
+     */
+    static Tribool any(std::span<const tribool> values) {
+        return Tribool(fossil_type_tribool_any(values.data(), values.size()));
+    }
+
+    /**
+     * @brief Negated Kleene OR over a span of tribools.
+     * @param values The values to combine; empty yields TRUE.
+     * @return NOT any(values).
+     */
+    static Tribool none(std::span<const tribool> values) {
+        return Tribool(fossil_type_tribool_none(values.data(), values.size()));
+    }
+
+    /**
+     * @brief Counts the TRUE values in a span.
+     */
+    static size_t count_true(std::span<const tribool> values) {
+        return fossil_type_tribool_count_true(values.data(), values.size());
+    }
+
+    /**
+     * @brief Counts the FALSE values in a span.
+     */
+    static size_t count_false(std::span<const tribool> values) {
+        return fossil_type_tribool_count_false(values.data(), values.size());
+    }
+
+    /**
+     * @brief Counts the UNKNOWN values in a span.
+     */
+    static size_t count_unknown(std::span<const tribool> values) {
+        return fossil_type_tribool_count_unknown(values.data(), values.size());
+    }
+
+    /**
+     * @brief Finds the first UNKNOWN value in a span.
+     * @return Its index, or FOSSIL_TYPE_TRIBOOL_NPOS.
+     */
+    static size_t find_first_unknown(std::span<const tribool> values) {
+        return fossil_type_tribool_find_first_unknown(values.data(), values.size());
+    }
+
+    /**
+     * @brief Kleene "at least k of the values are TRUE".
+     */
+    static Tribool threshold(std::span<const tribool> values, size_t k) {
+        return Tribool(fossil_type_tribool_threshold(values.data(), values.size(), k));
+    }
+
+    /**
+     * @brief Kleene strict majority of the values.
+     */
+    static Tribool majority(std::span<const tribool> values) {
+        return Tribool(fossil_type_tribool_majority(values.data(), values.size()));
     }
 
-    operator tribool() const { return value; }
+    /**
+     * @brief Overloads of the reductions above for spans of Tribool.
+     */
+    static Tribool all(std::span<const Tribool> values) { return all(raw_span(values)); }
+    static Tribool any(std::span<const Tribool> values) { return any(raw_span(values)); }
+    static Tribool none(std::span<const Tribool> values) { return none(raw_span(values)); }
+    static size_t count_true(std::span<const Tribool> values) { return count_true(raw_span(values)); }
+    static size_t count_false(std::span<const Tribool> values) { return count_false(raw_span(values)); }
+    static size_t count_unknown(std::span<const Tribool> values) { return count_unknown(raw_span(values)); }
+    static size_t find_first_unknown(std::span<const Tribool> values) {
+        return find_first_unknown(raw_span(values));
+    }
+    static Tribool threshold(std::span<const Tribool> values, size_t k) { return threshold(raw_span(values), k); }
+    static Tribool majority(std::span<const Tribool> values) { return majority(raw_span(values)); }
+
+    /**
+     * @brief Narrows a span of Tribool into one-byte storage.
+     * @return false (and writes nothing) if dst is shorter than src.
+     */
+    static bool narrow(std::span<tribool8> dst, std::span<const Tribool> src) {
+        if (dst.size() < src.size()) return false;
+        fossil_type_tribool_narrow(dst.data(), raw_span(src).data(), src.size());
+        return true;
+    }
+
+    /**
+     * @brief Widens one-byte storage into a span of Tribool.
+     * @return false (and writes nothing) if dst is shorter than src.
+     */
+    static bool widen(std::span<Tribool> dst, std::span<const tribool8> src) {
+        if (dst.size() < src.size()) return false;
+        fossil_type_tribool_widen(reinterpret_cast<tribool*>(dst.data()), src.data(), src.size());
+        return true;
+    }
+
+private:
+    /* Tribool is a single tribool member, so a span of either views the same bytes. */
+    static std::span<const tribool> raw_span(std::span<const Tribool> values) {
+        return { reinterpret_cast<const tribool*>(values.data()), values.size() };
+    }
 };
 
+static_assert(sizeof(Tribool) == sizeof(tribool), "Tribool must wrap exactly one tribool");
+
 } // namespace fossil::type
 
 #endif
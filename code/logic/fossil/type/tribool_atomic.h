@@ -0,0 +1,319 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_ATOMIC_H
+#define FOSSIL_TYPE_TRIBOOL_ATOMIC_H
+
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+#include <atomic>
+#endif
+
+/* ======================================================
+ * Atomic Storage
+ *
+ * C builds with C11 atomics declare shared words _Atomic.
+ * C++ and MSVC C see a plain integer of the same size and
+ * alignment; they only pass pointers back to the library,
+ * which uses the matching primitives for the compiler.
+ * ====================================================== */
+
+#if !defined(__cplusplus) && !defined(__STDC_NO_ATOMICS__) && \
+    !(defined(_MSC_VER) && !defined(__clang__))
+#  define FOSSIL_TYPE_HAVE_C11_ATOMICS 1
+#  define FOSSIL_TYPE_ATOMIC(T) _Atomic(T)
+#else
+#  define FOSSIL_TYPE_ATOMIC(T) volatile T
+#endif
+
+typedef FOSSIL_TYPE_ATOMIC(uint32_t) fossil_type_atomic_u32;
+typedef FOSSIL_TYPE_ATOMIC(uint64_t) fossil_type_atomic_u64;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Definition
+ *
+ * A tribool that starts UNKNOWN and may be resolved to
+ * TRUE or FALSE exactly once, by whichever thread wins a
+ * compare-and-swap. Readers never block or retry. The
+ * state uses the packed lane codes (00 FALSE, 01 TRUE,
+ * 10 UNKNOWN) plus 11 for UNKNOWN with sleeping waiters,
+ * so a resolve only enters the kernel when someone waits.
+ * ====================================================== */
+
+typedef struct fossil_type_atomic_tribool {
+    fossil_type_atomic_u32 state;
+} fossil_type_atomic_tribool;
+
+typedef fossil_type_atomic_tribool atomic_tribool;
+
+/** Static initializer for an unresolved atomic tribool. */
+#define FOSSIL_TYPE_ATOMIC_TRIBOOL_INIT { FOSSIL_TYPE_TRIBOOL_UNKNOWN }
+
+/**
+ * 32 atomic tribools per 64-bit word, using the packed
+ * vector lane layout. Resolving a lane only retries when
+ * another lane of the same word changes concurrently.
+ */
+typedef struct fossil_type_atomic_tribool_array {
+    fossil_type_atomic_u64 *words;
+    size_t length;
+} fossil_type_atomic_tribool_array;
+
+typedef fossil_type_atomic_tribool_array atomic_tribool_array;
+
+/* ======================================================
+ * Single Value
+ *
+ * On Linux waiters sleep on a futex; elsewhere they yield
+ * the processor between checks.
+ * ====================================================== */
+
+/**
+ * @brief Sets the value without synchronization, before the object is shared.
+ * @param a The atomic tribool to initialize.
+ * @param t The initial value; values other than TRUE/FALSE store UNKNOWN.
+ */
+void fossil_type_atomic_tribool_init(atomic_tribool *a, tribool t);
+
+/**
+ * @brief Reads the current value with acquire ordering. Never blocks.
+ * @param a The atomic tribool; NULL reads as UNKNOWN.
+ * @return The current value.
+ */
+tribool fossil_type_atomic_tribool_load(const atomic_tribool *a);
+
+/**
+ * @brief Resolves an UNKNOWN value to TRUE or FALSE, once.
+ * @param a The atomic tribool.
+ * @param value TRUE or FALSE; anything else never resolves.
+ * @param observed Optional; receives the value held after the call, i.e. value on
+ *        success or the earlier winner's value otherwise.
+ * @return 1 if this call performed the transition, 0 otherwise.
+ */
+int fossil_type_atomic_tribool_try_resolve(atomic_tribool *a, tribool value, tribool *observed);
+
+/**
+ * @brief Blocks until the value is resolved.
+ * @param a The atomic tribool; NULL returns UNKNOWN at once.
+ * @return The resolved value.
+ */
+tribool fossil_type_atomic_tribool_wait(atomic_tribool *a);
+
+/* ======================================================
+ * Packed Array
+ * ====================================================== */
+
+/**
+ * @brief Allocates an array with every slot UNKNOWN.
+ * @param arr The array to initialize.
+ * @param length Number of slots.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_atomic_tribool_array_init(atomic_tribool_array *arr, size_t length);
+
+/**
+ * @brief Releases the array storage. Safe on a zeroed or freed array.
+ * @param arr The array to free.
+ */
+void fossil_type_atomic_tribool_array_free(atomic_tribool_array *arr);
+
+/**
+ * @brief Returns the number of slots.
+ * @param arr The array; NULL has length 0.
+ * @return The slot count.
+ */
+size_t fossil_type_atomic_tribool_array_length(const atomic_tribool_array *arr);
+
+/**
+ * @brief Reads one slot with acquire ordering. Never blocks.
+ * @param arr The array.
+ * @param index Slot index; UNKNOWN is returned when out of range.
+ * @return The slot value.
+ */
+tribool fossil_type_atomic_tribool_array_load(const atomic_tribool_array *arr, size_t index);
+
+/**
+ * @brief Resolves an UNKNOWN slot to TRUE or FALSE, once.
+ * @param arr The array.
+ * @param index Slot index; out of range never resolves.
+ * @param value TRUE or FALSE; anything else never resolves.
+ * @param observed Optional; receives the slot value held after the call.
+ * @return 1 if this call performed the transition, 0 otherwise.
+ */
+int fossil_type_atomic_tribool_array_try_resolve(atomic_tribool_array *arr, size_t index,
+                                                 tribool value, tribool *observed);
+
+/**
+ * @brief Blocks until a slot is resolved.
+ * @param arr The array.
+ * @param index Slot index; out of range returns UNKNOWN at once.
+ * @return The resolved value.
+ */
+tribool fossil_type_atomic_tribool_array_wait(atomic_tribool_array *arr, size_t index);
+
+/**
+ * @brief Copies the slots into a packed vector, resizing it.
+ *        Each word is read atomically; words are not read as one snapshot.
+ * @param arr The array to copy.
+ * @param dst The destination vector.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_atomic_tribool_array_snapshot(const atomic_tribool_array *arr, tribool_vec *dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+/**
+ * A resolve-once tribool on std::atomic. Waiting uses
+ * std::atomic::wait, so no mutex is involved.
+ */
+class AtomicTribool {
+    std::atomic<tribool8> s;
+
+public:
+    /**
+     * @brief Default constructor. The value starts UNKNOWN.
+     */
+    AtomicTribool() noexcept : s(fossil_type_tribool8_inline_from(FOSSIL_TYPE_TRIBOOL_UNKNOWN)) {}
+
+    /**
+     * @brief Constructs with an initial value.
+     */
+    explicit AtomicTribool(Tribool t) noexcept : s(t.to_storage()) {}
+
+    AtomicTribool(const AtomicTribool&) = delete;
+    AtomicTribool& operator=(const AtomicTribool&) = delete;
+
+    /**
+     * @brief Reads the current value. Never blocks.
+     */
+    Tribool load() const noexcept { return Tribool(s.load(std::memory_order_acquire)); }
+
+    /**
+     * @brief Returns true once the value is TRUE or FALSE.
+     */
+    bool is_resolved() const noexcept { return !load().is_unknown(); }
+
+    /**
+     * @brief Resolves an UNKNOWN value once and wakes waiters.
+     * @param value TRUE or FALSE; anything else never resolves.
+     * @param observed Optional; receives the value held after the call.
+     * @return true if this call performed the transition.
+     */
+    bool try_resolve(Tribool value, Tribool *observed = nullptr) noexcept {
+        tribool8 expected = fossil_type_tribool8_inline_from(FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+        bool won = !value.is_unknown() &&
+                   s.compare_exchange_strong(expected, value.to_storage(),
+                                             std::memory_order_acq_rel, std::memory_order_acquire);
+        if (won) s.notify_all();
+        if (observed) *observed = won ? value : Tribool(expected);
+        return won;
+    }
+
+    /**
+     * @brief Blocks until the value is resolved and returns it.
+     */
+    Tribool wait() const noexcept {
+        const tribool8 unknown = fossil_type_tribool8_inline_from(FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+        tribool8 cur = s.load(std::memory_order_acquire);
+        while (cur == unknown) {
+            s.wait(unknown, std::memory_order_acquire);
+            cur = s.load(std::memory_order_acquire);
+        }
+        return Tribool(cur);
+    }
+};
+
+class AtomicTriboolArray {
+    atomic_tribool_array a;
+
+public:
+    /**
+     * @brief Constructs an array of length UNKNOWN slots; empty on allocation failure.
+     */
+    explicit AtomicTriboolArray(size_t length = 0) : a{nullptr, 0} {
+        fossil_type_atomic_tribool_array_init(&a, length);
+    }
+
+    AtomicTriboolArray(const AtomicTriboolArray&) = delete;
+    AtomicTriboolArray& operator=(const AtomicTriboolArray&) = delete;
+
+    ~AtomicTriboolArray() { fossil_type_atomic_tribool_array_free(&a); }
+
+    /**
+     * @brief Returns the number of slots.
+     */
+    size_t size() const { return fossil_type_atomic_tribool_array_length(&a); }
+
+    /**
+     * @brief Reads one slot; UNKNOWN when out of range.
+     */
+    Tribool load(size_t index) const { return Tribool(fossil_type_atomic_tribool_array_load(&a, index)); }
+
+    /**
+     * @brief Resolves an UNKNOWN slot once.
+     * @return true if this call performed the transition.
+     */
+    bool try_resolve(size_t index, Tribool value, Tribool *observed = nullptr) {
+        tribool seen = FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+        bool won = fossil_type_atomic_tribool_array_try_resolve(&a, index, value, &seen) == 1;
+        if (observed) *observed = Tribool(seen);
+        return won;
+    }
+
+    /**
+     * @brief Blocks until a slot is resolved; UNKNOWN at once when out of range.
+     */
+    Tribool wait(size_t index) { return Tribool(fossil_type_atomic_tribool_array_wait(&a, index)); }
+
+    /**
+     * @brief Copies the slots into a packed vector.
+     */
+    TriboolVec snapshot() const {
+        TriboolVec out;
+        fossil_type_atomic_tribool_array_snapshot(&a, out.raw());
+        return out;
+    }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
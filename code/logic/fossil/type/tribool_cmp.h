@@ -0,0 +1,279 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_CMP_H
+#define FOSSIL_TYPE_TRIBOOL_CMP_H
+
+#include "types.h"
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Nullable Columns
+ *
+ * A nullable column is an array of values plus an optional
+ * validity bitmap: bit (i % 64) of word i / 64 is set when
+ * row i holds a value and clear when it is NULL. A NULL
+ * bitmap pointer means every row is valid.
+ *
+ * Comparisons follow SQL three-valued logic: any NULL
+ * operand yields UNKNOWN. Floating-point NaN is a value,
+ * not NULL, and compares per IEEE 754 (only != is TRUE).
+ * Every kernel resizes dst to count and returns 0, or -1
+ * on invalid arguments or allocation failure.
+ * ====================================================== */
+
+typedef enum fossil_type_cmp_op {
+    FOSSIL_TYPE_CMP_LT = 0,  /**< a <  b */
+    FOSSIL_TYPE_CMP_LE,      /**< a <= b */
+    FOSSIL_TYPE_CMP_EQ,      /**< a == b */
+    FOSSIL_TYPE_CMP_NE,      /**< a != b */
+    FOSSIL_TYPE_CMP_GT,      /**< a >  b */
+    FOSSIL_TYPE_CMP_GE       /**< a >= b */
+} fossil_type_cmp_op;
+
+/* ======================================================
+ * Column op Column
+ * ====================================================== */
+
+/**
+ * @brief Row-wise a[i] op b[i] over two nullable columns.
+ * @param dst Output vector, resized to count.
+ * @param op The comparison.
+ * @param a Left values.
+ * @param a_valid Left validity bitmap, or NULL when all rows are valid.
+ * @param b Right values.
+ * @param b_valid Right validity bitmap, or NULL when all rows are valid.
+ * @param count Number of rows.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_cmp_i32(tribool_vec *dst, fossil_type_cmp_op op,
+                                const i32 *a, const b64 *a_valid,
+                                const i32 *b, const b64 *b_valid, size_t count);
+
+/** @brief i64 variant of fossil_type_tribool_cmp_i32. */
+int fossil_type_tribool_cmp_i64(tribool_vec *dst, fossil_type_cmp_op op,
+                                const i64 *a, const b64 *a_valid,
+                                const i64 *b, const b64 *b_valid, size_t count);
+
+/** @brief f32 variant of fossil_type_tribool_cmp_i32. */
+int fossil_type_tribool_cmp_f32(tribool_vec *dst, fossil_type_cmp_op op,
+                                const f32 *a, const b64 *a_valid,
+                                const f32 *b, const b64 *b_valid, size_t count);
+
+/** @brief f64 variant of fossil_type_tribool_cmp_i32. */
+int fossil_type_tribool_cmp_f64(tribool_vec *dst, fossil_type_cmp_op op,
+                                const f64 *a, const b64 *a_valid,
+                                const f64 *b, const b64 *b_valid, size_t count);
+
+/* ======================================================
+ * Column op Constant
+ * ====================================================== */
+
+/**
+ * @brief Row-wise a[i] op value over a nullable column.
+ * @param dst Output vector, resized to count.
+ * @param op The comparison.
+ * @param a Column values.
+ * @param a_valid Validity bitmap, or NULL when all rows are valid.
+ * @param value The constant right operand.
+ * @param count Number of rows.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_cmp_i32_scalar(tribool_vec *dst, fossil_type_cmp_op op,
+                                       const i32 *a, const b64 *a_valid, i32 value, size_t count);
+
+/** @brief i64 variant of fossil_type_tribool_cmp_i32_scalar. */
+int fossil_type_tribool_cmp_i64_scalar(tribool_vec *dst, fossil_type_cmp_op op,
+                                       const i64 *a, const b64 *a_valid, i64 value, size_t count);
+
+/** @brief f32 variant of fossil_type_tribool_cmp_i32_scalar. */
+int fossil_type_tribool_cmp_f32_scalar(tribool_vec *dst, fossil_type_cmp_op op,
+                                       const f32 *a, const b64 *a_valid, f32 value, size_t count);
+
+/** @brief f64 variant of fossil_type_tribool_cmp_i32_scalar. */
+int fossil_type_tribool_cmp_f64_scalar(tribool_vec *dst, fossil_type_cmp_op op,
+                                       const f64 *a, const b64 *a_valid, f64 value, size_t count);
+
+/* ======================================================
+ * BETWEEN
+ * ====================================================== */
+
+/**
+ * @brief SQL a BETWEEN lo AND hi, i.e. lo <= a[i] AND a[i] <= hi.
+ * @param dst Output vector, resized to count.
+ * @param a Column values.
+ * @param a_valid Validity bitmap, or NULL when all rows are valid.
+ * @param lo Inclusive lower bound.
+ * @param hi Inclusive upper bound.
+ * @param count Number of rows.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_between_i32(tribool_vec *dst, const i32 *a, const b64 *a_valid,
+                                    i32 lo, i32 hi, size_t count);
+
+/** @brief i64 variant of fossil_type_tribool_between_i32. */
+int fossil_type_tribool_between_i64(tribool_vec *dst, const i64 *a, const b64 *a_valid,
+                                    i64 lo, i64 hi, size_t count);
+
+/** @brief f32 variant of fossil_type_tribool_between_i32. */
+int fossil_type_tribool_between_f32(tribool_vec *dst, const f32 *a, const b64 *a_valid,
+                                    f32 lo, f32 hi, size_t count);
+
+/** @brief f64 variant of fossil_type_tribool_between_i32. */
+int fossil_type_tribool_between_f64(tribool_vec *dst, const f64 *a, const b64 *a_valid,
+                                    f64 lo, f64 hi, size_t count);
+
+/* ======================================================
+ * IN
+ * ====================================================== */
+
+/**
+ * @brief SQL a IN (list): TRUE on a match, else UNKNOWN if the list holds
+ *        a NULL, else FALSE. NULL rows are UNKNOWN; an empty list is FALSE.
+ * @param dst Output vector, resized to count.
+ * @param a Column values.
+ * @param a_valid Validity bitmap, or NULL when all rows are valid.
+ * @param list The non-NULL list values.
+ * @param list_count Number of list values.
+ * @param list_has_null Non-zero if the list also contains NULL.
+ * @param count Number of rows.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_in_i32(tribool_vec *dst, const i32 *a, const b64 *a_valid,
+                               const i32 *list, size_t list_count, int list_has_null, size_t count);
+
+/** @brief i64 variant of fossil_type_tribool_in_i32. */
+int fossil_type_tribool_in_i64(tribool_vec *dst, const i64 *a, const b64 *a_valid,
+                               const i64 *list, size_t list_count, int list_has_null, size_t count);
+
+/** @brief f32 variant of fossil_type_tribool_in_i32. */
+int fossil_type_tribool_in_f32(tribool_vec *dst, const f32 *a, const b64 *a_valid,
+                               const f32 *list, size_t list_count, int list_has_null, size_t count);
+
+/** @brief f64 variant of fossil_type_tribool_in_i32. */
+int fossil_type_tribool_in_f64(tribool_vec *dst, const f64 *a, const b64 *a_valid,
+                               const f64 *list, size_t list_count, int list_has_null, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+#include <span>
+#include <type_traits>
+
+namespace fossil::type {
+
+/**
+ * @brief Value types with comparison kernels.
+ */
+template <typename T>
+concept CmpValue = std::is_same_v<T, i32> || std::is_same_v<T, i64> ||
+                   std::is_same_v<T, f32> || std::is_same_v<T, f64>;
+
+/**
+ * @brief Row-wise a[i] op b[i]. Mismatched sizes yield an empty vector.
+ */
+template <CmpValue T>
+TriboolVec compare(fossil_type_cmp_op op, std::span<const T> a, const b64 *a_valid,
+                   std::span<const T> b, const b64 *b_valid) {
+    TriboolVec out;
+    if (a.size() != b.size()) return out;
+    if constexpr (std::is_same_v<T, i32>)
+        fossil_type_tribool_cmp_i32(out.raw(), op, a.data(), a_valid, b.data(), b_valid, a.size());
+    else if constexpr (std::is_same_v<T, i64>)
+        fossil_type_tribool_cmp_i64(out.raw(), op, a.data(), a_valid, b.data(), b_valid, a.size());
+    else if constexpr (std::is_same_v<T, f32>)
+        fossil_type_tribool_cmp_f32(out.raw(), op, a.data(), a_valid, b.data(), b_valid, a.size());
+    else
+        fossil_type_tribool_cmp_f64(out.raw(), op, a.data(), a_valid, b.data(), b_valid, a.size());
+    return out;
+}
+
+/**
+ * @brief Row-wise a[i] op value.
+ */
+template <CmpValue T>
+TriboolVec compare(fossil_type_cmp_op op, std::span<const T> a, const b64 *a_valid, T value) {
+    TriboolVec out;
+    if constexpr (std::is_same_v<T, i32>)
+        fossil_type_tribool_cmp_i32_scalar(out.raw(), op, a.data(), a_valid, value, a.size());
+    else if constexpr (std::is_same_v<T, i64>)
+        fossil_type_tribool_cmp_i64_scalar(out.raw(), op, a.data(), a_valid, value, a.size());
+    else if constexpr (std::is_same_v<T, f32>)
+        fossil_type_tribool_cmp_f32_scalar(out.raw(), op, a.data(), a_valid, value, a.size());
+    else
+        fossil_type_tribool_cmp_f64_scalar(out.raw(), op, a.data(), a_valid, value, a.size());
+    return out;
+}
+
+/**
+ * @brief SQL a BETWEEN lo AND hi.
+ */
+template <CmpValue T>
+TriboolVec between(std::span<const T> a, const b64 *a_valid, T lo, T hi) {
+    TriboolVec out;
+    if constexpr (std::is_same_v<T, i32>)
+        fossil_type_tribool_between_i32(out.raw(), a.data(), a_valid, lo, hi, a.size());
+    else if constexpr (std::is_same_v<T, i64>)
+        fossil_type_tribool_between_i64(out.raw(), a.data(), a_valid, lo, hi, a.size());
+    else if constexpr (std::is_same_v<T, f32>)
+        fossil_type_tribool_between_f32(out.raw(), a.data(), a_valid, lo, hi, a.size());
+    else
+        fossil_type_tribool_between_f64(out.raw(), a.data(), a_valid, lo, hi, a.size());
+    return out;
+}
+
+/**
+ * @brief SQL a IN (list), with list_has_null standing for a NULL list entry.
+ */
+template <CmpValue T>
+TriboolVec in(std::span<const T> a, const b64 *a_valid, std::span<const T> list, bool list_has_null = false) {
+    TriboolVec out;
+    if constexpr (std::is_same_v<T, i32>)
+        fossil_type_tribool_in_i32(out.raw(), a.data(), a_valid, list.data(), list.size(), list_has_null, a.size());
+    else if constexpr (std::is_same_v<T, i64>)
+        fossil_type_tribool_in_i64(out.raw(), a.data(), a_valid, list.data(), list.size(), list_has_null, a.size());
+    else if constexpr (std::is_same_v<T, f32>)
+        fossil_type_tribool_in_f32(out.raw(), a.data(), a_valid, list.data(), list.size(), list_has_null, a.size());
+    else
+        fossil_type_tribool_in_f64(out.raw(), a.data(), a_valid, list.data(), list.size(), list_has_null, a.size());
+    return out;
+}
+
+} // namespace fossil::type
+
+#endif
+
+#endif
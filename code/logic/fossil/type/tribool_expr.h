@@ -0,0 +1,287 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_EXPR_H
+#define FOSSIL_TYPE_TRIBOOL_EXPR_H
+
+#include "types.h"
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+#include <span>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Definitions
+ *
+ * An expression is a DAG of nodes built bottom-up, so a
+ * node id is always larger than the ids of its operands.
+ * Building hash-conses nodes (common subexpressions share
+ * one id) and folds constants using the Kleene identities:
+ *     F and x = F    T and x = x    x and x = x
+ *     T or x  = T    F or x  = x    x or x  = x
+ *     not not x = x  x and (x or y) = x  x or (x and y) = x
+ * x and not x is not folded: it is UNKNOWN when x is.
+ * ====================================================== */
+
+typedef enum fossil_type_tribool_op {
+    FOSSIL_TYPE_TRIBOOL_OP_CONST = 0, /**< a holds the tribool value. */
+    FOSSIL_TYPE_TRIBOOL_OP_INPUT,     /**< a holds the input column index. */
+    FOSSIL_TYPE_TRIBOOL_OP_NOT,
+    FOSSIL_TYPE_TRIBOOL_OP_AND,
+    FOSSIL_TYPE_TRIBOOL_OP_OR,
+    FOSSIL_TYPE_TRIBOOL_OP_MOV        /**< Program only: copies operand a. */
+} fossil_type_tribool_op;
+
+/** Handle of an expression node. */
+typedef u32 fossil_type_tribool_expr_id;
+typedef fossil_type_tribool_expr_id tribool_expr_id;
+
+/** Returned by the builders on allocation failure or invalid operands; propagates. */
+#define FOSSIL_TYPE_TRIBOOL_EXPR_INVALID ((tribool_expr_id)0xFFFFFFFFu)
+
+typedef struct fossil_type_tribool_expr_node {
+    u32 op;  /**< A fossil_type_tribool_op. */
+    u32 a;   /**< First operand id, constant value or column index. */
+    u32 b;   /**< Second operand id for AND/OR. */
+} fossil_type_tribool_expr_node;
+
+typedef struct fossil_type_tribool_expr {
+    fossil_type_tribool_expr_node *nodes;
+    size_t count;       /**< Number of distinct nodes. */
+    size_t capacity;
+    u32 *index;         /**< Open-addressed hash of nodes for sharing. */
+    size_t index_size;  /**< Power of two, or 0 when empty. */
+} fossil_type_tribool_expr;
+
+typedef fossil_type_tribool_expr tribool_expr;
+
+/**
+ * Register bytecode. Operands name a scratch register, or
+ * an input column when FOSSIL_TYPE_TRIBOOL_PROGRAM_INPUT is
+ * set. The last instruction computes the result.
+ */
+#define FOSSIL_TYPE_TRIBOOL_PROGRAM_INPUT 0x80000000u
+
+typedef struct fossil_type_tribool_insn {
+    u32 op;   /**< CONST, NOT, AND, OR or MOV. */
+    u32 dst;  /**< Destination register. */
+    u32 a;    /**< Operand, or the constant value for CONST. */
+    u32 b;    /**< Second operand for AND/OR. */
+} fossil_type_tribool_insn;
+
+typedef struct fossil_type_tribool_program {
+    fossil_type_tribool_insn *code;
+    size_t length;     /**< Number of instructions. */
+    size_t registers;  /**< Scratch registers needed, after reuse. */
+    size_t inputs;     /**< One past the highest input column read. */
+} fossil_type_tribool_program;
+
+typedef fossil_type_tribool_program tribool_program;
+
+/* ======================================================
+ * Expression Builder
+ * ====================================================== */
+
+/**
+ * @brief Initializes an empty expression.
+ * @param e The expression to initialize.
+ */
+void fossil_type_tribool_expr_init(tribool_expr *e);
+
+/**
+ * @brief Releases all nodes. Safe on an initialized or freed expression.
+ * @param e The expression to free.
+ */
+void fossil_type_tribool_expr_free(tribool_expr *e);
+
+/**
+ * @brief Returns the number of distinct nodes built so far.
+ * @param e The expression; NULL has no nodes.
+ * @return The node count.
+ */
+size_t fossil_type_tribool_expr_count(const tribool_expr *e);
+
+/**
+ * @brief Adds a constant. Values other than TRUE/FALSE become UNKNOWN.
+ * @param e The expression.
+ * @param t The constant value.
+ * @return The node id, or FOSSIL_TYPE_TRIBOOL_EXPR_INVALID.
+ */
+tribool_expr_id fossil_type_tribool_expr_const(tribool_expr *e, tribool t);
+
+/**
+ * @brief Adds a reference to an input column.
+ * @param e The expression.
+ * @param column Column index, below FOSSIL_TYPE_TRIBOOL_PROGRAM_INPUT.
+ * @return The node id, or FOSSIL_TYPE_TRIBOOL_EXPR_INVALID.
+ */
+tribool_expr_id fossil_type_tribool_expr_input(tribool_expr *e, u32 column);
+
+/**
+ * @brief Adds a Kleene NOT.
+ * @param e The expression.
+ * @param a The operand id.
+ * @return The (possibly folded or shared) node id, or FOSSIL_TYPE_TRIBOOL_EXPR_INVALID.
+ */
+tribool_expr_id fossil_type_tribool_expr_not(tribool_expr *e, tribool_expr_id a);
+
+/**
+ * @brief Adds a Kleene AND.
+ * @param e The expression.
+ * @param a The first operand id.
+ * @param b The second operand id.
+ * @return The (possibly folded or shared) node id, or FOSSIL_TYPE_TRIBOOL_EXPR_INVALID.
+ */
+tribool_expr_id fossil_type_tribool_expr_and(tribool_expr *e, tribool_expr_id a, tribool_expr_id b);
+
+/**
+ * @brief Adds a Kleene OR.
+ * @param e The expression.
+ * @param a The first operand id.
+ * @param b The second operand id.
+ * @return The (possibly folded or shared) node id, or FOSSIL_TYPE_TRIBOOL_EXPR_INVALID.
+ */
+tribool_expr_id fossil_type_tribool_expr_or(tribool_expr *e, tribool_expr_id a, tribool_expr_id b);
+
+/* ======================================================
+ * Compiler and VM
+ *
+ * The VM runs the whole program over one block of rows
+ * at a time, so live registers stay cache resident and
+ * each instruction is one packed-word kernel call.
+ * ====================================================== */
+
+/**
+ * @brief Initializes an empty program.
+ * @param p The program to initialize.
+ */
+void fossil_type_tribool_program_init(tribool_program *p);
+
+/**
+ * @brief Releases the bytecode. Safe on an initialized or freed program.
+ * @param p The program to free.
+ */
+void fossil_type_tribool_program_free(tribool_program *p);
+
+/**
+ * @brief Compiles the nodes reachable from root, replacing any previous bytecode.
+ *        Registers are reused once their last reader has run.
+ * @param p The program to fill.
+ * @param e The expression.
+ * @param root The node whose value the program computes.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_program_compile(tribool_program *p, const tribool_expr *e, tribool_expr_id root);
+
+/**
+ * @brief Evaluates the program over packed input columns.
+ * @param p The compiled program.
+ * @param dst Resized to the input length; may be one of the inputs.
+ * @param inputs Columns of equal length; at least p->inputs of them.
+ * @param input_count Number of entries in inputs. With none, dst keeps its length.
+ * @return 0 on success, -1 on invalid arguments, length mismatch or allocation failure.
+ */
+int fossil_type_tribool_program_run(const tribool_program *p, tribool_vec *dst,
+                                    const tribool_vec *const *inputs, size_t input_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class TriboolExpr {
+    tribool_expr e;
+
+public:
+    using Id = tribool_expr_id;
+
+    TriboolExpr() { fossil_type_tribool_expr_init(&e); }
+    TriboolExpr(const TriboolExpr&) = delete;
+    TriboolExpr& operator=(const TriboolExpr&) = delete;
+    ~TriboolExpr() { fossil_type_tribool_expr_free(&e); }
+
+    /**
+     * @brief Returns the number of distinct nodes.
+     */
+    size_t size() const { return fossil_type_tribool_expr_count(&e); }
+
+    Id constant(Tribool t) { return fossil_type_tribool_expr_const(&e, t); }
+    Id input(u32 column) { return fossil_type_tribool_expr_input(&e, column); }
+    Id logical_not(Id a) { return fossil_type_tribool_expr_not(&e, a); }
+    Id logical_and(Id a, Id b) { return fossil_type_tribool_expr_and(&e, a, b); }
+    Id logical_or(Id a, Id b) { return fossil_type_tribool_expr_or(&e, a, b); }
+
+    const tribool_expr* raw() const { return &e; }
+};
+
+class TriboolProgram {
+    tribool_program p;
+
+public:
+    TriboolProgram() { fossil_type_tribool_program_init(&p); }
+    TriboolProgram(const TriboolProgram&) = delete;
+    TriboolProgram& operator=(const TriboolProgram&) = delete;
+    ~TriboolProgram() { fossil_type_tribool_program_free(&p); }
+
+    /**
+     * @brief Compiles the expression rooted at root.
+     * @return false on invalid root or allocation failure.
+     */
+    bool compile(const TriboolExpr& e, TriboolExpr::Id root) {
+        return fossil_type_tribool_program_compile(&p, e.raw(), root) == 0;
+    }
+
+    /**
+     * @brief Returns the number of bytecode instructions.
+     */
+    size_t size() const { return p.length; }
+
+    /**
+     * @brief Evaluates over the input columns; empty on mismatch.
+     */
+    TriboolVec run(std::span<const tribool_vec* const> inputs) const {
+        TriboolVec out;
+        if (fossil_type_tribool_program_run(&p, out.raw(), inputs.data(), inputs.size()) != 0) return TriboolVec();
+        return out;
+    }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
@@ -0,0 +1,254 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_GRAPH_H
+#define FOSSIL_TYPE_TRIBOOL_GRAPH_H
+
+#include "types.h"
+#include "tribool.h"
+#include "tribool_expr.h"
+
+#ifdef __cplusplus
+#include <span>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Definitions
+ *
+ * A network of derived tribool facts. Nodes are added in
+ * dependency order, so ids are a topological order. Each
+ * AND/OR node keeps how many operands are FALSE and how
+ * many UNKNOWN, so a changed operand updates its parent
+ * in O(1) regardless of fan-in.
+ *
+ * Changing an input only marks it dirty. An update then
+ * recomputes dirty nodes in id order; a node whose value
+ * did not change marks nothing further. A FALSE operand
+ * pins an AND (and TRUE an OR), so edits under it stop
+ * there.
+ * ====================================================== */
+
+/** Returned by the builders on allocation failure or invalid operands. */
+#define FOSSIL_TYPE_TRIBOOL_GRAPH_INVALID ((u32)0xFFFFFFFFu)
+
+typedef struct fossil_type_tribool_graph_node {
+    u32 op;              /**< INPUT, NOT, AND or OR (fossil_type_tribool_op). */
+    tribool value;       /**< Current value. */
+    tribool pending;     /**< INPUT only: value to apply on the next update. */
+    u32 operand_first;   /**< First operand in the graph's operand list. */
+    u32 operand_count;
+    u32 dependents;      /**< Head of the dependent edge list, or INVALID. */
+    u32 n_false;         /**< Operands currently FALSE. */
+    u32 n_unknown;       /**< Operands currently UNKNOWN. */
+    u32 dirty;           /**< Queued for recomputation. */
+} fossil_type_tribool_graph_node;
+
+typedef struct fossil_type_tribool_graph_edge {
+    u32 node;  /**< The dependent node. */
+    u32 next;  /**< Next edge of the same operand, or INVALID. */
+} fossil_type_tribool_graph_edge;
+
+typedef struct fossil_type_tribool_graph_stats {
+    size_t updates;          /**< Updates that had dirty nodes. */
+    size_t recomputed;       /**< Nodes recomputed over all updates. */
+    size_t changed;          /**< Nodes whose value changed over all updates. */
+    size_t last_recomputed;  /**< Nodes recomputed by the latest update. */
+    size_t last_changed;     /**< Nodes changed by the latest update. */
+} fossil_type_tribool_graph_stats;
+
+typedef struct fossil_type_tribool_graph {
+    fossil_type_tribool_graph_node *nodes;
+    size_t count, node_capacity;
+    u32 *operands;
+    size_t operand_count, operand_capacity;
+    fossil_type_tribool_graph_edge *edges;
+    size_t edge_count, edge_capacity;
+    u32 *queue;              /**< Min-heap of dirty node ids. */
+    size_t queued, queue_capacity;
+    fossil_type_tribool_graph_stats stats;
+} fossil_type_tribool_graph;
+
+typedef fossil_type_tribool_graph tribool_graph;
+
+/* ======================================================
+ * Building
+ * ====================================================== */
+
+/**
+ * @brief Initializes an empty graph.
+ * @param g The graph to initialize.
+ */
+void fossil_type_tribool_graph_init(tribool_graph *g);
+
+/**
+ * @brief Releases all nodes. Safe on an initialized or freed graph.
+ * @param g The graph to free.
+ */
+void fossil_type_tribool_graph_free(tribool_graph *g);
+
+/**
+ * @brief Returns the number of nodes.
+ * @param g The graph; NULL has no nodes.
+ * @return The node count.
+ */
+size_t fossil_type_tribool_graph_count(const tribool_graph *g);
+
+/**
+ * @brief Adds an input fact.
+ * @param g The graph.
+ * @param initial The starting value; values other than TRUE/FALSE store UNKNOWN.
+ * @return The node id, or FOSSIL_TYPE_TRIBOOL_GRAPH_INVALID.
+ */
+u32 fossil_type_tribool_graph_input(tribool_graph *g, tribool initial);
+
+/**
+ * @brief Adds a node holding the Kleene NOT of an existing node.
+ * @param g The graph.
+ * @param a The operand id.
+ * @return The node id, or FOSSIL_TYPE_TRIBOOL_GRAPH_INVALID.
+ */
+u32 fossil_type_tribool_graph_not(tribool_graph *g, u32 a);
+
+/**
+ * @brief Adds a node holding the Kleene AND of existing nodes.
+ * @param g The graph.
+ * @param operands Operand ids; duplicates are allowed.
+ * @param count Number of operands; zero operands yield TRUE.
+ * @return The node id, or FOSSIL_TYPE_TRIBOOL_GRAPH_INVALID.
+ */
+u32 fossil_type_tribool_graph_and(tribool_graph *g, const u32 *operands, size_t count);
+
+/**
+ * @brief Adds a node holding the Kleene OR of existing nodes.
+ * @param g The graph.
+ * @param operands Operand ids; duplicates are allowed.
+ * @param count Number of operands; zero operands yield FALSE.
+ * @return The node id, or FOSSIL_TYPE_TRIBOOL_GRAPH_INVALID.
+ */
+u32 fossil_type_tribool_graph_or(tribool_graph *g, const u32 *operands, size_t count);
+
+/* ======================================================
+ * Updating
+ * ====================================================== */
+
+/**
+ * @brief Changes an input. Takes effect on the next update.
+ * @param g The graph.
+ * @param input An input node id.
+ * @param value The new value; values other than TRUE/FALSE store UNKNOWN.
+ * @return 0 on success, -1 if g is NULL or input is not an input node.
+ */
+int fossil_type_tribool_graph_set(tribool_graph *g, u32 input, tribool value);
+
+/**
+ * @brief Recomputes the dirty nodes and whatever their changes reach.
+ * @param g The graph.
+ * @return Number of nodes recomputed.
+ */
+size_t fossil_type_tribool_graph_update(tribool_graph *g);
+
+/**
+ * @brief Reads a node's value as of the latest update.
+ * @param g The graph.
+ * @param id The node id; UNKNOWN when out of range.
+ * @return The node value.
+ */
+tribool fossil_type_tribool_graph_value(const tribool_graph *g, u32 id);
+
+/**
+ * @brief Returns the recomputation counters.
+ * @param g The graph; NULL yields all zeros.
+ * @return A copy of the counters.
+ */
+fossil_type_tribool_graph_stats fossil_type_tribool_graph_get_stats(const tribool_graph *g);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class TriboolGraph {
+    tribool_graph g;
+
+public:
+    using Id = u32;
+
+    TriboolGraph() { fossil_type_tribool_graph_init(&g); }
+    TriboolGraph(const TriboolGraph&) = delete;
+    TriboolGraph& operator=(const TriboolGraph&) = delete;
+    ~TriboolGraph() { fossil_type_tribool_graph_free(&g); }
+
+    /**
+     * @brief Returns the number of nodes.
+     */
+    size_t size() const { return fossil_type_tribool_graph_count(&g); }
+
+    Id input(Tribool initial = Tribool()) { return fossil_type_tribool_graph_input(&g, initial); }
+    Id logical_not(Id a) { return fossil_type_tribool_graph_not(&g, a); }
+    Id logical_and(std::span<const Id> operands) {
+        return fossil_type_tribool_graph_and(&g, operands.data(), operands.size());
+    }
+    Id logical_or(std::span<const Id> operands) {
+        return fossil_type_tribool_graph_or(&g, operands.data(), operands.size());
+    }
+
+    /**
+     * @brief Changes an input; applied by the next update().
+     * @return false if id is not an input.
+     */
+    bool set(Id input, Tribool value) { return fossil_type_tribool_graph_set(&g, input, value) == 0; }
+
+    /**
+     * @brief Propagates pending changes.
+     * @return Number of nodes recomputed.
+     */
+    size_t update() { return fossil_type_tribool_graph_update(&g); }
+
+    /**
+     * @brief Reads a node; UNKNOWN when out of range.
+     */
+    Tribool value(Id id) const { return Tribool(fossil_type_tribool_graph_value(&g, id)); }
+
+    /**
+     * @brief Returns the recomputation counters.
+     */
+    fossil_type_tribool_graph_stats stats() const { return fossil_type_tribool_graph_get_stats(&g); }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
@@ -0,0 +1,186 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_LAZY_H
+#define FOSSIL_TYPE_TRIBOOL_LAZY_H
+
+#include "tribool.h"
+
+/* ======================================================
+ * C++ Lazy Expressions
+ *
+ * Tribool::operator&& and operator|| are ordinary
+ * functions, so both operands are computed before the
+ * call. The templates below build the expression as a
+ * tree of small value types instead and evaluate it on
+ * eval(), skipping the right operand when the left one
+ * dominates: FALSE for AND, TRUE for OR. UNKNOWN does not
+ * dominate, so the right operand still runs then.
+ *
+ *     auto rule = lazy(cheap) && (lazy(costly) || !lazy(other));
+ *     Tribool r = rule.eval();
+ *
+ * Nodes hold their operands by value and every eval() is
+ * constexpr and inline, so a rule compiles to the same
+ * branches a hand-written short circuit would.
+ * ====================================================== */
+#ifdef __cplusplus
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace fossil::type {
+
+namespace lazy_detail {
+
+/** Base of every lazy node; used only to recognize them. */
+struct Node {};
+
+template <class T>
+concept IsNode = std::derived_from<std::remove_cvref_t<T>, Node>;
+
+/** Values usable as an eager leaf. */
+template <class T>
+concept IsValue = std::same_as<std::remove_cvref_t<T>, Tribool> ||
+                  std::same_as<std::remove_cvref_t<T>, tribool> ||
+                  std::same_as<std::remove_cvref_t<T>, bool>;
+
+constexpr Tribool to_tribool(Tribool t) { return t; }
+constexpr Tribool to_tribool(tribool t) { return Tribool(t); }
+constexpr Tribool to_tribool(bool b) { return Tribool(b ? FOSSIL_TYPE_TRIBOOL_TRUE : FOSSIL_TYPE_TRIBOOL_FALSE); }
+
+} // namespace lazy_detail
+
+/**
+ * @brief A value already computed.
+ */
+class LazyValue : public lazy_detail::Node {
+    Tribool v;
+
+public:
+    constexpr explicit LazyValue(Tribool t) : v(t) {}
+    constexpr Tribool eval() const { return v; }
+};
+
+/**
+ * @brief A deferred call; F returns Tribool, tribool or bool.
+ */
+template <class F>
+class LazyCall : public lazy_detail::Node {
+    F f;
+
+public:
+    constexpr explicit LazyCall(F fn) : f(std::move(fn)) {}
+    constexpr Tribool eval() const { return lazy_detail::to_tribool(f()); }
+};
+
+template <class E>
+class LazyNot : public lazy_detail::Node {
+    E e;
+
+public:
+    constexpr explicit LazyNot(E expr) : e(std::move(expr)) {}
+    constexpr Tribool eval() const { return !e.eval(); }
+};
+
+template <class L, class R>
+class LazyAnd : public lazy_detail::Node {
+    L l;
+    R r;
+
+public:
+    constexpr LazyAnd(L lhs, R rhs) : l(std::move(lhs)), r(std::move(rhs)) {}
+    constexpr Tribool eval() const {
+        Tribool a = l.eval();
+        if (a.is_false()) return a;
+        return a && r.eval();
+    }
+};
+
+template <class L, class R>
+class LazyOr : public lazy_detail::Node {
+    L l;
+    R r;
+
+public:
+    constexpr LazyOr(L lhs, R rhs) : l(std::move(lhs)), r(std::move(rhs)) {}
+    constexpr Tribool eval() const {
+        Tribool a = l.eval();
+        if (a.is_true()) return a;
+        return a || r.eval();
+    }
+};
+
+namespace lazy_detail {
+
+template <class T>
+constexpr auto as_node(T&& x) {
+    if constexpr (IsNode<T>) return std::remove_cvref_t<T>(std::forward<T>(x));
+    else return LazyValue(to_tribool(x));
+}
+
+template <class T>
+using node_t = decltype(as_node(std::declval<T>()));
+
+/** At least one side must already be lazy, so plain Tribool operators keep their meaning. */
+template <class L, class R>
+concept Operands = (IsNode<L> || IsNode<R>) && (IsNode<L> || IsValue<L>) && (IsNode<R> || IsValue<R>);
+
+} // namespace lazy_detail
+
+/**
+ * @brief Defers a call until the expression is evaluated.
+ * @param fn Callable taking no arguments and returning Tribool, tribool or bool.
+ */
+template <class F>
+constexpr LazyCall<std::decay_t<F>> lazy(F&& fn) {
+    return LazyCall<std::decay_t<F>>(std::forward<F>(fn));
+}
+
+template <class L, class R>
+    requires lazy_detail::Operands<L, R>
+constexpr auto operator&&(L&& l, R&& r) {
+    return LazyAnd<lazy_detail::node_t<L>, lazy_detail::node_t<R>>(
+        lazy_detail::as_node(std::forward<L>(l)), lazy_detail::as_node(std::forward<R>(r)));
+}
+
+template <class L, class R>
+    requires lazy_detail::Operands<L, R>
+constexpr auto operator||(L&& l, R&& r) {
+    return LazyOr<lazy_detail::node_t<L>, lazy_detail::node_t<R>>(
+        lazy_detail::as_node(std::forward<L>(l)), lazy_detail::as_node(std::forward<R>(r)));
+}
+
+template <class E>
+    requires lazy_detail::IsNode<E>
+constexpr auto operator!(E&& e) {
+    return LazyNot<std::remove_cvref_t<E>>(std::forward<E>(e));
+}
+
+} // namespace fossil::type
+
+#endif
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_LUT_H
+#define FOSSIL_TYPE_TRIBOOL_LUT_H
+
+#include "types.h"
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+#include <span>
+#include <type_traits>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Definitions
+ *
+ * A lookup table holds an arbitrary three-valued function
+ * of up to five inputs. Row r describes the inputs whose
+ * base-3 digits spell r, input 0 being the least
+ * significant digit and each digit the tribool value
+ * (FALSE 0, TRUE 1, UNKNOWN 2):
+ *     r = in[0] + 3 * in[1] + 9 * in[2] + ...
+ * The packed vector encoding uses the same digits, so a
+ * row index is computed straight from the lane bits.
+ * ====================================================== */
+
+/** Largest supported number of inputs. */
+#define FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY 5
+
+/** Table capacity: 3^5 = 243 rows, padded so SIMD gathers stay in bounds. */
+#define FOSSIL_TYPE_TRIBOOL_LUT_CAPACITY 256
+
+typedef struct fossil_type_tribool_lut {
+    u32 arity;                                   /**< Number of inputs. */
+    u32 rows;                                    /**< 3^arity. */
+    u8 table[FOSSIL_TYPE_TRIBOOL_LUT_CAPACITY];  /**< Row values; padding rows are 0. */
+} fossil_type_tribool_lut;
+
+typedef fossil_type_tribool_lut tribool_lut;
+
+/**
+ * @brief Function sampled once per row when compiling a table.
+ * @param inputs The arity input values of the row.
+ * @param user The pointer passed to fossil_type_tribool_lut_compile_fn.
+ * @return The function value for those inputs.
+ */
+typedef tribool (*fossil_type_tribool_lut_fn)(const tribool *inputs, void *user);
+
+/* ======================================================
+ * Compilation
+ * ====================================================== */
+
+/**
+ * @brief Compiles a truth table. Values other than TRUE/FALSE store UNKNOWN.
+ * @param lut The table to fill.
+ * @param arity Number of inputs, at most FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY.
+ * @param table 3^arity row values in row order.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_tribool_lut_compile(tribool_lut *lut, size_t arity, const tribool *table);
+
+/**
+ * @brief Compiles a table by calling fn once for every row, in row order.
+ * @param lut The table to fill.
+ * @param arity Number of inputs, at most FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY.
+ * @param fn The function to sample.
+ * @param user Passed through to fn.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_tribool_lut_compile_fn(tribool_lut *lut, size_t arity, fossil_type_tribool_lut_fn fn, void *user);
+
+/* ======================================================
+ * Evaluation
+ * ====================================================== */
+
+/**
+ * @brief Evaluates the table for one set of inputs.
+ * @param lut The compiled table.
+ * @param inputs lut->arity values; anything but TRUE/FALSE reads as UNKNOWN.
+ * @return The table value, or UNKNOWN on invalid arguments.
+ */
+tribool fossil_type_tribool_lut_eval(const tribool_lut *lut, const tribool *inputs);
+
+/**
+ * @brief Evaluates the table lane by lane over packed input columns.
+ * @param lut The compiled table.
+ * @param dst Resized to the input length; may be one of the inputs.
+ * @param inputs Columns of equal length, one per table input.
+ * @param input_count Must equal lut->arity. With none, dst keeps its length.
+ * @return 0 on success, -1 on invalid arguments, length mismatch or allocation failure.
+ */
+int fossil_type_tribool_lut_run(const tribool_lut *lut, tribool_vec *dst,
+                                const tribool_vec *const *inputs, size_t input_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class TriboolLut {
+    tribool_lut lut;
+
+    template <class F>
+    static tribool sample(const tribool *inputs, void *user) {
+        return (*static_cast<F *>(user))(inputs);
+    }
+
+public:
+    /**
+     * @brief Default constructor. A constant UNKNOWN of no inputs.
+     */
+    TriboolLut() { tribool u = FOSSIL_TYPE_TRIBOOL_UNKNOWN; fossil_type_tribool_lut_compile(&lut, 0, &u); }
+
+    /**
+     * @brief Compiles a truth table of 3^arity rows.
+     * @return false on invalid arity or table size.
+     */
+    bool compile(size_t arity, std::span<const tribool> table) {
+        size_t rows = 1;
+        for (size_t i = 0; i < arity && i < FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY; i++) rows *= 3;
+        if (table.size() != rows) return false;
+        return fossil_type_tribool_lut_compile(&lut, arity, table.data()) == 0;
+    }
+
+    /**
+     * @brief Compiles a table by sampling fn(const tribool *inputs) once per row.
+     * @return false on invalid arity.
+     */
+    template <class F>
+    bool compile_fn(size_t arity, F&& fn) {
+        return fossil_type_tribool_lut_compile_fn(&lut, arity, &sample<std::remove_reference_t<F>>,
+                                                  const_cast<void *>(static_cast<const void *>(&fn))) == 0;
+    }
+
+    /**
+     * @brief Returns the number of inputs.
+     */
+    size_t arity() const { return lut.arity; }
+
+    /**
+     * @brief Evaluates one set of inputs; UNKNOWN if the count is wrong.
+     */
+    Tribool operator()(std::span<const tribool> inputs) const {
+        if (inputs.size() != lut.arity) return Tribool();
+        return Tribool(fossil_type_tribool_lut_eval(&lut, inputs.data()));
+    }
+
+    /**
+     * @brief Evaluates over the input columns; empty on mismatch.
+     */
+    TriboolVec run(std::span<const tribool_vec* const> inputs) const {
+        TriboolVec out;
+        if (fossil_type_tribool_lut_run(&lut, out.raw(), inputs.data(), inputs.size()) != 0) return TriboolVec();
+        return out;
+    }
+
+    const tribool_lut* raw() const { return &lut; }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
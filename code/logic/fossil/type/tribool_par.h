@@ -0,0 +1,251 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_PAR_H
+#define FOSSIL_TYPE_TRIBOOL_PAR_H
+
+#include "types.h"
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+#include <type_traits>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Definitions
+ *
+ * A pool runs bulk work on a fixed set of threads, the
+ * calling thread included. Work over n items is cut into
+ * chunks of grain items; every thread starts on an equal
+ * run of chunks and, once its own run is empty, steals the
+ * back half of the largest run it finds. Reductions give
+ * each chunk its own partial result and combine them in
+ * chunk order, so results never depend on the thread count
+ * or on scheduling.
+ *
+ * A pool serves one caller at a time. Every function that
+ * takes a pool also accepts NULL and then runs serially.
+ * ====================================================== */
+
+/** Largest number of threads a pool will start. */
+#define FOSSIL_TYPE_TRIBOOL_POOL_MAX_THREADS 256
+
+/** Default chunk size in packed words: 32 KiB per operand stream. */
+#define FOSSIL_TYPE_TRIBOOL_POOL_GRAIN 4096
+
+typedef struct fossil_type_tribool_pool {
+    struct fossil_type_tribool_pool_impl *impl;
+    size_t threads;  /**< Threads taking part in a job, the caller included. */
+    size_t grain;    /**< Packed words per chunk for the bulk operations. */
+} fossil_type_tribool_pool;
+
+typedef fossil_type_tribool_pool tribool_pool;
+
+/**
+ * @brief Work callback: processes items [begin, end) of a job.
+ * @param ctx The pointer passed to fossil_type_tribool_pool_for.
+ * @param chunk Index of the chunk, for writing per-chunk results.
+ * @param begin First item of the chunk.
+ * @param end One past the last item of the chunk.
+ */
+typedef void (*fossil_type_tribool_pool_fn)(void *ctx, size_t chunk, size_t begin, size_t end);
+
+/* ======================================================
+ * Pool Management
+ * ====================================================== */
+
+/**
+ * @brief Starts a pool.
+ * @param pool The pool to initialize.
+ * @param threads Total thread count including the caller; 0 uses one per
+ *        online processor. Capped at FOSSIL_TYPE_TRIBOOL_POOL_MAX_THREADS.
+ * @return 0 on success, -1 on invalid arguments or if no thread could be started.
+ */
+int fossil_type_tribool_pool_init(tribool_pool *pool, size_t threads);
+
+/**
+ * @brief Stops and joins the pool threads.
+ * @param pool The pool to release; NULL is ignored.
+ */
+void fossil_type_tribool_pool_free(tribool_pool *pool);
+
+/**
+ * @brief Sets the chunk size used by the bulk operations.
+ * @param pool The pool to tune.
+ * @param words Packed words per chunk; 0 restores FOSSIL_TYPE_TRIBOOL_POOL_GRAIN.
+ */
+void fossil_type_tribool_pool_set_grain(tribool_pool *pool, size_t words);
+
+/**
+ * @brief Runs fn over items [0, count) in chunks of grain items and waits.
+ * @param pool The pool, or NULL to run every chunk on the calling thread.
+ * @param count Number of items.
+ * @param grain Items per chunk; 0 means one chunk per thread.
+ * @param fn Called once per chunk, from any pool thread.
+ * @param ctx Passed through to fn.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_tribool_pool_for(tribool_pool *pool, size_t count, size_t grain,
+                                 fossil_type_tribool_pool_fn fn, void *ctx);
+
+/* ======================================================
+ * Parallel Bulk Operations
+ *
+ * Same results as the serial fossil_type_tribool_vec_*
+ * functions, computed over pool->grain-word chunks.
+ * ====================================================== */
+
+/**
+ * @brief Parallel element-wise Kleene AND. dst may alias a or b.
+ * @return 0 on success, -1 on invalid arguments, length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_and_par(tribool_pool *pool, tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Parallel element-wise Kleene OR. dst may alias a or b.
+ * @return 0 on success, -1 on invalid arguments, length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_or_par(tribool_pool *pool, tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Parallel element-wise Kleene NOT. dst may alias a.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_vec_not_par(tribool_pool *pool, tribool_vec *dst, const tribool_vec *a);
+
+/**
+ * @brief Parallel Kleene AND over all elements; an empty vector yields TRUE.
+ */
+tribool fossil_type_tribool_vec_all_par(tribool_pool *pool, const tribool_vec *v);
+
+/**
+ * @brief Parallel Kleene OR over all elements; an empty vector yields FALSE.
+ */
+tribool fossil_type_tribool_vec_any_par(tribool_pool *pool, const tribool_vec *v);
+
+/**
+ * @brief Parallel count of TRUE elements.
+ */
+size_t fossil_type_tribool_vec_count_true_par(tribool_pool *pool, const tribool_vec *v);
+
+/**
+ * @brief Parallel count of FALSE elements.
+ */
+size_t fossil_type_tribool_vec_count_false_par(tribool_pool *pool, const tribool_vec *v);
+
+/**
+ * @brief Parallel count of UNKNOWN elements.
+ */
+size_t fossil_type_tribool_vec_count_unknown_par(tribool_pool *pool, const tribool_vec *v);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class TriboolPool {
+    tribool_pool p;
+
+    template <class F>
+    static void call(void *ctx, size_t chunk, size_t begin, size_t end) {
+        (*static_cast<F *>(ctx))(chunk, begin, end);
+    }
+
+public:
+    /**
+     * @brief Starts a pool; 0 threads uses one per online processor.
+     */
+    explicit TriboolPool(size_t threads = 0) {
+        if (fossil_type_tribool_pool_init(&p, threads) != 0) p = tribool_pool{nullptr, 1, FOSSIL_TYPE_TRIBOOL_POOL_GRAIN};
+    }
+    TriboolPool(const TriboolPool&) = delete;
+    TriboolPool& operator=(const TriboolPool&) = delete;
+    ~TriboolPool() { fossil_type_tribool_pool_free(&p); }
+
+    /**
+     * @brief Returns the number of threads taking part in a job.
+     */
+    size_t threads() const { return p.threads; }
+
+    /**
+     * @brief Sets the packed words per chunk; 0 restores the default.
+     */
+    void set_grain(size_t words) { fossil_type_tribool_pool_set_grain(&p, words); }
+
+    /**
+     * @brief Runs fn(chunk, begin, end) over [0, count) in chunks of grain items.
+     */
+    template <class F>
+    void parallel_for(size_t count, size_t grain, F&& fn) {
+        fossil_type_tribool_pool_for(raw(), count, grain, &call<std::remove_reference_t<F>>,
+                                     const_cast<void *>(static_cast<const void *>(&fn)));
+    }
+
+    TriboolVec logical_and(const TriboolVec& a, const TriboolVec& b) {
+        TriboolVec r;
+        if (fossil_type_tribool_vec_and_par(raw(), r.raw(), a.raw(), b.raw()) != 0) return TriboolVec();
+        return r;
+    }
+
+    TriboolVec logical_or(const TriboolVec& a, const TriboolVec& b) {
+        TriboolVec r;
+        if (fossil_type_tribool_vec_or_par(raw(), r.raw(), a.raw(), b.raw()) != 0) return TriboolVec();
+        return r;
+    }
+
+    TriboolVec logical_not(const TriboolVec& a) {
+        TriboolVec r;
+        if (fossil_type_tribool_vec_not_par(raw(), r.raw(), a.raw()) != 0) return TriboolVec();
+        return r;
+    }
+
+    Tribool all(const TriboolVec& v) { return Tribool(fossil_type_tribool_vec_all_par(raw(), v.raw())); }
+    Tribool any(const TriboolVec& v) { return Tribool(fossil_type_tribool_vec_any_par(raw(), v.raw())); }
+    size_t count_true(const TriboolVec& v) { return fossil_type_tribool_vec_count_true_par(raw(), v.raw()); }
+    size_t count_false(const TriboolVec& v) { return fossil_type_tribool_vec_count_false_par(raw(), v.raw()); }
+    size_t count_unknown(const TriboolVec& v) { return fossil_type_tribool_vec_count_unknown_par(raw(), v.raw()); }
+
+    /**
+     * @brief The C pool, or NULL when it failed to start (operations then run serially).
+     */
+    tribool_pool* raw() { return p.impl ? &p : nullptr; }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
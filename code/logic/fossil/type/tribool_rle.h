@@ -0,0 +1,297 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_RLE_H
+#define FOSSIL_TYPE_TRIBOOL_RLE_H
+
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Definition
+ *
+ * A tribool column stored as runs. Run i holds values[i]
+ * for rows [ends[i - 1], ends[i]) (the first run starts
+ * at 0), so ends doubles as the run index for random
+ * access. Adjacent runs never share a value.
+ * ====================================================== */
+
+typedef struct fossil_type_tribool_rle {
+    tribool8 *values;  /**< Value of each run. */
+    size_t *ends;      /**< Exclusive end row of each run, strictly increasing. */
+    size_t runs;       /**< Number of runs in use. */
+    size_t capacity;   /**< Number of runs allocated. */
+    size_t length;     /**< Number of rows; equals ends[runs - 1] when runs > 0. */
+} fossil_type_tribool_rle;
+
+typedef fossil_type_tribool_rle tribool_rle;
+
+/* ======================================================
+ * Lifecycle
+ * ====================================================== */
+
+/**
+ * @brief Initializes an empty column.
+ * @param r The column to initialize.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_tribool_rle_init(tribool_rle *r);
+
+/**
+ * @brief Releases the column storage and leaves it empty.
+ * @param r The column to free; NULL is ignored.
+ */
+void fossil_type_tribool_rle_free(tribool_rle *r);
+
+/**
+ * @brief Makes dst an exact copy of src.
+ * @param dst The destination column.
+ * @param src The source column.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_rle_copy(tribool_rle *dst, const tribool_rle *src);
+
+/* ======================================================
+ * Access
+ * ====================================================== */
+
+/**
+ * @brief Appends one row. Values other than TRUE/FALSE store UNKNOWN.
+ * @param r The column to extend.
+ * @param t The value to append.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_rle_append(tribool_rle *r, tribool t);
+
+/**
+ * @brief Appends count rows of the same value, extending the last run if it matches.
+ * @param r The column to extend.
+ * @param t The value to append.
+ * @param count Number of rows; 0 is a no-op.
+ * @return 0 on success, -1 on invalid arguments, overflow or allocation failure.
+ */
+int fossil_type_tribool_rle_append_run(tribool_rle *r, tribool t, size_t count);
+
+/**
+ * @brief Returns the number of rows.
+ */
+size_t fossil_type_tribool_rle_length(const tribool_rle *r);
+
+/**
+ * @brief Returns the number of runs.
+ */
+size_t fossil_type_tribool_rle_runs(const tribool_rle *r);
+
+/**
+ * @brief Finds the run holding a row by binary search over the run ends.
+ * @param r The column to search.
+ * @param index Row index.
+ * @return The run index, or FOSSIL_TYPE_TRIBOOL_NPOS when out of range.
+ */
+size_t fossil_type_tribool_rle_find_run(const tribool_rle *r, size_t index);
+
+/**
+ * @brief Reads one row in O(log runs).
+ * @param r The column to read.
+ * @param index Row index; UNKNOWN is returned when out of range.
+ * @return The row value.
+ */
+tribool fossil_type_tribool_rle_get(const tribool_rle *r, size_t index);
+
+/* ======================================================
+ * Logic
+ *
+ * The operators walk both run lists together and emit one
+ * run per overlap, merging equal neighbours, so the cost
+ * is O(runs(a) + runs(b)) regardless of the row count.
+ * dst may alias either operand.
+ * ====================================================== */
+
+/**
+ * @brief Row-wise Kleene AND of two columns of equal length.
+ * @return 0 on success, -1 on invalid arguments, length mismatch or allocation failure.
+ */
+int fossil_type_tribool_rle_and(tribool_rle *dst, const tribool_rle *a, const tribool_rle *b);
+
+/**
+ * @brief Row-wise Kleene OR of two columns of equal length.
+ * @return 0 on success, -1 on invalid arguments, length mismatch or allocation failure.
+ */
+int fossil_type_tribool_rle_or(tribool_rle *dst, const tribool_rle *a, const tribool_rle *b);
+
+/**
+ * @brief Row-wise Kleene NOT.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_rle_not(tribool_rle *dst, const tribool_rle *a);
+
+/* ======================================================
+ * Conversion
+ * ====================================================== */
+
+/**
+ * @brief Replaces the column contents with an array of tribools.
+ * @param r The destination column.
+ * @param src Array of count tribools.
+ * @param count Number of rows.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_rle_pack(tribool_rle *r, const tribool *src, size_t count);
+
+/**
+ * @brief Expands the column into an array.
+ * @param r The source column.
+ * @param dst Array with room for fossil_type_tribool_rle_length(r) tribools.
+ */
+void fossil_type_tribool_rle_unpack(const tribool_rle *r, tribool *dst);
+
+/**
+ * @brief Expands the column into a packed vector, resizing it to the column length.
+ * @param v The destination vector.
+ * @param r The source column.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_rle_to_vec(tribool_vec *v, const tribool_rle *r);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class TriboolRle {
+    tribool_rle r;
+
+public:
+    /**
+     * @brief Constructs an empty column.
+     */
+    TriboolRle() { fossil_type_tribool_rle_init(&r); }
+
+    /**
+     * @brief Copy constructor. Duplicates the runs.
+     */
+    TriboolRle(const TriboolRle& other) {
+        fossil_type_tribool_rle_init(&r);
+        fossil_type_tribool_rle_copy(&r, &other.r);
+    }
+
+    /**
+     * @brief Move constructor. Takes ownership of the runs.
+     */
+    TriboolRle(TriboolRle&& other) noexcept : r(other.r) {
+        fossil_type_tribool_rle_init(&other.r);
+    }
+
+    /**
+     * @brief Copy assignment. Duplicates the runs.
+     */
+    TriboolRle& operator=(const TriboolRle& other) {
+        if (this != &other) fossil_type_tribool_rle_copy(&r, &other.r);
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment. Takes ownership of the runs.
+     */
+    TriboolRle& operator=(TriboolRle&& other) noexcept {
+        if (this != &other) {
+            fossil_type_tribool_rle_free(&r);
+            r = other.r;
+            fossil_type_tribool_rle_init(&other.r);
+        }
+        return *this;
+    }
+
+    ~TriboolRle() { fossil_type_tribool_rle_free(&r); }
+
+    /**
+     * @brief Appends count rows of the same value.
+     * @return false on allocation failure or overflow.
+     */
+    bool append(Tribool t, size_t count = 1) {
+        return fossil_type_tribool_rle_append_run(&r, t, count) == 0;
+    }
+
+    /**
+     * @brief Returns the number of rows.
+     */
+    size_t size() const { return fossil_type_tribool_rle_length(&r); }
+
+    /**
+     * @brief Returns the number of runs.
+     */
+    size_t runs() const { return fossil_type_tribool_rle_runs(&r); }
+
+    /**
+     * @brief Reads one row; UNKNOWN when out of range.
+     */
+    Tribool get(size_t index) const { return Tribool(fossil_type_tribool_rle_get(&r, index)); }
+
+    /**
+     * @brief Row-wise logical NOT.
+     */
+    TriboolRle operator!() const {
+        TriboolRle out;
+        fossil_type_tribool_rle_not(&out.r, &r);
+        return out;
+    }
+
+    /**
+     * @brief Row-wise logical AND. Mismatched lengths yield an empty column.
+     */
+    TriboolRle operator&&(const TriboolRle& rhs) const {
+        TriboolRle out;
+        fossil_type_tribool_rle_and(&out.r, &r, &rhs.r);
+        return out;
+    }
+
+    /**
+     * @brief Row-wise logical OR. Mismatched lengths yield an empty column.
+     */
+    TriboolRle operator||(const TriboolRle& rhs) const {
+        TriboolRle out;
+        fossil_type_tribool_rle_or(&out.r, &r, &rhs.r);
+        return out;
+    }
+
+    tribool_rle* raw() { return &r; }
+    const tribool_rle* raw() const { return &r; }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_SELECT_H
+#define FOSSIL_TYPE_TRIBOOL_SELECT_H
+
+#include "types.h"
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Selection Vectors
+ *
+ * A selection vector lists, in ascending order, the u32
+ * row indices whose value matches. Outputs must have room
+ * for as many indices as there are rows (the worst case);
+ * the kernels may use that room as scratch past the
+ * returned count. Inputs longer than UINT32_MAX rows are
+ * rejected and select nothing. Values other than TRUE and
+ * FALSE match UNKNOWN.
+ * ====================================================== */
+
+/**
+ * @brief Collects the indices of rows equal to match.
+ * @param dst Output with room for count indices.
+ * @param src Array of count tribools.
+ * @param count Number of rows.
+ * @param match The value to select.
+ * @return Number of indices written.
+ */
+size_t fossil_type_tribool_select(u32 *dst, const tribool *src, size_t count, tribool match);
+
+/**
+ * @brief Collects TRUE and UNKNOWN row indices in a single pass.
+ * @param true_dst Output for TRUE rows, with room for count indices.
+ * @param unknown_dst Output for UNKNOWN rows, with room for count indices.
+ * @param unknown_count Receives the number of UNKNOWN indices written.
+ * @param src Array of count tribools.
+ * @param count Number of rows.
+ * @return Number of TRUE indices written.
+ */
+size_t fossil_type_tribool_select_split(u32 *true_dst, u32 *unknown_dst, size_t *unknown_count,
+                                        const tribool *src, size_t count);
+
+/**
+ * @brief Collects the indices of packed-vector lanes equal to match.
+ * @param dst Output with room for the vector length in indices.
+ * @param v The packed vector.
+ * @param match The value to select.
+ * @return Number of indices written.
+ */
+size_t fossil_type_tribool_vec_select(u32 *dst, const tribool_vec *v, tribool match);
+
+/**
+ * @brief Collects TRUE and UNKNOWN lane indices of a packed vector in a single pass.
+ * @param true_dst Output for TRUE lanes, with room for the vector length.
+ * @param unknown_dst Output for UNKNOWN lanes, with room for the vector length.
+ * @param unknown_count Receives the number of UNKNOWN indices written.
+ * @param v The packed vector.
+ * @return Number of TRUE indices written.
+ */
+size_t fossil_type_tribool_vec_select_split(u32 *true_dst, u32 *unknown_dst, size_t *unknown_count,
+                                            const tribool_vec *v);
+
+/**
+ * @brief Reports which index-compress kernel is in use.
+ * @return "avx512", "bmi2", "sse2" or "table".
+ */
+const char *fossil_type_tribool_select_kernel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+#include <span>
+#include <vector>
+
+namespace fossil::type {
+
+/**
+ * @brief Row indices of a span equal to match.
+ */
+inline std::vector<u32> select(std::span<const Tribool> values, Tribool match = Tribool(FOSSIL_TYPE_TRIBOOL_TRUE)) {
+    std::vector<u32> out(values.size());
+    out.resize(fossil_type_tribool_select(out.data(), reinterpret_cast<const tribool*>(values.data()),
+                                          values.size(), match));
+    return out;
+}
+
+/**
+ * @brief Lane indices of a packed vector equal to match.
+ */
+inline std::vector<u32> select(const TriboolVec& v, Tribool match = Tribool(FOSSIL_TYPE_TRIBOOL_TRUE)) {
+    std::vector<u32> out(v.size());
+    out.resize(fossil_type_tribool_vec_select(out.data(), v.raw(), match));
+    return out;
+}
+
+} // namespace fossil::type
+
+#endif
+
+#endif
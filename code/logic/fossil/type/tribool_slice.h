@@ -0,0 +1,330 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_SLICE_H
+#define FOSSIL_TYPE_TRIBOOL_SLICE_H
+
+#include "types.h"
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Definition
+ *
+ * 64 tribools held as two bit planes. Bit i of each plane
+ * describes lane i:
+ *     known = 0               -> UNKNOWN
+ *     known = 1, truth = 0    -> FALSE
+ *     known = 1, truth = 1    -> TRUE
+ * truth bits are only ever set where known is set.
+ * ====================================================== */
+
+typedef struct fossil_type_tribool_slice {
+    b64 known;
+    b64 truth;
+} fossil_type_tribool_slice;
+
+typedef fossil_type_tribool_slice tribool_slice;
+
+/** Number of tribools held by one slice. */
+#define FOSSIL_TYPE_TRIBOOL_SLICE_LANES 64
+
+/** Number of slices needed to hold n tribools. */
+#define FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(n) \
+    (((n) + FOSSIL_TYPE_TRIBOOL_SLICE_LANES - 1) / FOSSIL_TYPE_TRIBOOL_SLICE_LANES)
+
+/* ======================================================
+ * Constructors and Access
+ * ====================================================== */
+
+/**
+ * @brief Builds a slice from raw planes. Truth bits outside known are dropped.
+ * @param known Plane of lanes that are TRUE or FALSE.
+ * @param truth Plane of lanes that are TRUE.
+ * @return The normalized slice.
+ */
+tribool_slice fossil_type_tribool_slice_make(b64 known, b64 truth);
+
+/**
+ * @brief Builds a slice with every lane set to the same value.
+ * @param t The value for all 64 lanes.
+ * @return The filled slice.
+ */
+tribool_slice fossil_type_tribool_slice_fill(tribool t);
+
+/**
+ * @brief Reads one lane of a slice.
+ * @param s The slice to read.
+ * @param lane Lane index in [0, 64); UNKNOWN is returned otherwise.
+ * @return The lane value.
+ */
+tribool fossil_type_tribool_slice_get(tribool_slice s, unsigned lane);
+
+/**
+ * @brief Writes one lane of a slice. Values other than TRUE/FALSE store UNKNOWN.
+ * @param s The slice to modify.
+ * @param lane Lane index in [0, 64); ignored otherwise.
+ * @param t The value to store.
+ */
+void fossil_type_tribool_slice_set(tribool_slice *s, unsigned lane, tribool t);
+
+/* ======================================================
+ * Logic
+ * ====================================================== */
+
+/**
+ * @brief Kleene AND across all 64 lanes.
+ * @param a The first operand.
+ * @param b The second operand.
+ * @return The lane-wise AND.
+ */
+tribool_slice fossil_type_tribool_slice_and(tribool_slice a, tribool_slice b);
+
+/**
+ * @brief Kleene OR across all 64 lanes.
+ * @param a The first operand.
+ * @param b The second operand.
+ * @return The lane-wise OR.
+ */
+tribool_slice fossil_type_tribool_slice_or(tribool_slice a, tribool_slice b);
+
+/**
+ * @brief Kleene NOT across all 64 lanes.
+ * @param a The operand.
+ * @return The lane-wise NOT.
+ */
+tribool_slice fossil_type_tribool_slice_not(tribool_slice a);
+
+/**
+ * @brief Kleene AND over arrays of slices. dst may alias a or b.
+ * @param dst Output slices.
+ * @param a First operand slices.
+ * @param b Second operand slices.
+ * @param count Number of slices to process.
+ */
+void fossil_type_tribool_slices_and(tribool_slice *dst, const tribool_slice *a,
+                                    const tribool_slice *b, size_t count);
+
+/**
+ * @brief Kleene OR over arrays of slices. dst may alias a or b.
+ * @param dst Output slices.
+ * @param a First operand slices.
+ * @param b Second operand slices.
+ * @param count Number of slices to process.
+ */
+void fossil_type_tribool_slices_or(tribool_slice *dst, const tribool_slice *a,
+                                   const tribool_slice *b, size_t count);
+
+/**
+ * @brief Kleene NOT over an array of slices. dst may alias a.
+ * @param dst Output slices.
+ * @param a Operand slices.
+ * @param count Number of slices to process.
+ */
+void fossil_type_tribool_slices_not(tribool_slice *dst, const tribool_slice *a, size_t count);
+
+/* ======================================================
+ * Reductions
+ *
+ * Reductions over the first count lanes of an array of
+ * slices; lanes past count are ignored.
+ * ====================================================== */
+
+/**
+ * @brief Kleene AND over count lanes; zero lanes yield TRUE.
+ * @param s Slices holding at least count lanes.
+ * @param count Number of lanes to reduce.
+ * @return FALSE if any is FALSE, else UNKNOWN if any is UNKNOWN, else TRUE.
+ */
+tribool fossil_type_tribool_slices_all(const tribool_slice *s, size_t count);
+
+/**
+ * @brief Kleene OR over count lanes; zero lanes yield FALSE.
+ * @param s Slices holding at least count lanes.
+ * @param count Number of lanes to reduce.
+ * @return TRUE if any is TRUE, else UNKNOWN if any is UNKNOWN, else FALSE.
+ */
+tribool fossil_type_tribool_slices_any(const tribool_slice *s, size_t count);
+
+/**
+ * @brief Negated Kleene OR over count lanes.
+ * @param s Slices holding at least count lanes.
+ * @param count Number of lanes to reduce.
+ * @return NOT fossil_type_tribool_slices_any(s, count).
+ */
+tribool fossil_type_tribool_slices_none(const tribool_slice *s, size_t count);
+
+/**
+ * @brief Counts the TRUE lanes.
+ * @param s Slices holding at least count lanes.
+ * @param count Number of lanes to scan.
+ * @return Number of TRUE lanes.
+ */
+size_t fossil_type_tribool_slices_count_true(const tribool_slice *s, size_t count);
+
+/**
+ * @brief Counts the FALSE lanes.
+ * @param s Slices holding at least count lanes.
+ * @param count Number of lanes to scan.
+ * @return Number of FALSE lanes.
+ */
+size_t fossil_type_tribool_slices_count_false(const tribool_slice *s, size_t count);
+
+/**
+ * @brief Counts the UNKNOWN lanes.
+ * @param s Slices holding at least count lanes.
+ * @param count Number of lanes to scan.
+ * @return Number of UNKNOWN lanes.
+ */
+size_t fossil_type_tribool_slices_count_unknown(const tribool_slice *s, size_t count);
+
+/**
+ * @brief Finds the first UNKNOWN lane.
+ * @param s Slices holding at least count lanes.
+ * @param count Number of lanes to scan.
+ * @return Its index, or FOSSIL_TYPE_TRIBOOL_NPOS.
+ */
+size_t fossil_type_tribool_slices_find_first_unknown(const tribool_slice *s, size_t count);
+
+/* ======================================================
+ * Conversion
+ * ====================================================== */
+
+/**
+ * @brief Converts an array of tribools to slices. Lanes past count are UNKNOWN.
+ * @param dst Output with room for FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(count) slices.
+ * @param src Array of count tribools.
+ * @param count Number of tribools to convert.
+ */
+void fossil_type_tribool_slices_pack(tribool_slice *dst, const tribool *src, size_t count);
+
+/**
+ * @brief Converts slices back to an array of tribools.
+ * @param dst Array with room for count tribools.
+ * @param src Slices holding at least count lanes.
+ * @param count Number of tribools to convert.
+ */
+void fossil_type_tribool_slices_unpack(tribool *dst, const tribool_slice *src, size_t count);
+
+/**
+ * @brief Converts a packed vector to slices. Lanes past the vector length are UNKNOWN.
+ * @param dst Output with room for FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(length) slices.
+ * @param v The packed vector to convert.
+ */
+void fossil_type_tribool_vec_to_slices(tribool_slice *dst, const tribool_vec *v);
+
+/**
+ * @brief Fills a packed vector from slices, resizing it to length.
+ * @param v The destination vector.
+ * @param src Slices holding at least length lanes.
+ * @param length Number of tribools to convert.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_vec_from_slices(tribool_vec *v, const tribool_slice *src, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class TriboolSlice {
+    tribool_slice s;
+
+public:
+    /**
+     * @brief Default constructor. All 64 lanes are UNKNOWN.
+     */
+    TriboolSlice() : s{0, 0} {}
+
+    /**
+     * @brief Constructs a slice from known and truth planes.
+     * @param known Plane of lanes that are TRUE or FALSE.
+     * @param truth Plane of lanes that are TRUE.
+     */
+    TriboolSlice(Flags known, Flags truth)
+        : s(fossil_type_tribool_slice_make(known.value, truth.value)) {}
+
+    /**
+     * @brief Constructs a slice from its C representation.
+     */
+    explicit TriboolSlice(tribool_slice raw) : s(raw) {}
+
+    /**
+     * @brief Returns the plane of lanes that are TRUE or FALSE.
+     */
+    Flags known() const { return Flags(s.known); }
+
+    /**
+     * @brief Returns the plane of lanes that are TRUE.
+     */
+    Flags truth() const { return Flags(s.truth); }
+
+    /**
+     * @brief Reads one lane; UNKNOWN when out of range.
+     */
+    Tribool get(unsigned lane) const { return Tribool(fossil_type_tribool_slice_get(s, lane)); }
+
+    /**
+     * @brief Writes one lane; ignored when out of range.
+     */
+    void set(unsigned lane, Tribool t) { fossil_type_tribool_slice_set(&s, lane, t); }
+
+    /**
+     * @brief Lane-wise logical NOT.
+     */
+    TriboolSlice operator!() const { return TriboolSlice(fossil_type_tribool_slice_not(s)); }
+
+    /**
+     * @brief Lane-wise logical AND.
+     */
+    TriboolSlice operator&&(const TriboolSlice& rhs) const {
+        return TriboolSlice(fossil_type_tribool_slice_and(s, rhs.s));
+    }
+
+    /**
+     * @brief Lane-wise logical OR.
+     */
+    TriboolSlice operator||(const TriboolSlice& rhs) const {
+        return TriboolSlice(fossil_type_tribool_slice_or(s, rhs.s));
+    }
+
+    operator tribool_slice() const { return s; }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
@@ -0,0 +1,299 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_TABLE_H
+#define FOSSIL_TYPE_TRIBOOL_TABLE_H
+
+#include "types.h"
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Definitions
+ *
+ * A replicated fact table. Each slot records which values
+ * have been observed for it, two bits per slot:
+ *     00  nothing observed      (UNKNOWN)
+ *     01  TRUE observed
+ *     10  FALSE observed
+ *     11  both observed         (conflict)
+ * Merging two replicas ORs their words: the join of this
+ * four-point lattice, so merges commute, associate and
+ * can be repeated, and replicas that have seen the same
+ * observations hold the same bits in any delivery order.
+ * UNKNOWN never overrides a known slot. A conflict stays
+ * recorded and is only resolved to a tribool on read, by
+ * a policy chosen by the reader.
+ * ====================================================== */
+
+typedef struct fossil_type_tribool_table {
+    uint64_t *words;  /**< 32 slots per word; padding slots are 00. */
+    size_t length;    /**< Number of slots. */
+} fossil_type_tribool_table;
+
+typedef fossil_type_tribool_table tribool_table;
+
+/** How a read resolves a slot where both TRUE and FALSE were observed. */
+typedef enum fossil_type_tribool_conflict {
+    FOSSIL_TYPE_TRIBOOL_CONFLICT_UNKNOWN = 0,  /**< Report UNKNOWN. */
+    FOSSIL_TYPE_TRIBOOL_CONFLICT_TRUE,         /**< TRUE wins. */
+    FOSSIL_TYPE_TRIBOOL_CONFLICT_FALSE         /**< FALSE wins. */
+} fossil_type_tribool_conflict;
+
+/*
+ * A delta holds the observations one replica has and another
+ * lacks, as a byte string of unsigned LEB128 varints:
+ *     length   slot count of the sending table
+ *     count    number of entries
+ *     entry*   (gap << 2) | bits, one per changed slot in
+ *              increasing order; gap is the number of slots
+ *              skipped since the previous entry and bits the
+ *              observation bits (1 to 3) it adds.
+ * A slot that changed costs one byte while gaps stay below 32.
+ */
+typedef struct fossil_type_tribool_delta {
+    u8 *bytes;        /**< Encoded delta. */
+    size_t size;      /**< Bytes in use. */
+    size_t capacity;  /**< Bytes allocated. */
+} fossil_type_tribool_delta;
+
+typedef fossil_type_tribool_delta tribool_delta;
+
+/* ======================================================
+ * Lifecycle and Access
+ * ====================================================== */
+
+/**
+ * @brief Initializes a table of the given length with nothing observed.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_table_init(tribool_table *t, size_t length);
+
+/**
+ * @brief Releases the table storage and leaves it empty.
+ * @param t The table to free; NULL is ignored.
+ */
+void fossil_type_tribool_table_free(tribool_table *t);
+
+/**
+ * @brief Grows the table; new slots have nothing observed. Tables never shrink.
+ * @return 0 on success, -1 on invalid arguments, a smaller length or allocation failure.
+ */
+int fossil_type_tribool_table_grow(tribool_table *t, size_t length);
+
+/**
+ * @brief Records a local observation. UNKNOWN records nothing.
+ * @param t The table to update.
+ * @param slot Slot index; must be below the table length.
+ * @param value The observed value.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_tribool_table_observe(tribool_table *t, size_t slot, tribool value);
+
+/**
+ * @brief Reads one slot.
+ * @param t The table to read.
+ * @param slot Slot index; UNKNOWN is returned when out of range.
+ * @param policy How to resolve a conflicting slot.
+ * @return The resolved value.
+ */
+tribool fossil_type_tribool_table_get(const tribool_table *t, size_t slot, fossil_type_tribool_conflict policy);
+
+/**
+ * @brief Tells whether both TRUE and FALSE were observed for a slot.
+ */
+int fossil_type_tribool_table_is_conflict(const tribool_table *t, size_t slot);
+
+/**
+ * @brief Counts the conflicting slots.
+ */
+size_t fossil_type_tribool_table_count_conflicts(const tribool_table *t);
+
+/* ======================================================
+ * Bulk Operations
+ * ====================================================== */
+
+/**
+ * @brief Joins a replica into dst, growing dst to the longer length.
+ * @param dst The local replica.
+ * @param src The replica to merge in; may be dst.
+ * @param conflicts Optional; receives the number of slots that became conflicting.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_table_merge(tribool_table *dst, const tribool_table *src, size_t *conflicts);
+
+/**
+ * @brief Records every TRUE/FALSE lane of a vector as an observation of the same slot.
+ * @param t The table to update; grown to the vector length if shorter.
+ * @param v The observed values; UNKNOWN lanes record nothing.
+ * @param conflicts Optional; receives the number of slots that became conflicting.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_table_observe_vec(tribool_table *t, const tribool_vec *v, size_t *conflicts);
+
+/**
+ * @brief Resolves every slot into a packed vector.
+ * @param dst Resized to the table length.
+ * @param t The table to read.
+ * @param policy How to resolve conflicting slots.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_table_resolve(tribool_vec *dst, const tribool_table *t, fossil_type_tribool_conflict policy);
+
+/* ======================================================
+ * Deltas
+ * ====================================================== */
+
+/**
+ * @brief Initializes an empty delta.
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int fossil_type_tribool_delta_init(tribool_delta *d);
+
+/**
+ * @brief Releases the delta storage and leaves it empty.
+ * @param d The delta to free; NULL is ignored.
+ */
+void fossil_type_tribool_delta_free(tribool_delta *d);
+
+/**
+ * @brief Encodes the observations newer holds and older lacks.
+ * @param d Receives the delta, replacing its contents.
+ * @param newer The sending replica.
+ * @param older What the receiver is known to hold, or NULL for a full state transfer.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_table_diff(tribool_delta *d, const tribool_table *newer, const tribool_table *older);
+
+/**
+ * @brief Joins a delta into a replica. Applying a delta twice changes nothing.
+ * @param t The receiving replica; grown to the sender length if shorter.
+ * @param d The encoded delta; rejected as a whole if malformed.
+ * @param conflicts Optional; receives the number of slots that became conflicting.
+ * @return 0 on success, -1 on invalid arguments, a malformed delta or allocation failure.
+ */
+int fossil_type_tribool_table_apply(tribool_table *t, const tribool_delta *d, size_t *conflicts);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class TriboolDelta {
+    tribool_delta d;
+
+public:
+    TriboolDelta() { fossil_type_tribool_delta_init(&d); }
+    TriboolDelta(const TriboolDelta&) = delete;
+    TriboolDelta& operator=(const TriboolDelta&) = delete;
+    ~TriboolDelta() { fossil_type_tribool_delta_free(&d); }
+
+    /**
+     * @brief Returns the encoded size in bytes.
+     */
+    size_t size() const { return d.size; }
+
+    tribool_delta* raw() { return &d; }
+    const tribool_delta* raw() const { return &d; }
+};
+
+class TriboolTable {
+    tribool_table t;
+
+public:
+    using Conflict = fossil_type_tribool_conflict;
+
+    /**
+     * @brief Constructs a table of the given length with nothing observed.
+     */
+    explicit TriboolTable(size_t length = 0) : t{nullptr, 0} { fossil_type_tribool_table_init(&t, length); }
+    TriboolTable(const TriboolTable&) = delete;
+    TriboolTable& operator=(const TriboolTable&) = delete;
+    ~TriboolTable() { fossil_type_tribool_table_free(&t); }
+
+    size_t size() const { return t.length; }
+
+    bool observe(size_t slot, Tribool value) { return fossil_type_tribool_table_observe(&t, slot, value) == 0; }
+
+    Tribool get(size_t slot, Conflict policy = FOSSIL_TYPE_TRIBOOL_CONFLICT_UNKNOWN) const {
+        return Tribool(fossil_type_tribool_table_get(&t, slot, policy));
+    }
+
+    bool is_conflict(size_t slot) const { return fossil_type_tribool_table_is_conflict(&t, slot) != 0; }
+    size_t count_conflicts() const { return fossil_type_tribool_table_count_conflicts(&t); }
+
+    /**
+     * @brief Joins another replica; returns the number of new conflicts, or NPOS on failure.
+     */
+    size_t merge(const TriboolTable& other) {
+        size_t conflicts = 0;
+        if (fossil_type_tribool_table_merge(&t, &other.t, &conflicts) != 0) return FOSSIL_TYPE_TRIBOOL_NPOS;
+        return conflicts;
+    }
+
+    /**
+     * @brief Encodes what this replica holds beyond older (everything when null).
+     */
+    bool diff(TriboolDelta& out, const TriboolTable* older = nullptr) const {
+        return fossil_type_tribool_table_diff(out.raw(), &t, older ? &older->t : nullptr) == 0;
+    }
+
+    /**
+     * @brief Joins a delta; returns the number of new conflicts, or NPOS if rejected.
+     */
+    size_t apply(const TriboolDelta& delta) {
+        size_t conflicts = 0;
+        if (fossil_type_tribool_table_apply(&t, delta.raw(), &conflicts) != 0) return FOSSIL_TYPE_TRIBOOL_NPOS;
+        return conflicts;
+    }
+
+    /**
+     * @brief Resolves every slot into a packed vector.
+     */
+    TriboolVec resolve(Conflict policy = FOSSIL_TYPE_TRIBOOL_CONFLICT_UNKNOWN) const {
+        TriboolVec out;
+        if (fossil_type_tribool_table_resolve(out.raw(), &t, policy) != 0) return TriboolVec();
+        return out;
+    }
+
+    tribool_table* raw() { return &t; }
+    const tribool_table* raw() const { return &t; }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
@@ -0,0 +1,181 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_TRIT_H
+#define FOSSIL_TYPE_TRIBOOL_TRIT_H
+
+#include "tribool.h"
+#include "tribool_vec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Format
+ *
+ * Tribools are stored as base-3 digits (trits), five per
+ * byte: value i of a group contributes d * 3^i, with d the
+ * enum value (0 FALSE, 1 TRUE, 2 UNKNOWN). Bytes are in
+ * [0, 242]; unused trits of the last byte are 0. The byte
+ * stream does not record its length, so callers keep the
+ * value count alongside it.
+ * ====================================================== */
+
+/** Number of tribools held by one encoded byte. */
+#define FOSSIL_TYPE_TRIT_PER_BYTE 5
+
+/** Number of encoded bytes needed for n tribools. */
+#define FOSSIL_TYPE_TRIT_BYTES(n) \
+    (((n) + FOSSIL_TYPE_TRIT_PER_BYTE - 1) / FOSSIL_TYPE_TRIT_PER_BYTE)
+
+/* ======================================================
+ * Arrays
+ * ====================================================== */
+
+/**
+ * @brief Encodes tribools as trits. Values other than TRUE/FALSE encode UNKNOWN.
+ * @param dst Output with room for FOSSIL_TYPE_TRIT_BYTES(count) bytes.
+ * @param src Array of count tribools.
+ * @param count Number of values to encode.
+ * @return Number of bytes written, 0 on invalid arguments.
+ */
+size_t fossil_type_tribool_trit_encode(uint8_t *dst, const tribool *src, size_t count);
+
+/**
+ * @brief Decodes trits back to tribools.
+ * @param dst Output array with room for count tribools.
+ * @param src Encoded stream of at least FOSSIL_TYPE_TRIT_BYTES(count) bytes.
+ * @param count Number of values to decode.
+ * @return 0 on success, -1 on invalid arguments or a byte above 242
+ *         (dst is then partially written).
+ */
+int fossil_type_tribool_trit_decode(tribool *dst, const uint8_t *src, size_t count);
+
+/**
+ * @brief Encodes one-byte tribools as trits. Bytes other than 0/1 encode UNKNOWN.
+ * @param dst Output with room for FOSSIL_TYPE_TRIT_BYTES(count) bytes.
+ * @param src Array of count one-byte tribools.
+ * @param count Number of values to encode.
+ * @return Number of bytes written, 0 on invalid arguments.
+ */
+size_t fossil_type_tribool8_trit_encode(uint8_t *dst, const tribool8 *src, size_t count);
+
+/**
+ * @brief Decodes trits to one-byte tribools.
+ * @param dst Output array with room for count bytes.
+ * @param src Encoded stream of at least FOSSIL_TYPE_TRIT_BYTES(count) bytes.
+ * @param count Number of values to decode.
+ * @return 0 on success, -1 on invalid arguments or a byte above 242.
+ */
+int fossil_type_tribool8_trit_decode(tribool8 *dst, const uint8_t *src, size_t count);
+
+/* ======================================================
+ * Packed vectors
+ * ====================================================== */
+
+/**
+ * @brief Encodes a packed vector as trits, five lanes per table step.
+ * @param dst Output with room for FOSSIL_TYPE_TRIT_BYTES(length) bytes.
+ * @param v The vector to encode.
+ * @return Number of bytes written, 0 on invalid arguments.
+ */
+size_t fossil_type_tribool_vec_trit_encode(uint8_t *dst, const tribool_vec *v);
+
+/**
+ * @brief Decodes trits into a packed vector, resizing it to count.
+ * @param v The destination vector.
+ * @param src Encoded stream of at least FOSSIL_TYPE_TRIT_BYTES(count) bytes.
+ * @param count Number of values to decode.
+ * @return 0 on success, -1 on invalid arguments, allocation failure or a
+ *         byte above 242.
+ */
+int fossil_type_tribool_vec_trit_decode(tribool_vec *v, const uint8_t *src, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+#include <span>
+#include <vector>
+
+namespace fossil::type {
+
+class TritCodec {
+public:
+    /**
+     * @brief Number of encoded bytes needed for count tribools.
+     */
+    static constexpr size_t encoded_size(size_t count) { return FOSSIL_TYPE_TRIT_BYTES(count); }
+
+    /**
+     * @brief Encodes a span of Tribool.
+     */
+    static std::vector<uint8_t> encode(std::span<const Tribool> values) {
+        std::vector<uint8_t> out(encoded_size(values.size()));
+        fossil_type_tribool_trit_encode(out.data(), reinterpret_cast<const tribool*>(values.data()),
+                                        values.size());
+        return out;
+    }
+
+    /**
+     * @brief Encodes a packed vector.
+     */
+    static std::vector<uint8_t> encode(const TriboolVec& v) {
+        std::vector<uint8_t> out(encoded_size(v.size()));
+        fossil_type_tribool_vec_trit_encode(out.data(), v.raw());
+        return out;
+    }
+
+    /**
+     * @brief Decodes into dst; the value count is dst.size().
+     * @return false if src is too short or holds an invalid byte.
+     */
+    static bool decode(std::span<Tribool> dst, std::span<const uint8_t> src) {
+        if (src.size() < encoded_size(dst.size())) return false;
+        return fossil_type_tribool_trit_decode(reinterpret_cast<tribool*>(dst.data()), src.data(),
+                                               dst.size()) == 0;
+    }
+
+    /**
+     * @brief Decodes count values into a packed vector.
+     * @return false if src is too short or holds an invalid byte.
+     */
+    static bool decode(TriboolVec& v, std::span<const uint8_t> src, size_t count) {
+        if (src.size() < encoded_size(count)) return false;
+        return fossil_type_tribool_vec_trit_decode(v.raw(), src.data(), count) == 0;
+    }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
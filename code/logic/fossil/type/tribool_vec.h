@@ -0,0 +1,622 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TRIBOOL_VEC_H
+#define FOSSIL_TYPE_TRIBOOL_VEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tribool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ======================================================
+ * Type Definition
+ *
+ * Tribools packed at 2 bits per value, 32 values per
+ * 64-bit word. Each lane holds the enum value directly:
+ *     00 = FALSE, 01 = TRUE, 10 = UNKNOWN
+ * Lane i lives in bits [2*(i%32), 2*(i%32)+1] of word i/32.
+ * Lanes past the length are kept at zero.
+ * ====================================================== */
+
+typedef struct fossil_type_tribool_vec {
+    uint64_t *words;
+    size_t length;
+} fossil_type_tribool_vec;
+
+typedef fossil_type_tribool_vec tribool_vec;
+
+/** Number of tribools stored in one packed word. */
+#define FOSSIL_TYPE_TRIBOOL_VEC_LANES 32
+
+/** Number of packed words needed to hold n tribools. */
+#define FOSSIL_TYPE_TRIBOOL_VEC_WORDS(n) \
+    (((n) + FOSSIL_TYPE_TRIBOOL_VEC_LANES - 1) / FOSSIL_TYPE_TRIBOOL_VEC_LANES)
+
+/* ======================================================
+ * Lifetime
+ * ====================================================== */
+
+/**
+ * @brief Initializes a packed vector of the given length, all UNKNOWN.
+ * @param v The vector to initialize.
+ * @param length Number of tribools to hold.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_vec_init(tribool_vec *v, size_t length);
+
+/**
+ * @brief Releases the storage owned by a packed vector.
+ * @param v The vector to release. Left empty and reusable.
+ */
+void fossil_type_tribool_vec_free(tribool_vec *v);
+
+/**
+ * @brief Changes the length of a packed vector. New lanes are UNKNOWN.
+ * @param v The vector to resize.
+ * @param length The new number of tribools.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_vec_resize(tribool_vec *v, size_t length);
+
+/**
+ * @brief Makes dst an exact copy of src.
+ * @param dst The destination vector, resized as needed.
+ * @param src The source vector.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_vec_copy(tribool_vec *dst, const tribool_vec *src);
+
+/* ======================================================
+ * Element Access
+ * ====================================================== */
+
+/**
+ * @brief Returns the number of tribools in the vector.
+ * @param v The vector to query.
+ * @return The vector length, or 0 if v is NULL.
+ */
+size_t fossil_type_tribool_vec_length(const tribool_vec *v);
+
+/**
+ * @brief Reads one tribool.
+ * @param v The vector to read from.
+ * @param index Position of the value.
+ * @return The stored value, or UNKNOWN when index is out of range.
+ */
+tribool fossil_type_tribool_vec_get(const tribool_vec *v, size_t index);
+
+/**
+ * @brief Writes one tribool. Values other than TRUE/FALSE store UNKNOWN.
+ * @param v The vector to write to.
+ * @param index Position of the value; ignored when out of range.
+ * @param t The value to store.
+ */
+void fossil_type_tribool_vec_set(tribool_vec *v, size_t index, tribool t);
+
+/**
+ * @brief Sets every element of the vector to the same value.
+ * @param v The vector to fill.
+ * @param t The value to store.
+ */
+void fossil_type_tribool_vec_fill(tribool_vec *v, tribool t);
+
+/**
+ * @brief Packs an array of tribools into the vector, resizing it to count.
+ * @param v The destination vector.
+ * @param src Array of count tribools.
+ * @param count Number of values to pack.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_vec_pack(tribool_vec *v, const tribool *src, size_t count);
+
+/**
+ * @brief Unpacks the vector into an array of tribools.
+ * @param v The source vector.
+ * @param dst Array with room for fossil_type_tribool_vec_length(v) values.
+ */
+void fossil_type_tribool_vec_unpack(const tribool_vec *v, tribool *dst);
+
+/* ======================================================
+ * Logic
+ * ====================================================== */
+
+/**
+ * @brief Element-wise Kleene AND of two vectors. dst may alias a or b.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_and(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise Kleene OR of two vectors. dst may alias a or b.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_or(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise Kleene NOT of a vector. dst may alias a.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The operand.
+ * @return 0 on success, -1 on invalid arguments or allocation failure.
+ */
+int fossil_type_tribool_vec_not(tribool_vec *dst, const tribool_vec *a);
+
+/* ======================================================
+ * Derived Connectives
+ *
+ * Element-wise versions of the scalar connectives in
+ * tribool.h, one pass over the packed words each. dst may
+ * alias a or b.
+ * ====================================================== */
+
+/**
+ * @brief Element-wise Kleene XOR.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_xor(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise Kleene implication a -> b.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_implies(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise Kleene equivalence.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_equiv(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise Lukasiewicz XOR.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_luk_xor(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise Lukasiewicz implication a -> b.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_luk_implies(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise Lukasiewicz equivalence.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_luk_equiv(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise knowledge-ordering consensus.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_consensus(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise knowledge-ordering merge.
+ * @param dst The result vector, resized to the operand length.
+ * @param a The first operand.
+ * @param b The second operand; must have the same length as a.
+ * @return 0 on success, -1 on length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_merge(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b);
+
+/**
+ * @brief Element-wise Kleene "at least k of the inputs are TRUE".
+ *        Lanes are counted with bit-sliced adders, 32 rows per word.
+ * @param dst The result vector, resized to the input length; may alias an input.
+ * @param inputs Vectors of equal length.
+ * @param count Number of inputs, at least one.
+ * @param k Required number of TRUE inputs.
+ * @return 0 on success, -1 on invalid arguments, length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_threshold(tribool_vec *dst, const tribool_vec *const *inputs, size_t count, size_t k);
+
+/**
+ * @brief Element-wise Kleene strict majority, threshold with k = count / 2 + 1.
+ * @param dst The result vector, resized to the input length; may alias an input.
+ * @param inputs Vectors of equal length.
+ * @param count Number of inputs, at least one.
+ * @return 0 on success, -1 on invalid arguments, length mismatch or allocation failure.
+ */
+int fossil_type_tribool_vec_majority(tribool_vec *dst, const tribool_vec *const *inputs, size_t count);
+
+/* ======================================================
+ * Reductions
+ *
+ * Counts use popcount over whole words; all/any stop at
+ * the first word holding a decisive value.
+ * ====================================================== */
+
+/**
+ * @brief Kleene AND over every element; an empty vector yields TRUE.
+ * @param v The vector to reduce.
+ * @return FALSE if any is FALSE, else UNKNOWN if any is UNKNOWN, else TRUE.
+ */
+tribool fossil_type_tribool_vec_all(const tribool_vec *v);
+
+/**
+ * @brief Kleene OR over every element; an empty vector yields FALSE.
+ * @param v The vector to reduce.
+ * @return TRUE if any is TRUE, else UNKNOWN if any is UNKNOWN, else FALSE.
+ */
+tribool fossil_type_tribool_vec_any(const tribool_vec *v);
+
+/**
+ * @brief Negated Kleene OR over every element.
+ * @param v The vector to reduce.
+ * @return NOT fossil_type_tribool_vec_any(v).
+ */
+tribool fossil_type_tribool_vec_none(const tribool_vec *v);
+
+/**
+ * @brief Counts the TRUE elements.
+ * @param v The vector to scan.
+ * @return Number of TRUE elements.
+ */
+size_t fossil_type_tribool_vec_count_true(const tribool_vec *v);
+
+/**
+ * @brief Counts the FALSE elements.
+ * @param v The vector to scan.
+ * @return Number of FALSE elements.
+ */
+size_t fossil_type_tribool_vec_count_false(const tribool_vec *v);
+
+/**
+ * @brief Counts the UNKNOWN elements.
+ * @param v The vector to scan.
+ * @return Number of UNKNOWN elements.
+ */
+size_t fossil_type_tribool_vec_count_unknown(const tribool_vec *v);
+
+/**
+ * @brief Finds the first UNKNOWN element.
+ * @param v The vector to scan.
+ * @return Its index, or FOSSIL_TYPE_TRIBOOL_NPOS.
+ */
+size_t fossil_type_tribool_vec_find_first_unknown(const tribool_vec *v);
+
+/* ======================================================
+ * Word Kernels
+ *
+ * Raw kernels over packed words, for callers that manage
+ * their own storage. Lanes must hold 00, 01 or 10; padding
+ * lanes are not cleared. Outputs may alias inputs.
+ * ====================================================== */
+
+/**
+ * @brief Kleene AND over nwords packed words.
+ * @param dst Output words.
+ * @param a First operand words.
+ * @param b Second operand words.
+ * @param nwords Number of 64-bit words to process.
+ */
+void fossil_type_tribool_words_and(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t nwords);
+
+/**
+ * @brief Kleene OR over nwords packed words.
+ * @param dst Output words.
+ * @param a First operand words.
+ * @param b Second operand words.
+ * @param nwords Number of 64-bit words to process.
+ */
+void fossil_type_tribool_words_or(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t nwords);
+
+/**
+ * @brief Kleene NOT over nwords packed words.
+ * @param dst Output words.
+ * @param a Operand words.
+ * @param nwords Number of 64-bit words to process.
+ */
+void fossil_type_tribool_words_not(uint64_t *dst, const uint64_t *a, size_t nwords);
+
+/**
+ * @brief Names the kernel family selected for this machine.
+ * @return One of "avx2", "sse2", "neon" or "scalar".
+ */
+const char *fossil_type_tribool_vec_kernel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/* ======================================================
+ * C++ Wrapper
+ * ====================================================== */
+#ifdef __cplusplus
+
+namespace fossil::type {
+
+class TriboolVec {
+    tribool_vec v;
+
+public:
+    /**
+     * @brief Constructs a vector of the given length, all UNKNOWN.
+     * @param length Number of tribools to hold.
+     */
+    explicit TriboolVec(size_t length = 0) : v{nullptr, 0} {
+        fossil_type_tribool_vec_init(&v, length);
+    }
+
+    /**
+     * @brief Copy constructor. Duplicates the packed storage.
+     */
+    TriboolVec(const TriboolVec& other) : v{nullptr, 0} {
+        fossil_type_tribool_vec_copy(&v, &other.v);
+    }
+
+    /**
+     * @brief Move constructor. Takes ownership of the packed storage.
+     */
+    TriboolVec(TriboolVec&& other) noexcept : v(other.v) {
+        other.v.words = nullptr;
+        other.v.length = 0;
+    }
+
+    /**
+     * @brief Copy assignment. Duplicates the packed storage.
+     */
+    TriboolVec& operator=(const TriboolVec& other) {
+        if (this != &other) fossil_type_tribool_vec_copy(&v, &other.v);
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment. Takes ownership of the packed storage.
+     */
+    TriboolVec& operator=(TriboolVec&& other) noexcept {
+        if (this != &other) {
+            fossil_type_tribool_vec_free(&v);
+            v = other.v;
+            other.v.words = nullptr;
+            other.v.length = 0;
+        }
+        return *this;
+    }
+
+    ~TriboolVec() { fossil_type_tribool_vec_free(&v); }
+
+    /**
+     * @brief Returns the number of tribools in the vector.
+     */
+    size_t size() const { return fossil_type_tribool_vec_length(&v); }
+
+    /**
+     * @brief Reads one element; UNKNOWN when out of range.
+     */
+    Tribool get(size_t index) const { return Tribool(fossil_type_tribool_vec_get(&v, index)); }
+
+    /**
+     * @brief Writes one element; ignored when out of range.
+     */
+    void set(size_t index, Tribool t) { fossil_type_tribool_vec_set(&v, index, t); }
+
+    /**
+     * @brief Sets every element to the same value.
+     */
+    void fill(Tribool t) { fossil_type_tribool_vec_fill(&v, t); }
+
+    /**
+     * @brief Kleene AND over every element.
+     */
+    Tribool all() const { return Tribool(fossil_type_tribool_vec_all(&v)); }
+
+    /**
+     * @brief Kleene OR over every element.
+     */
+    Tribool any() const { return Tribool(fossil_type_tribool_vec_any(&v)); }
+
+    /**
+     * @brief Negated Kleene OR over every element.
+     */
+    Tribool none() const { return Tribool(fossil_type_tribool_vec_none(&v)); }
+
+    /**
+     * @brief Counts the TRUE elements.
+     */
+    size_t count_true() const { return fossil_type_tribool_vec_count_true(&v); }
+
+    /**
+     * @brief Counts the FALSE elements.
+     */
+    size_t count_false() const { return fossil_type_tribool_vec_count_false(&v); }
+
+    /**
+     * @brief Counts the UNKNOWN elements.
+     */
+    size_t count_unknown() const { return fossil_type_tribool_vec_count_unknown(&v); }
+
+    /**
+     * @brief Finds the first UNKNOWN element, or FOSSIL_TYPE_TRIBOOL_NPOS.
+     */
+    size_t find_first_unknown() const { return fossil_type_tribool_vec_find_first_unknown(&v); }
+
+    /**
+     * @brief Element-wise logical NOT.
+     * @return A new vector holding the result.
+     */
+    TriboolVec operator!() const {
+        TriboolVec r;
+        fossil_type_tribool_vec_not(&r.v, &v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise logical AND.
+     * @param rhs The right-hand side operand, same length as this vector.
+     * @return A new vector holding the result, empty on length mismatch.
+     */
+    TriboolVec operator&&(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_and(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise logical OR.
+     * @param rhs The right-hand side operand, same length as this vector.
+     * @return A new vector holding the result, empty on length mismatch.
+     */
+    TriboolVec operator||(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_or(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise Kleene XOR.
+     * @return A new vector holding the result.
+     */
+    TriboolVec operator^(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_xor(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise Kleene implication a -> b.
+     */
+    TriboolVec implies(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_implies(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise Kleene equivalence.
+     */
+    TriboolVec equiv(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_equiv(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise Kleene "at least k of the inputs are TRUE"; empty on mismatch.
+     */
+    static TriboolVec threshold(std::span<const tribool_vec* const> inputs, size_t k) {
+        TriboolVec r;
+        if (fossil_type_tribool_vec_threshold(&r.v, inputs.data(), inputs.size(), k) != 0) return TriboolVec();
+        return r;
+    }
+
+    /**
+     * @brief Element-wise Kleene strict majority; empty on mismatch.
+     */
+    static TriboolVec majority(std::span<const tribool_vec* const> inputs) {
+        TriboolVec r;
+        if (fossil_type_tribool_vec_majority(&r.v, inputs.data(), inputs.size()) != 0) return TriboolVec();
+        return r;
+    }
+
+    /**
+     * @brief Element-wise Lukasiewicz XOR.
+     */
+    TriboolVec luk_xor(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_luk_xor(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise Lukasiewicz implication a -> b.
+     */
+    TriboolVec luk_implies(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_luk_implies(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise Lukasiewicz equivalence.
+     */
+    TriboolVec luk_equiv(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_luk_equiv(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise knowledge-ordering consensus.
+     */
+    TriboolVec consensus(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_consensus(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Element-wise knowledge-ordering merge.
+     */
+    TriboolVec merge(const TriboolVec& rhs) const {
+        TriboolVec r;
+        fossil_type_tribool_vec_merge(&r.v, &v, &rhs.v);
+        return r;
+    }
+
+    /**
+     * @brief Access to the underlying C vector.
+     */
+    tribool_vec* raw() { return &v; }
+    const tribool_vec* raw() const { return &v; }
+};
+
+} // namespace fossil::type
+
+#endif
+
+#endif
@@ -0,0 +1,318 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/infer.h"
+#include "simd.h"
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+
+/* ======================================================
+ * Partial summaries
+ *
+ * A scan folds its values into a partial: the integer
+ * range (unsigned values biased by their sign bit so one
+ * signed min/max serves both), the float range with NaN
+ * skipped, and flags for what rules types out. Chunks are
+ * scanned into separate partials and merged, so a
+ * multithreaded scan gives the same answer as a serial one.
+ * ====================================================== */
+
+#define INFER_SIGN 0x8000000000000000ULL
+
+enum {
+    INFER_NONINT    = 1u, /* A value has a fractional part, or is NaN (or infinite, on some paths). */
+    INFER_NONFINITE = 2u, /* A value is NaN or infinite. */
+    INFER_WIDE      = 4u  /* A value changes when rounded to float. */
+};
+
+enum { INFER_I64, INFER_U64, INFER_F64 };
+
+typedef struct infer_partial {
+    int64_t min, max;
+    double fmin, fmax;
+    unsigned flags;
+} infer_partial;
+
+static void partial_reset(infer_partial *p) {
+    p->min = INT64_MAX;
+    p->max = INT64_MIN;
+    p->fmin = HUGE_VAL;
+    p->fmax = -HUGE_VAL;
+    p->flags = 0;
+}
+
+static void partial_merge(infer_partial *dst, const infer_partial *src) {
+    if (src->min < dst->min) dst->min = src->min;
+    if (src->max > dst->max) dst->max = src->max;
+    if (src->fmin < dst->fmin) dst->fmin = src->fmin;
+    if (src->fmax > dst->fmax) dst->fmax = src->fmax;
+    dst->flags |= src->flags;
+}
+
+/* ======================================================
+ * Scalar kernels
+ * ====================================================== */
+
+static void scan_int_scalar(const uint64_t *p, size_t n, uint64_t flip, infer_partial *acc) {
+    int64_t lo = acc->min, hi = acc->max;
+    for (size_t i = 0; i < n; i++) {
+        int64_t v = (int64_t)(p[i] ^ flip);
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+    }
+    acc->min = lo;
+    acc->max = hi;
+}
+
+static void scan_f64_scalar(const double *p, size_t n, infer_partial *acc) {
+    for (size_t i = 0; i < n; i++) {
+        double x = p[i], a = fabs(x);
+        if (x == x) {
+            if (x < acc->fmin) acc->fmin = x;
+            if (x > acc->fmax) acc->fmax = x;
+        }
+        /* Doubles of magnitude 2^52 and up have no fraction bits; below that the int64 round trip is exact. */
+        if (!(a < 4503599627370496.0 ? (double)(int64_t)x == x : a < HUGE_VAL)) acc->flags |= INFER_NONINT;
+        if (!(a < HUGE_VAL)) acc->flags |= INFER_NONFINITE;
+        /* Converting a double beyond FLT_MAX to float is undefined in C, so test the range first. */
+        if (a <= FLT_MAX ? (double)(float)x != x : a < HUGE_VAL) acc->flags |= INFER_WIDE;
+    }
+}
+
+typedef struct infer_kernels {
+    void (*scan_int)(const uint64_t *, size_t, uint64_t, infer_partial *);
+    void (*scan_f64)(const double *, size_t, infer_partial *);
+} infer_kernels;
+
+/* ======================================================
+ * AVX2 kernels
+ * ====================================================== */
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+FOSSIL_TYPE_TARGET_AVX2
+static void scan_int_avx2(const uint64_t *p, size_t n, uint64_t flip, infer_partial *acc) {
+    const __m256i f = _mm256_set1_epi64x((long long)flip);
+    __m256i lo = _mm256_set1_epi64x((long long)acc->min), hi = _mm256_set1_epi64x((long long)acc->max);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(const void *)(p + i)), f);
+        lo = _mm256_blendv_epi8(lo, x, _mm256_cmpgt_epi64(lo, x));
+        hi = _mm256_blendv_epi8(hi, x, _mm256_cmpgt_epi64(x, hi));
+    }
+    int64_t l[4], h[4];
+    _mm256_storeu_si256((__m256i *)(void *)l, lo);
+    _mm256_storeu_si256((__m256i *)(void *)h, hi);
+    for (int k = 0; k < 4; k++) {
+        if (l[k] < acc->min) acc->min = l[k];
+        if (h[k] > acc->max) acc->max = h[k];
+    }
+    scan_int_scalar(p + i, n - i, flip, acc);
+}
+
+/*
+ * min/max return their second operand when the first is NaN,
+ * so NaN lanes leave the running range alone. Overflow in the
+ * float round trip yields infinity, which fails the compare.
+ */
+FOSSIL_TYPE_TARGET_AVX2
+static void scan_f64_avx2(const double *p, size_t n, infer_partial *acc) {
+    const __m256d inf = _mm256_set1_pd(HUGE_VAL);
+    const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    __m256d mn = _mm256_set1_pd(acc->fmin), mx = _mm256_set1_pd(acc->fmax);
+    __m256d nonint = _mm256_setzero_pd(), nonfinite = _mm256_setzero_pd(), wide = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(p + i);
+        mn = _mm256_min_pd(x, mn);
+        mx = _mm256_max_pd(x, mx);
+        __m256d t = _mm256_round_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        nonint = _mm256_or_pd(nonint, _mm256_cmp_pd(t, x, _CMP_NEQ_UQ));
+        nonfinite = _mm256_or_pd(nonfinite, _mm256_cmp_pd(_mm256_and_pd(x, abs_mask), inf, _CMP_NLT_UQ));
+        __m256d r = _mm256_cvtps_pd(_mm256_cvtpd_ps(x));
+        wide = _mm256_or_pd(wide, _mm256_cmp_pd(r, x, _CMP_NEQ_OQ));
+    }
+    double l[4], h[4];
+    _mm256_storeu_pd(l, mn);
+    _mm256_storeu_pd(h, mx);
+    for (int k = 0; k < 4; k++) {
+        if (l[k] < acc->fmin) acc->fmin = l[k];
+        if (h[k] > acc->fmax) acc->fmax = h[k];
+    }
+    if (_mm256_movemask_pd(nonint)) acc->flags |= INFER_NONINT;
+    if (_mm256_movemask_pd(nonfinite)) acc->flags |= INFER_NONFINITE;
+    if (_mm256_movemask_pd(wide)) acc->flags |= INFER_WIDE;
+    scan_f64_scalar(p + i, n - i, acc);
+}
+
+#endif
+
+static infer_kernels select_kernels(void) {
+    infer_kernels k = { scan_int_scalar, scan_f64_scalar };
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) {
+        k.scan_int = scan_int_avx2;
+        k.scan_f64 = scan_f64_avx2;
+    }
+#endif
+    return k;
+}
+
+static void infer_scan(int mode, const void *src, size_t begin, size_t end, infer_partial *acc) {
+    infer_kernels k = select_kernels();
+    if (mode == INFER_F64) k.scan_f64((const double *)src + begin, end - begin, acc);
+    else k.scan_int((const uint64_t *)src + begin, end - begin, mode == INFER_U64 ? INFER_SIGN : 0, acc);
+}
+
+/* ======================================================
+ * Recommendation
+ * ====================================================== */
+
+/* Integer candidates from narrowest to widest, unsigned first. */
+static const fossil_type_limits_kind infer_ladder[] = {
+    FOSSIL_TYPE_KIND_U8,  FOSSIL_TYPE_KIND_I8,
+    FOSSIL_TYPE_KIND_U16, FOSSIL_TYPE_KIND_I16,
+    FOSSIL_TYPE_KIND_U32, FOSSIL_TYPE_KIND_I32,
+    FOSSIL_TYPE_KIND_U64, FOSSIL_TYPE_KIND_I64,
+};
+
+/*
+ * Every candidate range contains 0, so a column fits when
+ * its negative end and its positive end do; lo is the
+ * minimum clamped up to 0 and hi the maximum clamped down.
+ */
+static fossil_type_limits_kind infer_int_kind(int64_t lo, uint64_t hi) {
+    for (size_t i = 0; i < sizeof(infer_ladder) / sizeof(infer_ladder[0]); i++) {
+        const fossil_type_limits *l = fossil_type_limits_get_by_kind(infer_ladder[i]);
+        if (fossil_type_limits_fits_i64(l, lo) && fossil_type_limits_fits_u64(l, hi)) return infer_ladder[i];
+    }
+    return FOSSIL_TYPE_KIND_COUNT;
+}
+
+static void infer_finish(int mode, size_t count, const infer_partial *acc, fossil_type_infer_result *out) {
+    fossil_type_limits_kind kind = FOSSIL_TYPE_KIND_U8;
+    out->integral = true;
+
+    if (mode == INFER_I64) {
+        out->min.i64 = count ? acc->min : 0;
+        out->max.i64 = count ? acc->max : 0;
+        kind = infer_int_kind(out->min.i64 < 0 ? out->min.i64 : 0,
+                              out->max.i64 > 0 ? (uint64_t)out->max.i64 : 0);
+    } else if (mode == INFER_U64) {
+        out->min.u64 = count ? (uint64_t)acc->min ^ INFER_SIGN : 0;
+        out->max.u64 = count ? (uint64_t)acc->max ^ INFER_SIGN : 0;
+        kind = infer_int_kind(0, out->max.u64);
+    } else if (count == 0) {
+        out->min.f64 = 0.0;
+        out->max.f64 = 0.0;
+    } else {
+        int has_value = acc->fmin <= acc->fmax;
+        out->min.f64 = has_value ? acc->fmin : NAN;
+        out->max.f64 = has_value ? acc->fmax : NAN;
+        out->integral = !(acc->flags & (INFER_NONINT | INFER_NONFINITE));
+
+        fossil_type_limits_kind int_kind = FOSSIL_TYPE_KIND_COUNT;
+        if (out->integral && acc->fmin >= -9223372036854775808.0 && acc->fmax < 18446744073709551616.0) {
+            int_kind = infer_int_kind(acc->fmin < 0 ? (int64_t)acc->fmin : 0,
+                                      acc->fmax > 0 ? (uint64_t)acc->fmax : 0);
+        }
+        size_t float_size = (acc->flags & INFER_WIDE) ? sizeof(double) : sizeof(float);
+        if (int_kind != FOSSIL_TYPE_KIND_COUNT &&
+            fossil_type_limits_get_by_kind(int_kind)->size <= float_size) {
+            kind = int_kind;
+        } else {
+            kind = (acc->flags & INFER_WIDE) ? FOSSIL_TYPE_KIND_F64 : FOSSIL_TYPE_KIND_F32;
+        }
+    }
+
+    out->kind = kind;
+    out->type_id = fossil_type_limits_get_by_kind(kind)->type_id;
+}
+
+/* ======================================================
+ * Drivers
+ * ====================================================== */
+
+typedef struct infer_job {
+    int mode;
+    const void *src;
+    infer_partial *parts;
+} infer_job;
+
+static void infer_chunk(void *ctx, size_t chunk, size_t begin, size_t end) {
+    infer_job *job = (infer_job *)ctx;
+    partial_reset(&job->parts[chunk]);
+    infer_scan(job->mode, job->src, begin, end, &job->parts[chunk]);
+}
+
+static int infer_run(tribool_pool *pool, int mode, const void *src, size_t count,
+                     fossil_type_infer_result *out) {
+    if (!out || (count && !src)) return -1;
+
+    infer_partial acc;
+    partial_reset(&acc);
+    size_t chunks = count ? (count - 1) / FOSSIL_TYPE_INFER_GRAIN + 1 : 0;
+    if (pool && pool->impl && chunks > 1) {
+        infer_job job = { mode, src, (infer_partial *)malloc(chunks * sizeof(infer_partial)) };
+        if (!job.parts) return -1;
+        if (fossil_type_tribool_pool_for(pool, count, FOSSIL_TYPE_INFER_GRAIN, infer_chunk, &job) != 0) {
+            free(job.parts);
+            return -1;
+        }
+        for (size_t c = 0; c < chunks; c++) partial_merge(&acc, &job.parts[c]);
+        free(job.parts);
+    } else {
+        infer_scan(mode, src, 0, count, &acc);
+    }
+    infer_finish(mode, count, &acc, out);
+    return 0;
+}
+
+int fossil_type_infer_i64(const int64_t *src, size_t count, fossil_type_infer_result *out) {
+    return infer_run(NULL, INFER_I64, src, count, out);
+}
+
+int fossil_type_infer_u64(const uint64_t *src, size_t count, fossil_type_infer_result *out) {
+    return infer_run(NULL, INFER_U64, src, count, out);
+}
+
+int fossil_type_infer_f64(const double *src, size_t count, fossil_type_infer_result *out) {
+    return infer_run(NULL, INFER_F64, src, count, out);
+}
+
+int fossil_type_infer_i64_par(tribool_pool *pool, const int64_t *src, size_t count,
+                              fossil_type_infer_result *out) {
+    return infer_run(pool, INFER_I64, src, count, out);
+}
+
+int fossil_type_infer_u64_par(tribool_pool *pool, const uint64_t *src, size_t count,
+                              fossil_type_infer_result *out) {
+    return infer_run(pool, INFER_U64, src, count, out);
+}
+
+int fossil_type_infer_f64_par(tribool_pool *pool, const double *src, size_t count,
+                              fossil_type_infer_result *out) {
+    return infer_run(pool, INFER_F64, src, count, out);
+}
@@ -23,6 +23,8 @@
  * -----------------------------------------------------------------------------
  */
 #include "fossil/type/limits.h"
+#include "fossil/type/registry.h"
+#include "fossil/type/tribool.h"
 #include <stdint.h>
 #include <stddef.h>
 #include <float.h>
@@ -70,16 +72,6 @@
 
 
 /* ---------------- Floating point (IEEE-754) ---------------- */
-/* These reflect bit-representation ranges, not decimal limits */
-
-#define FOSSIL_F32_BITS_MIN   FOSSIL_I32_MIN
-#define FOSSIL_F32_BITS_MAX   FOSSIL_I32_MAX
-
-#define FOSSIL_F64_BITS_MIN   FOSSIL_I64_MIN
-#define FOSSIL_F64_BITS_MAX   FOSSIL_I64_MAX
-
-
-/* Optional real-number semantic limits (IEEE-754) */
 
 #define FOSSIL_F32_MAX        3.402823466e+38F
 #define FOSSIL_F32_MIN_POS    1.175494351e-38F
@@ -116,70 +108,184 @@
 #define FOSSIL_CSTR_MIN   0
 #define FOSSIL_CSTR_MAX   0   /* variable-length, no fixed bound */
 
+/* char is signed or unsigned depending on the platform ABI. */
+#if CHAR_MIN < 0
+#  define FOSSIL_LIMITS_CHAR_SIGN FOSSIL_TYPE_LIMITS_SIGNED
+#else
+#  define FOSSIL_LIMITS_CHAR_SIGN 0u
+#endif
+
 /* ======================================================
  * Static limits table for all core Fossil types
  * ====================================================== */
 static const fossil_type_limits fossil_limits_table[] = {
 
     /* Signed integers */
-    {"i8",  FOSSIL_I8_MIN,  FOSSIL_I8_MAX,  sizeof(int8_t)},
-    {"i16", FOSSIL_I16_MIN, FOSSIL_I16_MAX, sizeof(int16_t)},
-    {"i32", FOSSIL_I32_MIN, FOSSIL_I32_MAX, sizeof(int32_t)},
-    {"i64", (long double)FOSSIL_I64_MIN, (long double)FOSSIL_I64_MAX, sizeof(int64_t)},
+    {"i8",  FOSSIL_I8_MIN,  FOSSIL_I8_MAX,  sizeof(int8_t),
+        FOSSIL_I8_MIN, FOSSIL_I8_MAX, FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_SIGNED},
+    {"i16", FOSSIL_I16_MIN, FOSSIL_I16_MAX, sizeof(int16_t),
+        FOSSIL_I16_MIN, FOSSIL_I16_MAX, FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_SIGNED},
+    {"i32", FOSSIL_I32_MIN, FOSSIL_I32_MAX, sizeof(int32_t),
+        FOSSIL_I32_MIN, FOSSIL_I32_MAX, FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_SIGNED},
+    {"i64", (long double)FOSSIL_I64_MIN, (long double)FOSSIL_I64_MAX, sizeof(int64_t),
+        FOSSIL_I64_MIN, FOSSIL_I64_MAX, FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_SIGNED},
 
     /* Unsigned integers */
-    {"u8", 0, FOSSIL_U8_MAX, sizeof(uint8_t)},
-    {"u16",0, FOSSIL_U16_MAX,sizeof(uint16_t)},
-    {"u32",0, FOSSIL_U32_MAX,sizeof(uint32_t)},
-    {"u64",0, (long double)FOSSIL_U64_MAX,sizeof(uint64_t)},
+    {"u8", 0, FOSSIL_U8_MAX, sizeof(uint8_t),
+        0, FOSSIL_U8_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"u16",0, FOSSIL_U16_MAX,sizeof(uint16_t),
+        0, FOSSIL_U16_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"u32",0, FOSSIL_U32_MAX,sizeof(uint32_t),
+        0, FOSSIL_U32_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"u64",0, (long double)FOSSIL_U64_MAX,sizeof(uint64_t),
+        0, FOSSIL_U64_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
 
     /* Hex aliases */
-    {"h8",  0, FOSSIL_U8_MAX,  sizeof(uint8_t)},
-    {"h16", 0, FOSSIL_U16_MAX, sizeof(uint16_t)},
-    {"h32", 0, FOSSIL_U32_MAX, sizeof(uint32_t)},
-    {"h64", 0, (long double)FOSSIL_U64_MAX, sizeof(uint64_t)},
+    {"h8",  0, FOSSIL_U8_MAX,  sizeof(uint8_t),
+        0, FOSSIL_U8_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"h16", 0, FOSSIL_U16_MAX, sizeof(uint16_t),
+        0, FOSSIL_U16_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"h32", 0, FOSSIL_U32_MAX, sizeof(uint32_t),
+        0, FOSSIL_U32_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"h64", 0, (long double)FOSSIL_U64_MAX, sizeof(uint64_t),
+        0, FOSSIL_U64_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
 
     /* Octal aliases */
-    {"o8",  0, FOSSIL_U8_MAX,  sizeof(uint8_t)},
-    {"o16", 0, FOSSIL_U16_MAX, sizeof(uint16_t)},
-    {"o32", 0, FOSSIL_U32_MAX, sizeof(uint32_t)},
-    {"o64", 0, (long double)FOSSIL_U64_MAX, sizeof(uint64_t)},
+    {"o8",  0, FOSSIL_U8_MAX,  sizeof(uint8_t),
+        0, FOSSIL_U8_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"o16", 0, FOSSIL_U16_MAX, sizeof(uint16_t),
+        0, FOSSIL_U16_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"o32", 0, FOSSIL_U32_MAX, sizeof(uint32_t),
+        0, FOSSIL_U32_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"o64", 0, (long double)FOSSIL_U64_MAX, sizeof(uint64_t),
+        0, FOSSIL_U64_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
 
     /* Binary aliases */
-    {"b8",  0, FOSSIL_U8_MAX,  sizeof(uint8_t)},
-    {"b16", 0, FOSSIL_U16_MAX, sizeof(uint16_t)},
-    {"b32", 0, FOSSIL_U32_MAX, sizeof(uint32_t)},
-    {"b64", 0, (long double)FOSSIL_U64_MAX, sizeof(uint64_t)},
-
-    /* Floating ranges represented via integer storage model */
-    {"f32", FOSSIL_I32_MIN, FOSSIL_I32_MAX, sizeof(float)},
-    {"f64", (long double)FOSSIL_I64_MIN, (long double)FOSSIL_I64_MAX, sizeof(double)},
+    {"b8",  0, FOSSIL_U8_MAX,  sizeof(uint8_t),
+        0, FOSSIL_U8_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"b16", 0, FOSSIL_U16_MAX, sizeof(uint16_t),
+        0, FOSSIL_U16_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"b32", 0, FOSSIL_U32_MAX, sizeof(uint32_t),
+        0, FOSSIL_U32_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+    {"b64", 0, (long double)FOSSIL_U64_MAX, sizeof(uint64_t),
+        0, FOSSIL_U64_MAX, FOSSIL_TYPE_LIMITS_INTEGER},
+
+    /* Floating point: every field describes the finite value range, as
+       std::numeric_limits and TypeLimits<F32>/TypeLimits<F64> do. min_value and
+       max_value are -max..max; min_int and max_uint are the integers inside
+       that range, which is every int64 and uint64, so fits_i64/fits_u64
+       accept any integer (range, not precision). */
+    {"f32", -FOSSIL_F32_MAX, FOSSIL_F32_MAX, sizeof(float),
+        FOSSIL_I64_MIN, FOSSIL_U64_MAX, FOSSIL_TYPE_LIMITS_FLOAT},
+    {"f64", -FOSSIL_F64_MAX, FOSSIL_F64_MAX, sizeof(double),
+        FOSSIL_I64_MIN, FOSSIL_U64_MAX, FOSSIL_TYPE_LIMITS_FLOAT},
 
     /* Boolean */
-    {"bool", 0, 1, sizeof(bool)},
+    {"bool", 0, 1, sizeof(bool),
+        0, 1, FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_LOGIC},
 
     /* Tribool */
-    {"tribool", 0, 2, sizeof(uint8_t)},
+    {"tribool", 0, 2, sizeof(fossil_type_tribool8),
+        0, 2, FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_LOGIC},
 
     /* Char and cstr */
-    {"char", CHAR_MIN, CHAR_MAX, sizeof(char)},
-    {"cstr", 0, 0, sizeof(char*)},
+    {"char", CHAR_MIN, CHAR_MAX, sizeof(char),
+        CHAR_MIN, CHAR_MAX, FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_LIMITS_CHAR_SIGN},
+    {"cstr", 0, 0, sizeof(char*),
+        0, 0, FOSSIL_TYPE_LIMITS_VARIABLE},
 };
 
-/* Number of entries */
-static const size_t fossil_limits_count =
-    sizeof(fossil_limits_table) / sizeof(fossil_limits_table[0]);
+/* The kind enum indexes this table directly. */
+typedef char fossil_limits_table_matches_kinds[
+    sizeof(fossil_limits_table) / sizeof(fossil_limits_table[0]) == FOSSIL_TYPE_KIND_COUNT ? 1 : -1];
 
 /* ======================================================
- * Query function
+ * Query functions
+ *
+ * Type IDs are short and mostly share a shape: one family
+ * letter followed by a bit width. The length and the
+ * leading characters pick a single candidate slot, which
+ * one compare then confirms, so a lookup is a couple of
+ * branches instead of a scan over the table.
  * ====================================================== */
-const fossil_type_limits* fossil_type_limits_get(const char* type_id) {
-    if (!type_id) return NULL;
-    for (size_t i = 0; i < fossil_limits_count; i++) {
-        if (fossil_limits_table[i].type_id &&
-            strcmp(fossil_limits_table[i].type_id, type_id) == 0) {
-            return &fossil_limits_table[i];
+
+/* Table slot for a width suffix "8", "16", "32" or "64"; -1 otherwise. */
+static int fossil_limits_width_slot(const char* w, size_t n) {
+    if (n == 1) return w[0] == '8' ? 0 : -1;
+    switch (w[0]) {
+        case '1': return w[1] == '6' ? 1 : -1;
+        case '3': return w[1] == '2' ? 2 : -1;
+        case '6': return w[1] == '4' ? 3 : -1;
+        default:  return -1;
+    }
+}
+
+static fossil_type_limits_kind fossil_limits_builtin_kind(const char* type_id) {
+    if (!type_id) return FOSSIL_TYPE_KIND_COUNT;
+
+    size_t n = 0;
+    while (n < 8 && type_id[n]) n++;
+
+    int kind = -1;
+    switch (n) {
+        case 2:
+        case 3: {
+            int base;
+            switch (type_id[0]) {
+                case 'i': base = FOSSIL_TYPE_KIND_I8; break;
+                case 'u': base = FOSSIL_TYPE_KIND_U8; break;
+                case 'h': base = FOSSIL_TYPE_KIND_H8; break;
+                case 'o': base = FOSSIL_TYPE_KIND_O8; break;
+                case 'b': base = FOSSIL_TYPE_KIND_B8; break;
+                case 'f': base = FOSSIL_TYPE_KIND_F32 - 2; break;
+                default:  return FOSSIL_TYPE_KIND_COUNT;
+            }
+            int slot = fossil_limits_width_slot(type_id + 1, n - 1);
+            if (slot < 0 || (type_id[0] == 'f' && slot < 2)) return FOSSIL_TYPE_KIND_COUNT;
+            kind = base + slot;
+            break;
         }
+        case 4:
+            if (type_id[0] == 'b') kind = FOSSIL_TYPE_KIND_BOOL;
+            else if (type_id[0] == 'c') kind = type_id[1] == 'h' ? FOSSIL_TYPE_KIND_CHAR : FOSSIL_TYPE_KIND_CSTR;
+            break;
+        case 7:
+            kind = FOSSIL_TYPE_KIND_TRIBOOL;
+            break;
+        default:
+            break;
     }
-    return NULL;
+
+    /* Confirm the candidate; the slot only narrowed it down. */
+    if (kind < 0 || memcmp(fossil_limits_table[kind].type_id, type_id, n + 1) != 0)
+        return FOSSIL_TYPE_KIND_COUNT;
+    return (fossil_type_limits_kind)kind;
+}
+
+/* Built-in IDs resolve without touching the registry; only misses consult it. */
+fossil_type_limits_kind fossil_type_limits_kind_of(const char* type_id) {
+    fossil_type_limits_kind kind = fossil_limits_builtin_kind(type_id);
+    if (kind != FOSSIL_TYPE_KIND_COUNT) return kind;
+    const fossil_type_info* info = fossil_type_registry_find(type_id);
+    return info ? info->kind : FOSSIL_TYPE_KIND_COUNT;
+}
+
+const fossil_type_limits* fossil_type_limits_get(const char* type_id) {
+    fossil_type_limits_kind kind = fossil_limits_builtin_kind(type_id);
+    if (kind != FOSSIL_TYPE_KIND_COUNT) return &fossil_limits_table[kind];
+    const fossil_type_info* info = fossil_type_registry_find(type_id);
+    return info ? &info->limits : NULL;
+}
+
+const fossil_type_limits* fossil_type_limits_get_by_kind(fossil_type_limits_kind kind) {
+    if ((unsigned)kind >= (unsigned)FOSSIL_TYPE_KIND_COUNT) return NULL;
+    return &fossil_limits_table[kind];
+}
+
+bool fossil_type_fits_i64(fossil_type_limits_kind kind, int64_t value) {
+    return fossil_type_limits_fits_i64(fossil_type_limits_get_by_kind(kind), value);
+}
+
+bool fossil_type_fits_u64(fossil_type_limits_kind kind, uint64_t value) {
+    return fossil_type_limits_fits_u64(fossil_type_limits_get_by_kind(kind), value);
 }
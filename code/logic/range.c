@@ -0,0 +1,454 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/range.h"
+#include "simd.h"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/* ======================================================
+ * Bounds
+ *
+ * Integer sources are compared in their own width. Unsigned
+ * values are biased by flipping the sign bit, which maps
+ * them onto the signed range in the same order, so one
+ * signed compare pair serves both. The target bounds are
+ * clamped to what the source width can hold and biased the
+ * same way. A target whose range misses the source width
+ * altogether gets lo above hi, which every value violates.
+ *
+ * Float sources compare against open bounds in their own
+ * precision: lo - 1 rounds down and is tested with >, hi + 1
+ * rounds up and is tested with <, so a value is in range
+ * exactly when it truncates into [min_int, max_uint]: -0.5
+ * fits u8 just as 255.5 does. Registered bounds need not
+ * be representable; the rounding keeps them exact.
+ * ====================================================== */
+
+typedef struct range_bounds {
+    int64_t lo;    /* Lowest allowed value, biased. */
+    int64_t hi;    /* Highest allowed value, biased. */
+    uint64_t flip; /* Sign bit of the source width for unsigned sources, else 0. */
+    double flo;    /* Float lower bound, exclusive. */
+    double fhi;    /* Float upper bound, exclusive. */
+} range_bounds;
+
+/* Kernels turn up to 64 values into a violation mask, bit i for value i. */
+typedef uint64_t (*range_block)(const void *src, size_t n, const range_bounds *b);
+
+enum {
+    RANGE_W8,
+    RANGE_W16,
+    RANGE_W32,
+    RANGE_W64,
+    RANGE_F32,
+    RANGE_F64,
+    RANGE_F64_TO_F32,
+    RANGE_KERNELS
+};
+
+/* ======================================================
+ * Scalar kernels
+ * ====================================================== */
+
+#define RANGE_SCALAR_INT(name, T, UT)                                                   \
+    static uint64_t name(const void *src, size_t n, const range_bounds *b) {            \
+        const UT *p = (const UT *)src;                                                  \
+        uint64_t m = 0;                                                                 \
+        for (size_t i = 0; i < n; i++) {                                                \
+            int64_t v = (T)(UT)(p[i] ^ (UT)b->flip);                                    \
+            m |= (uint64_t)(v < b->lo || v > b->hi) << i;                               \
+        }                                                                               \
+        return m;                                                                       \
+    }
+
+RANGE_SCALAR_INT(block_w8_scalar, int8_t, uint8_t)
+RANGE_SCALAR_INT(block_w16_scalar, int16_t, uint16_t)
+RANGE_SCALAR_INT(block_w32_scalar, int32_t, uint32_t)
+RANGE_SCALAR_INT(block_w64_scalar, int64_t, uint64_t)
+
+#define RANGE_SCALAR_FLOAT(name, T)                                                     \
+    static uint64_t name(const void *src, size_t n, const range_bounds *b) {            \
+        const T *p = (const T *)src;                                                    \
+        const T lo = (T)b->flo, hi = (T)b->fhi;                                         \
+        uint64_t m = 0;                                                                 \
+        for (size_t i = 0; i < n; i++) m |= (uint64_t)!(p[i] > lo && p[i] < hi) << i;  \
+        return m;                                                                       \
+    }
+
+RANGE_SCALAR_FLOAT(block_f32_scalar, float)
+RANGE_SCALAR_FLOAT(block_f64_scalar, double)
+
+/* Finite doubles beyond FLT_MAX; infinities and NaN carry over to float. */
+static uint64_t block_f64_to_f32(const void *src, size_t n, const range_bounds *b) {
+    const double *p = (const double *)src;
+    (void)b;
+    uint64_t m = 0;
+    for (size_t i = 0; i < n; i++) {
+        double a = fabs(p[i]);
+        m |= (uint64_t)(a > FLT_MAX && a < HUGE_VAL) << i;
+    }
+    return m;
+}
+
+typedef struct range_kernels {
+    range_block full[RANGE_KERNELS]; /* Called with exactly 64 values. */
+} range_kernels;
+
+static const range_kernels range_scalar = {{
+    block_w8_scalar, block_w16_scalar, block_w32_scalar, block_w64_scalar,
+    block_f32_scalar, block_f64_scalar, block_f64_to_f32,
+}};
+
+/* ======================================================
+ * AVX2 kernels
+ * ====================================================== */
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+/* Lanes of x that fall outside [lo, hi], as all-ones lanes. */
+#define RANGE_OUTSIDE(bits, x) \
+    _mm256_or_si256(_mm256_cmpgt_epi##bits(lo, x), _mm256_cmpgt_epi##bits(x, hi))
+
+#define RANGE_LOAD(p, k, flip) \
+    _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(const void *)((p) + 32 * (k))), flip)
+
+FOSSIL_TYPE_TARGET_AVX2
+static uint64_t block_w8_avx2(const void *src, size_t n, const range_bounds *b) {
+    const unsigned char *p = (const unsigned char *)src;
+    const __m256i lo = _mm256_set1_epi8((char)b->lo), hi = _mm256_set1_epi8((char)b->hi);
+    const __m256i flip = _mm256_set1_epi8((char)b->flip);
+    uint64_t m = 0;
+    (void)n;
+    for (int k = 0; k < 2; k++) {
+        __m256i x = RANGE_LOAD(p, k, flip);
+        m |= (uint64_t)(uint32_t)_mm256_movemask_epi8(RANGE_OUTSIDE(8, x)) << (32 * k);
+    }
+    return m;
+}
+
+/* Packing two 16-lane masks to bytes interleaves their halves; the permute restores lane order. */
+FOSSIL_TYPE_TARGET_AVX2
+static uint64_t block_w16_avx2(const void *src, size_t n, const range_bounds *b) {
+    const unsigned char *p = (const unsigned char *)src;
+    const __m256i lo = _mm256_set1_epi16((short)b->lo), hi = _mm256_set1_epi16((short)b->hi);
+    const __m256i flip = _mm256_set1_epi16((short)b->flip);
+    uint64_t m = 0;
+    (void)n;
+    for (int k = 0; k < 2; k++) {
+        __m256i x0 = RANGE_LOAD(p, 2 * k, flip);
+        __m256i x1 = RANGE_LOAD(p, 2 * k + 1, flip);
+        __m256i packed = _mm256_packs_epi16(RANGE_OUTSIDE(16, x0), RANGE_OUTSIDE(16, x1));
+        packed = _mm256_permute4x64_epi64(packed, 0xD8);
+        m |= (uint64_t)(uint32_t)_mm256_movemask_epi8(packed) << (32 * k);
+    }
+    return m;
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static uint64_t block_w32_avx2(const void *src, size_t n, const range_bounds *b) {
+    const unsigned char *p = (const unsigned char *)src;
+    const __m256i lo = _mm256_set1_epi32((int)b->lo), hi = _mm256_set1_epi32((int)b->hi);
+    const __m256i flip = _mm256_set1_epi32((int)b->flip);
+    uint64_t m = 0;
+    (void)n;
+    for (int k = 0; k < 8; k++) {
+        __m256i x = RANGE_LOAD(p, k, flip);
+        m |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(RANGE_OUTSIDE(32, x))) << (8 * k);
+    }
+    return m;
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static uint64_t block_w64_avx2(const void *src, size_t n, const range_bounds *b) {
+    const unsigned char *p = (const unsigned char *)src;
+    const __m256i lo = _mm256_set1_epi64x((long long)b->lo), hi = _mm256_set1_epi64x((long long)b->hi);
+    const __m256i flip = _mm256_set1_epi64x((long long)b->flip);
+    uint64_t m = 0;
+    (void)n;
+    for (int k = 0; k < 16; k++) {
+        __m256i x = RANGE_LOAD(p, k, flip);
+        m |= (uint64_t)(unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(RANGE_OUTSIDE(64, x))) << (4 * k);
+    }
+    return m;
+}
+
+/* Ordered compares fail on NaN, so NaN lanes count as outside. */
+FOSSIL_TYPE_TARGET_AVX2
+static uint64_t block_f32_avx2(const void *src, size_t n, const range_bounds *b) {
+    const float *p = (const float *)src;
+    const __m256 lo = _mm256_set1_ps((float)b->flo), hi = _mm256_set1_ps((float)b->fhi);
+    uint64_t m = 0;
+    (void)n;
+    for (int k = 0; k < 8; k++) {
+        __m256 x = _mm256_loadu_ps(p + 8 * k);
+        __m256 in = _mm256_and_ps(_mm256_cmp_ps(x, lo, _CMP_GT_OQ), _mm256_cmp_ps(x, hi, _CMP_LT_OQ));
+        m |= (uint64_t)(~(unsigned)_mm256_movemask_ps(in) & 0xFFu) << (8 * k);
+    }
+    return m;
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static uint64_t block_f64_avx2(const void *src, size_t n, const range_bounds *b) {
+    const double *p = (const double *)src;
+    const __m256d lo = _mm256_set1_pd(b->flo), hi = _mm256_set1_pd(b->fhi);
+    uint64_t m = 0;
+    (void)n;
+    for (int k = 0; k < 16; k++) {
+        __m256d x = _mm256_loadu_pd(p + 4 * k);
+        __m256d in = _mm256_and_pd(_mm256_cmp_pd(x, lo, _CMP_GT_OQ), _mm256_cmp_pd(x, hi, _CMP_LT_OQ));
+        m |= (uint64_t)(~(unsigned)_mm256_movemask_pd(in) & 0xFu) << (4 * k);
+    }
+    return m;
+}
+
+#undef RANGE_OUTSIDE
+#undef RANGE_LOAD
+
+#endif
+
+static range_kernels select_kernels(void) {
+    range_kernels k = range_scalar;
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) {
+        k.full[RANGE_W8] = block_w8_avx2;
+        k.full[RANGE_W16] = block_w16_avx2;
+        k.full[RANGE_W32] = block_w32_avx2;
+        k.full[RANGE_W64] = block_w64_avx2;
+        k.full[RANGE_F32] = block_f32_avx2;
+        k.full[RANGE_F64] = block_f64_avx2;
+    }
+#endif
+    return k;
+}
+
+/* ======================================================
+ * Driver
+ * ====================================================== */
+
+/* Walks src in blocks of 64 values; the tail always goes through the scalar kernel. */
+static void range_run(const void *src, size_t count, size_t width, int kernel, const range_bounds *b,
+                      fossil_type_range_result *result, uint64_t *bitmap) {
+    range_kernels k = select_kernels();
+    const unsigned char *p = (const unsigned char *)src;
+    size_t violations = 0, first = FOSSIL_TYPE_RANGE_NPOS;
+
+    for (size_t base = 0; base < count; base += 64) {
+        size_t n = count - base < 64 ? count - base : 64;
+        uint64_t m = (n == 64 ? k.full[kernel] : range_scalar.full[kernel])(p + base * width, n, b);
+        if (m) {
+            violations += fossil_type_popcount64(m);
+            if (first == FOSSIL_TYPE_RANGE_NPOS) first = base + fossil_type_ctz64(m);
+        }
+        if (bitmap) bitmap[base / 64] = m;
+    }
+    if (result) {
+        result->violations = violations;
+        result->first = first;
+    }
+}
+
+/* Values that always fit: no need to read them. */
+static void range_none(size_t count, fossil_type_range_result *result, uint64_t *bitmap) {
+    if (bitmap) memset(bitmap, 0, FOSSIL_TYPE_RANGE_BITMAP_WORDS(count) * sizeof(uint64_t));
+    if (result) {
+        result->violations = 0;
+        result->first = FOSSIL_TYPE_RANGE_NPOS;
+    }
+}
+
+static const fossil_type_limits *range_target(fossil_type_limits_kind target) {
+    const fossil_type_limits *l = fossil_type_limits_get_by_kind(target);
+    if (!l || !(l->flags & (FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_FLOAT))) return NULL;
+    return l;
+}
+
+/* Unsigned value of a width with sign bit half, biased onto the signed range. */
+static int64_t range_bias(uint64_t v, uint64_t half) {
+    return v >= half ? (int64_t)(v - half) : -(int64_t)(half - 1 - v) - 1;
+}
+
+static int range_check_int(const void *src, size_t count, unsigned bits, int is_signed,
+                           const fossil_type_limits *l, fossil_type_range_result *result,
+                           uint64_t *bitmap) {
+    if (!l || (count && !src)) return -1;
+
+    range_bounds b = {0, 0, 0, 0.0, 0.0};
+    uint64_t half = 1ULL << (bits - 1);
+    uint64_t umax = half - 1 + half;
+    if (is_signed) {
+        int64_t smin = (int64_t)0 - (int64_t)(half - 1) - 1;
+        int64_t smax = (int64_t)(half - 1);
+        b.lo = l->min_int > smin ? l->min_int : smin;
+        b.hi = l->max_uint < (uint64_t)smax ? (int64_t)l->max_uint : smax;
+        if (b.lo == smin && b.hi == smax) {
+            range_none(count, result, bitmap);
+            return 0;
+        }
+        if (b.lo > smax) {
+            b.lo = smax;
+            b.hi = smin;
+        }
+    } else {
+        uint64_t bottom = l->min_int > 0 ? (uint64_t)l->min_int : 0;
+        uint64_t top = l->max_uint < umax ? l->max_uint : umax;
+        if (bottom == 0 && top == umax) {
+            range_none(count, result, bitmap);
+            return 0;
+        }
+        if (bottom > umax) {
+            bottom = umax;
+            top = 0;
+        }
+        b.flip = half;
+        b.lo = range_bias(bottom, half);
+        b.hi = range_bias(top, half);
+    }
+
+    int kernel = bits == 8 ? RANGE_W8 : bits == 16 ? RANGE_W16 : bits == 32 ? RANGE_W32 : RANGE_W64;
+    range_run(src, count, bits / 8, kernel, &b, result, bitmap);
+    return 0;
+}
+
+/* Smallest double, or float when !is_double, at or above v. */
+static double range_float_above(uint64_t v, int is_double) {
+    double d = is_double ? (double)v : (double)(float)v;
+    if (d < 18446744073709551616.0 && (uint64_t)d < v) {
+        d = is_double ? nextafter(d, HUGE_VAL) : (double)nextafterf((float)d, HUGE_VALF);
+    }
+    return d;
+}
+
+/* Largest double, or float when !is_double, at or below v - 1: the open lower bound for minimum v. */
+static double range_float_below(int64_t v, int is_double) {
+    if (v == INT64_MIN) {
+        return is_double ? nextafter(-9223372036854775808.0, -HUGE_VAL)
+                         : (double)nextafterf(-9223372036854775808.0f, -HUGE_VALF);
+    }
+    int64_t w = v - 1;
+    double d = is_double ? (double)w : (double)(float)w;
+    if (d >= 9223372036854775808.0 || (int64_t)d > w) {
+        d = is_double ? nextafter(d, -HUGE_VAL) : (double)nextafterf((float)d, -HUGE_VALF);
+    }
+    return d;
+}
+
+static int range_check_float(const void *src, size_t count, int is_double,
+                             const fossil_type_limits *l, fossil_type_range_result *result,
+                             uint64_t *bitmap) {
+    if (!l || (count && !src)) return -1;
+
+    range_bounds b = {0, 0, 0, 0.0, 0.0};
+    if (l->flags & FOSSIL_TYPE_LIMITS_FLOAT) {
+        if (is_double && l->size < sizeof(double)) {
+            range_run(src, count, sizeof(double), RANGE_F64_TO_F32, &b, result, bitmap);
+        } else {
+            range_none(count, result, bitmap);
+        }
+        return 0;
+    }
+    b.flo = range_float_below(l->min_int, is_double);
+    b.fhi = l->max_uint == UINT64_MAX ? 18446744073709551616.0 : range_float_above(l->max_uint + 1, is_double);
+    if (is_double) range_run(src, count, sizeof(double), RANGE_F64, &b, result, bitmap);
+    else range_run(src, count, sizeof(float), RANGE_F32, &b, result, bitmap);
+    return 0;
+}
+
+/* ======================================================
+ * Public entry points
+ * ====================================================== */
+
+int fossil_type_range_check_i8(const int8_t *src, size_t count, fossil_type_limits_kind target,
+                               fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_int(src, count, 8, 1, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check_i16(const int16_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_int(src, count, 16, 1, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check_i32(const int32_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_int(src, count, 32, 1, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check_i64(const int64_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_int(src, count, 64, 1, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check_u8(const uint8_t *src, size_t count, fossil_type_limits_kind target,
+                               fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_int(src, count, 8, 0, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check_u16(const uint16_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_int(src, count, 16, 0, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check_u32(const uint32_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_int(src, count, 32, 0, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check_u64(const uint64_t *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_int(src, count, 64, 0, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check_f32(const float *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_float(src, count, 0, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check_f64(const double *src, size_t count, fossil_type_limits_kind target,
+                                fossil_type_range_result *result, uint64_t *bitmap) {
+    return range_check_float(src, count, 1, range_target(target), result, bitmap);
+}
+
+int fossil_type_range_check(const void *src, fossil_type_limits_kind source, size_t count,
+                            fossil_type_limits_kind target, fossil_type_range_result *result,
+                            uint64_t *bitmap) {
+    const fossil_type_limits *t = range_target(target);
+    if (!t) return -1;
+    return fossil_type_range_check_limits(src, source, count, t, result, bitmap);
+}
+
+int fossil_type_range_check_limits(const void *src, fossil_type_limits_kind source, size_t count,
+                                   const fossil_type_limits *target, fossil_type_range_result *result,
+                                   uint64_t *bitmap) {
+    const fossil_type_limits *s = fossil_type_limits_get_by_kind(source);
+    if (!s || !target || !(target->flags & (FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_FLOAT))) return -1;
+    if (s->flags & FOSSIL_TYPE_LIMITS_FLOAT) {
+        if (s->size != sizeof(float) && s->size != sizeof(double)) return -1;
+        return range_check_float(src, count, s->size == sizeof(double), target, result, bitmap);
+    }
+    if (!(s->flags & FOSSIL_TYPE_LIMITS_INTEGER)) return -1;
+    if (s->size != 1 && s->size != 2 && s->size != 4 && s->size != 8) return -1;
+    return range_check_int(src, count, (unsigned)(s->size * 8),
+                           (s->flags & FOSSIL_TYPE_LIMITS_SIGNED) != 0, target, result, bitmap);
+}
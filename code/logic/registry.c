@@ -0,0 +1,235 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE 1
+#endif
+
+#include "fossil/type/registry.h"
+#include "atomic.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ======================================================
+ * Published tables
+ *
+ * A table is an open-addressed hash of the registered
+ * records, at most half full so every probe meets an empty
+ * slot, plus the records in registration order. It never
+ * changes once published. Registering builds a successor
+ * holding the old records and the new ones, links the old
+ * table behind it, and swaps the head pointer with a
+ * compare-and-swap; a writer that loses the race rebuilds
+ * against the table that won.
+ * ====================================================== */
+
+typedef struct registry_slot {
+    uint64_t hash;
+    const fossil_type_info *info;  /**< NULL for an empty slot. */
+} registry_slot;
+
+typedef struct registry_table {
+    struct registry_table *prev;      /**< Table this one replaced, freed on reset. */
+    size_t count;                     /**< Records held. */
+    size_t mask;                      /**< Slot count minus one; slot counts are powers of two. */
+    const fossil_type_info **order;   /**< count records in registration order, after the slots. */
+    registry_slot slots[];
+} registry_table;
+
+/* Current table as a uintptr_t, 0 before the first registration. */
+static fossil_type_atomic_u64 registry_head;
+
+static registry_table *registry_current(void) {
+    return (registry_table *)(uintptr_t)fossil_type_atomic_load_u64(&registry_head);
+}
+
+/* FNV-1a over the ID's bytes. */
+static uint64_t registry_hash(const char *id) {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (const unsigned char *p = (const unsigned char *)id; *p; p++) {
+        h ^= *p;
+        h *= 0x100000001B3ULL;
+    }
+    return h;
+}
+
+static const fossil_type_info *table_find(const registry_table *t, const char *id, uint64_t h) {
+    for (size_t i = (size_t)h & t->mask;; i = (i + 1) & t->mask) {
+        const registry_slot *s = &t->slots[i];
+        if (!s->info) return NULL;
+        if (s->hash == h && strcmp(s->info->limits.type_id, id) == 0) return s->info;
+    }
+}
+
+/* Places a record; fails if its ID is already in the table. */
+static int table_insert(registry_table *t, const fossil_type_info *info) {
+    uint64_t h = registry_hash(info->limits.type_id);
+    if (table_find(t, info->limits.type_id, h)) return -1;
+    size_t i = (size_t)h & t->mask;
+    while (t->slots[i].info) i = (i + 1) & t->mask;
+    t->slots[i].hash = h;
+    t->slots[i].info = info;
+    t->order[t->count++] = info;
+    return 0;
+}
+
+/* Builds the successor of cur holding n more records; NULL on a duplicate ID or allocation failure. */
+static registry_table *table_extend(registry_table *cur, fossil_type_info *const *infos, size_t n) {
+    size_t total = (cur ? cur->count : 0) + n;
+    size_t slots = 16;
+    while (slots < total * 2) slots *= 2;
+
+    registry_table *t = (registry_table *)calloc(1, sizeof(registry_table) + slots * sizeof(registry_slot) +
+                                                    total * sizeof(const fossil_type_info *));
+    if (!t) return NULL;
+    t->prev = cur;
+    t->mask = slots - 1;
+    t->order = (const fossil_type_info **)(void *)(t->slots + slots);
+
+    for (size_t i = 0; cur && i < cur->count; i++) table_insert(t, cur->order[i]);
+    for (size_t i = 0; i < n; i++) {
+        if (table_insert(t, infos[i]) != 0) {
+            free(t);
+            return NULL;
+        }
+    }
+    return t;
+}
+
+/* ======================================================
+ * Records
+ * ====================================================== */
+
+static int is_pow2(size_t x) {
+    return x && !(x & (x - 1));
+}
+
+/* Bounds must lie inside the storage kind and not cross. */
+static int record_bounds(const fossil_type_registration *reg, const fossil_type_limits *s) {
+    if (reg->min_int < s->min_int || reg->max_uint > s->max_uint) return -1;
+    if (reg->min_int > 0 && (uint64_t)reg->min_int > reg->max_uint) return -1;
+    return 0;
+}
+
+/* Validates a description and allocates its record, with the ID copied behind it. */
+static fossil_type_info *record_new(const fossil_type_registration *reg) {
+    const fossil_type_limits *s = fossil_type_limits_get_by_kind(reg->kind);
+    if (!reg->type_id || !reg->type_id[0] || !s) return NULL;
+    if (!(s->flags & FOSSIL_TYPE_LIMITS_INTEGER) || (s->flags & FOSSIL_TYPE_LIMITS_LOGIC)) return NULL;
+    if (record_bounds(reg, s) != 0) return NULL;
+    if (fossil_type_limits_kind_of(reg->type_id) != FOSSIL_TYPE_KIND_COUNT) return NULL;
+
+    /* Every *_id path reads and writes values at the storage size, so no other size is published. */
+    size_t size = s->size;
+    size_t alignment = reg->alignment ? reg->alignment : size;
+    if ((reg->size && reg->size != size) || !is_pow2(alignment) || alignment > size) return NULL;
+
+    size_t len = strlen(reg->type_id);
+    fossil_type_info *info = (fossil_type_info *)malloc(sizeof(fossil_type_info) + len + 1);
+    if (!info) return NULL;
+    char *id = (char *)(info + 1);
+    memcpy(id, reg->type_id, len + 1);
+
+    info->limits.type_id = id;
+    info->limits.min_value = (long double)reg->min_int;
+    info->limits.max_value = (long double)reg->max_uint;
+    info->limits.size = size;
+    info->limits.min_int = reg->min_int;
+    info->limits.max_uint = reg->max_uint;
+    info->limits.flags = s->flags;
+    info->alignment = alignment;
+    info->kind = reg->kind;
+    return info;
+}
+
+/* ======================================================
+ * Public API
+ * ====================================================== */
+
+int fossil_type_registry_add(const fossil_type_registration *reg) {
+    return fossil_type_registry_add_many(reg, 1);
+}
+
+int fossil_type_registry_add_many(const fossil_type_registration *regs, size_t count) {
+    if (!regs || !count) return -1;
+
+    fossil_type_info **infos = (fossil_type_info **)calloc(count, sizeof(fossil_type_info *));
+    if (!infos) return -1;
+    int rc = 0;
+    for (size_t i = 0; i < count && rc == 0; i++) {
+        infos[i] = record_new(&regs[i]);
+        if (!infos[i]) rc = -1;
+    }
+
+    while (rc == 0) {
+        uint64_t expected = fossil_type_atomic_load_u64(&registry_head);
+        registry_table *next = table_extend((registry_table *)(uintptr_t)expected, infos, count);
+        if (!next) {
+            rc = -1;
+        } else if (fossil_type_atomic_cas_u64(&registry_head, &expected, (uint64_t)(uintptr_t)next)) {
+            break;
+        } else {
+            free(next);
+        }
+    }
+
+    if (rc != 0) {
+        for (size_t i = 0; i < count; i++) free(infos[i]);
+    }
+    free(infos);
+    return rc;
+}
+
+const fossil_type_info *fossil_type_registry_find(const char *type_id) {
+    const registry_table *t = registry_current();
+    if (!t || !type_id) return NULL;
+    return table_find(t, type_id, registry_hash(type_id));
+}
+
+size_t fossil_type_registry_count(void) {
+    const registry_table *t = registry_current();
+    return t ? t->count : 0;
+}
+
+const fossil_type_info *fossil_type_registry_at(size_t index) {
+    const registry_table *t = registry_current();
+    if (!t || index >= t->count) return NULL;
+    return t->order[index];
+}
+
+void fossil_type_registry_reset(void) {
+    uint64_t expected = fossil_type_atomic_load_u64(&registry_head);
+    while (!fossil_type_atomic_cas_u64(&registry_head, &expected, 0)) {}
+
+    registry_table *t = (registry_table *)(uintptr_t)expected;
+    /* The newest table holds every record; older tables only share them. */
+    for (size_t i = 0; t && i < t->count; i++) free((void *)t->order[i]);
+    while (t) {
+        registry_table *prev = t->prev;
+        free(t);
+        t = prev;
+    }
+}
@@ -0,0 +1,137 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_SIMD_H
+#define FOSSIL_TYPE_SIMD_H
+
+/*
+ * Private header: instruction set detection shared by the bulk kernels.
+ * Not installed and not part of the public API.
+ *
+ * SSE2 and NEON are baseline on the targets that define them, so their
+ * kernels are selected at compile time. AVX2, BMI2 and AVX-512F kernels
+ * are compiled with a per-function target attribute and picked at runtime,
+ * which keeps the default build portable across x86-64 machines.
+ */
+
+/* ---------------- x86 SSE2 ---------------- */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define FOSSIL_TYPE_HAVE_SSE2 1
+#  include <emmintrin.h>
+#endif
+
+/* ---------------- x86 AVX2 (runtime dispatched) ---------------- */
+#if defined(FOSSIL_TYPE_HAVE_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#  define FOSSIL_TYPE_HAVE_AVX2 1
+#  include <immintrin.h>
+#  define FOSSIL_TYPE_TARGET_AVX2 __attribute__((target("avx2")))
+
+static inline int fossil_type_simd_has_avx2(void) {
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+/* ---------------- x86-64 BMI2 and AVX-512F (runtime dispatched) ---------------- */
+#if defined(FOSSIL_TYPE_HAVE_AVX2) && defined(__x86_64__)
+#  define FOSSIL_TYPE_HAVE_BMI2 1
+#  define FOSSIL_TYPE_TARGET_AVX2_BMI2 __attribute__((target("avx2,bmi2")))
+
+static inline int fossil_type_simd_has_bmi2(void) {
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2");
+}
+
+#  define FOSSIL_TYPE_HAVE_AVX512 1
+#  define FOSSIL_TYPE_TARGET_AVX512 __attribute__((target("avx512f")))
+
+static inline int fossil_type_simd_has_avx512(void) {
+    return __builtin_cpu_supports("avx512f");
+}
+#endif
+
+/* ---------------- ARM NEON ---------------- */
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#  define FOSSIL_TYPE_HAVE_NEON 1
+#  include <arm_neon.h>
+#endif
+
+/* ---------------- Bit helpers ---------------- */
+#include <stdint.h>
+
+static inline unsigned fossil_type_popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (unsigned)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/* Index of the lowest set bit; x must be non-zero. */
+static inline unsigned fossil_type_ctz64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(x);
+#else
+    unsigned n = 0;
+    while (!(x & 1u)) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
+/* Number of bits needed to hold x: 0 for 0, else one past the highest set bit. */
+static inline unsigned fossil_type_bit_width64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return x ? 64u - (unsigned)__builtin_clzll(x) : 0u;
+#else
+    unsigned n = 0;
+    while (x) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
+/* Gathers the 32 even bits of x into the low half (portable pext 0x5555...). */
+static inline uint64_t fossil_type_bits_compress_even(uint64_t x) {
+    x &= 0x5555555555555555ULL;
+    x = (x | (x >> 1))  & 0x3333333333333333ULL;
+    x = (x | (x >> 2))  & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x >> 4))  & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >> 8))  & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+    return x;
+}
+
+/* Scatters the low 32 bits of x onto the even bit positions (portable pdep 0x5555...). */
+static inline uint64_t fossil_type_bits_spread_even(uint64_t x) {
+    x &= 0x00000000FFFFFFFFULL;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8))  & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4))  & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2))  & 0x3333333333333333ULL;
+    x = (x | (x << 1))  & 0x5555555555555555ULL;
+    return x;
+}
+
+#endif /* FOSSIL_TYPE_SIMD_H */
@@ -24,34 +24,39 @@
  */
 #include "fossil/type/tribool.h"
 
+/*
+ * The exported functions are kept for ABI; the logic lives in the
+ * inline engine in tribool.h so both paths share one truth table.
+ */
+
 /* ======================================================
  * Constructors
  * ====================================================== */
 tribool fossil_type_tribool_make_true(void) {
-    return FOSSIL_TYPE_TRIBOOL_TRUE;
+    return fossil_type_tribool_inline_make_true();
 }
 
 tribool fossil_type_tribool_make_false(void) {
-    return FOSSIL_TYPE_TRIBOOL_FALSE;
+    return fossil_type_tribool_inline_make_false();
 }
 
 tribool fossil_type_tribool_make_unknown(void) {
-    return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    return fossil_type_tribool_inline_make_unknown();
 }
 
 /* ======================================================
  * Predicates
  * ====================================================== */
 int fossil_type_tribool_is_true(tribool t) {
-    return t == FOSSIL_TYPE_TRIBOOL_TRUE;
+    return fossil_type_tribool_inline_is_true(t);
 }
 
 int fossil_type_tribool_is_false(tribool t) {
-    return t == FOSSIL_TYPE_TRIBOOL_FALSE;
+    return fossil_type_tribool_inline_is_false(t);
 }
 
 int fossil_type_tribool_is_unknown(tribool t) {
-    return t == FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    return fossil_type_tribool_inline_is_unknown(t);
 }
 
 /* ======================================================
@@ -66,11 +71,7 @@ int fossil_type_tribool_is_unknown(tribool t) {
  * UNKNOWN & UNKNOWN = UNKNOWN
  */
 tribool fossil_type_tribool_and(tribool a, tribool b) {
-    if (a == FOSSIL_TYPE_TRIBOOL_FALSE || b == FOSSIL_TYPE_TRIBOOL_FALSE)
-        return FOSSIL_TYPE_TRIBOOL_FALSE;
-    if (a == FOSSIL_TYPE_TRIBOOL_UNKNOWN || b == FOSSIL_TYPE_TRIBOOL_UNKNOWN)
-        return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
-    return FOSSIL_TYPE_TRIBOOL_TRUE;
+    return fossil_type_tribool_inline_and(a, b);
 }
 
 /*
@@ -81,11 +82,7 @@ tribool fossil_type_tribool_and(tribool a, tribool b) {
  * UNKNOWN | UNKNOWN = UNKNOWN
  */
 tribool fossil_type_tribool_or(tribool a, tribool b) {
-    if (a == FOSSIL_TYPE_TRIBOOL_TRUE || b == FOSSIL_TYPE_TRIBOOL_TRUE)
-        return FOSSIL_TYPE_TRIBOOL_TRUE;
-    if (a == FOSSIL_TYPE_TRIBOOL_UNKNOWN || b == FOSSIL_TYPE_TRIBOOL_UNKNOWN)
-        return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
-    return FOSSIL_TYPE_TRIBOOL_FALSE;
+    return fossil_type_tribool_inline_or(a, b);
 }
 
 /*
@@ -95,10 +92,40 @@ tribool fossil_type_tribool_or(tribool a, tribool b) {
  * NOT UNKNOWN = UNKNOWN
  */
 tribool fossil_type_tribool_not(tribool t) {
-    switch (t) {
-        case FOSSIL_TYPE_TRIBOOL_TRUE:    return FOSSIL_TYPE_TRIBOOL_FALSE;
-        case FOSSIL_TYPE_TRIBOOL_FALSE:   return FOSSIL_TYPE_TRIBOOL_TRUE;
-        case FOSSIL_TYPE_TRIBOOL_UNKNOWN: return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
-        default: return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
-    }
+    return fossil_type_tribool_inline_not(t);
+}
+
+/* ======================================================
+ * Derived connectives
+ * ====================================================== */
+tribool fossil_type_tribool_xor(tribool a, tribool b) {
+    return fossil_type_tribool_inline_xor(a, b);
+}
+
+tribool fossil_type_tribool_implies(tribool a, tribool b) {
+    return fossil_type_tribool_inline_implies(a, b);
+}
+
+tribool fossil_type_tribool_equiv(tribool a, tribool b) {
+    return fossil_type_tribool_inline_equiv(a, b);
+}
+
+tribool fossil_type_tribool_luk_xor(tribool a, tribool b) {
+    return fossil_type_tribool_inline_luk_xor(a, b);
+}
+
+tribool fossil_type_tribool_luk_implies(tribool a, tribool b) {
+    return fossil_type_tribool_inline_luk_implies(a, b);
+}
+
+tribool fossil_type_tribool_luk_equiv(tribool a, tribool b) {
+    return fossil_type_tribool_inline_luk_equiv(a, b);
+}
+
+tribool fossil_type_tribool_consensus(tribool a, tribool b) {
+    return fossil_type_tribool_inline_consensus(a, b);
+}
+
+tribool fossil_type_tribool_merge(tribool a, tribool b) {
+    return fossil_type_tribool_inline_merge(a, b);
 }
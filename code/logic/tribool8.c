@@ -0,0 +1,156 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool.h"
+#include "simd.h"
+
+/* ======================================================
+ * Scalar conversion
+ * ====================================================== */
+
+tribool8 fossil_type_tribool8_from(tribool t) {
+    return fossil_type_tribool8_inline_from(t);
+}
+
+tribool fossil_type_tribool8_to(tribool8 t) {
+    return fossil_type_tribool8_inline_to(t);
+}
+
+/* ======================================================
+ * Bulk kernels
+ *
+ * Each kernel handles whole blocks and returns how many
+ * values it converted; the scalar loop does the rest.
+ * ====================================================== */
+
+/* The SIMD paths read tribools as 32-bit lanes (the enum size on x86 ABIs). */
+static int tribool_is_i32(void) {
+    return sizeof(tribool) == sizeof(int32_t);
+}
+
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+
+/* Maps every lane that is not 0 or 1 to 2. */
+static inline __m128i canon_epi32_sse2(__m128i v) {
+    __m128i known = _mm_or_si128(_mm_cmpeq_epi32(v, _mm_setzero_si128()),
+                                 _mm_cmpeq_epi32(v, _mm_set1_epi32(1)));
+    return _mm_or_si128(_mm_and_si128(v, known), _mm_andnot_si128(known, _mm_set1_epi32(2)));
+}
+
+static size_t narrow_sse2(tribool8 *dst, const tribool *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i a0 = canon_epi32_sse2(_mm_loadu_si128((const __m128i *)(src + i)));
+        __m128i a1 = canon_epi32_sse2(_mm_loadu_si128((const __m128i *)(src + i + 4)));
+        __m128i a2 = canon_epi32_sse2(_mm_loadu_si128((const __m128i *)(src + i + 8)));
+        __m128i a3 = canon_epi32_sse2(_mm_loadu_si128((const __m128i *)(src + i + 12)));
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3));
+        _mm_storeu_si128((__m128i *)(dst + i), packed);
+    }
+    return i;
+}
+
+static size_t widen_sse2(tribool *dst, const tribool8 *src, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i b = _mm_min_epu8(_mm_loadu_si128((const __m128i *)(src + i)), _mm_set1_epi8(2));
+        __m128i lo = _mm_unpacklo_epi8(b, zero);
+        __m128i hi = _mm_unpackhi_epi8(b, zero);
+        _mm_storeu_si128((__m128i *)(dst + i),      _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(dst + i + 4),  _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(dst + i + 8),  _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128((__m128i *)(dst + i + 12), _mm_unpackhi_epi16(hi, zero));
+    }
+    return i;
+}
+
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+FOSSIL_TYPE_TARGET_AVX2
+static inline __m256i canon_epi32_avx2(__m256i v) {
+    /* Lanes are unsigned-min'd against 2; 0 and 1 pass, everything else becomes 2. */
+    return _mm256_min_epu32(v, _mm256_set1_epi32(2));
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static size_t narrow_avx2(tribool8 *dst, const tribool *src, size_t count) {
+    /* packs/packus work per 128-bit half; this permute restores element order. */
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i a0 = canon_epi32_avx2(_mm256_loadu_si256((const __m256i *)(src + i)));
+        __m256i a1 = canon_epi32_avx2(_mm256_loadu_si256((const __m256i *)(src + i + 8)));
+        __m256i a2 = canon_epi32_avx2(_mm256_loadu_si256((const __m256i *)(src + i + 16)));
+        __m256i a3 = canon_epi32_avx2(_mm256_loadu_si256((const __m256i *)(src + i + 24)));
+        __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a0, a1), _mm256_packs_epi32(a2, a3));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_permutevar8x32_epi32(packed, order));
+    }
+    return i;
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static size_t widen_avx2(tribool *dst, const tribool8 *src, size_t count) {
+    const __m256i two = _mm256_set1_epi32(2);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i w = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + i)));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_min_epu32(w, two));
+    }
+    return i;
+}
+
+#endif
+
+void fossil_type_tribool_narrow(tribool8 *dst, const tribool *src, size_t count) {
+    size_t i = 0;
+    if (!dst || !src) return;
+    if (tribool_is_i32()) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+        if (fossil_type_simd_has_avx2()) i = narrow_avx2(dst, src, count);
+        else
+#endif
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+        i = narrow_sse2(dst, src, count);
+#endif
+    }
+    for (; i < count; i++) dst[i] = fossil_type_tribool8_from(src[i]);
+}
+
+void fossil_type_tribool_widen(tribool *dst, const tribool8 *src, size_t count) {
+    size_t i = 0;
+    if (!dst || !src) return;
+    if (tribool_is_i32()) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+        if (fossil_type_simd_has_avx2()) i = widen_avx2(dst, src, count);
+        else
+#endif
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+        i = widen_sse2(dst, src, count);
+#endif
+    }
+    for (; i < count; i++) dst[i] = fossil_type_tribool8_to(src[i]);
+}
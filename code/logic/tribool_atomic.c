@@ -0,0 +1,214 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE 1
+#endif
+
+#include "fossil/type/tribool_atomic.h"
+#include "atomic.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LANE_LO 0x5555555555555555ULL
+
+/* Lane and state codes: 00 FALSE, 01 TRUE, 10 UNKNOWN, 11 UNKNOWN with waiters. */
+#define CODE_UNKNOWN 2u
+#define CODE_WAITED  3u
+
+static uint32_t encode(tribool t) {
+    if (t == FOSSIL_TYPE_TRIBOOL_TRUE) return 1u;
+    if (t == FOSSIL_TYPE_TRIBOOL_FALSE) return 0u;
+    return CODE_UNKNOWN;
+}
+
+static tribool decode(uint32_t code) {
+    if (code == 1u) return FOSSIL_TYPE_TRIBOOL_TRUE;
+    if (code == 0u) return FOSSIL_TYPE_TRIBOOL_FALSE;
+    return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+}
+
+static int is_resolving_value(tribool t) {
+    return t == FOSSIL_TYPE_TRIBOOL_TRUE || t == FOSSIL_TYPE_TRIBOOL_FALSE;
+}
+
+/* ======================================================
+ * Single Value
+ * ====================================================== */
+
+void fossil_type_atomic_tribool_init(atomic_tribool *a, tribool t) {
+    if (!a) return;
+    fossil_type_atomic_init_u32(&a->state, encode(t));
+}
+
+tribool fossil_type_atomic_tribool_load(const atomic_tribool *a) {
+    if (!a) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    return decode(fossil_type_atomic_load_u32(&a->state));
+}
+
+int fossil_type_atomic_tribool_try_resolve(atomic_tribool *a, tribool value, tribool *observed) {
+    if (!a) {
+        if (observed) *observed = FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+        return 0;
+    }
+    uint32_t cur = fossil_type_atomic_load_u32(&a->state);
+    if (is_resolving_value(value)) {
+        while (cur >= CODE_UNKNOWN) {
+            if (fossil_type_atomic_cas_u32(&a->state, &cur, encode(value))) {
+                if (cur == CODE_WAITED) fossil_type_atomic_wake32((const void *)&a->state);
+                if (observed) *observed = value;
+                return 1;
+            }
+        }
+    }
+    if (observed) *observed = decode(cur);
+    return 0;
+}
+
+tribool fossil_type_atomic_tribool_wait(atomic_tribool *a) {
+    if (!a) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    uint32_t cur = fossil_type_atomic_load_u32(&a->state);
+    while (cur >= CODE_UNKNOWN) {
+        /* Announce the waiter first so the resolver knows to wake us. */
+        if (cur == CODE_UNKNOWN && !fossil_type_atomic_cas_u32(&a->state, &cur, CODE_WAITED)) continue;
+        fossil_type_atomic_wait32((const void *)&a->state, CODE_WAITED);
+        cur = fossil_type_atomic_load_u32(&a->state);
+    }
+    return decode(cur);
+}
+
+/* ======================================================
+ * Packed Array
+ * ====================================================== */
+
+static int is_little_endian(void) {
+    const uint16_t probe = 1;
+    unsigned char first;
+    memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+/*
+ * Futexes are 32 bits wide, so a lane waits on the half of its word that
+ * holds it: lanes 0..15 live in the low half, 16..31 in the high half.
+ */
+static const void *lane_half(const fossil_type_atomic_u64 *word, unsigned lane) {
+    int high = lane >= 16;
+    return (const unsigned char *)word + (high == is_little_endian() ? 4 : 0);
+}
+
+static uint32_t lane_half_value(uint64_t w, unsigned lane) {
+    return (uint32_t)(lane >= 16 ? w >> 32 : w);
+}
+
+int fossil_type_atomic_tribool_array_init(atomic_tribool_array *arr, size_t length) {
+    if (!arr) return -1;
+    arr->words = NULL;
+    arr->length = 0;
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(length);
+    if (nwords == 0) return 0;
+    if (nwords > SIZE_MAX / sizeof(*arr->words)) return -1;
+    arr->words = (fossil_type_atomic_u64 *)malloc(nwords * sizeof(*arr->words));
+    if (!arr->words) return -1;
+    for (size_t i = 0; i < nwords; i++) fossil_type_atomic_init_u64(&arr->words[i], LANE_LO << 1);
+    arr->length = length;
+    return 0;
+}
+
+void fossil_type_atomic_tribool_array_free(atomic_tribool_array *arr) {
+    if (!arr) return;
+    free((void *)arr->words);
+    arr->words = NULL;
+    arr->length = 0;
+}
+
+size_t fossil_type_atomic_tribool_array_length(const atomic_tribool_array *arr) {
+    return arr ? arr->length : 0;
+}
+
+tribool fossil_type_atomic_tribool_array_load(const atomic_tribool_array *arr, size_t index) {
+    if (!arr || index >= arr->length) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    uint64_t w = fossil_type_atomic_load_u64(&arr->words[index / 32]);
+    return decode((uint32_t)(w >> (2 * (index % 32))) & 3u);
+}
+
+int fossil_type_atomic_tribool_array_try_resolve(atomic_tribool_array *arr, size_t index,
+                                                 tribool value, tribool *observed) {
+    if (!arr || index >= arr->length) {
+        if (observed) *observed = FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+        return 0;
+    }
+    fossil_type_atomic_u64 *word = &arr->words[index / 32];
+    unsigned lane = (unsigned)(index % 32);
+    unsigned shift = 2 * lane;
+    uint64_t cur = fossil_type_atomic_load_u64(word);
+    uint32_t code = (uint32_t)(cur >> shift) & 3u;
+    if (is_resolving_value(value)) {
+        while (code >= CODE_UNKNOWN) {
+            uint64_t next = (cur & ~(3ULL << shift)) | ((uint64_t)encode(value) << shift);
+            if (fossil_type_atomic_cas_u64(word, &cur, next)) {
+                if (code == CODE_WAITED) fossil_type_atomic_wake32(lane_half(word, lane));
+                if (observed) *observed = value;
+                return 1;
+            }
+            /* Lost to a neighbouring lane or to the resolver of this one. */
+            code = (uint32_t)(cur >> shift) & 3u;
+        }
+    }
+    if (observed) *observed = decode(code);
+    return 0;
+}
+
+tribool fossil_type_atomic_tribool_array_wait(atomic_tribool_array *arr, size_t index) {
+    if (!arr || index >= arr->length) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    fossil_type_atomic_u64 *word = &arr->words[index / 32];
+    unsigned lane = (unsigned)(index % 32);
+    unsigned shift = 2 * lane;
+    uint64_t cur = fossil_type_atomic_load_u64(word);
+    for (;;) {
+        uint32_t code = (uint32_t)(cur >> shift) & 3u;
+        if (code < CODE_UNKNOWN) return decode(code);
+        if (code == CODE_UNKNOWN) {
+            uint64_t marked = cur | (1ULL << shift);
+            if (!fossil_type_atomic_cas_u64(word, &cur, marked)) continue;
+            cur = marked;
+        }
+        fossil_type_atomic_wait32(lane_half(word, lane), lane_half_value(cur, lane));
+        cur = fossil_type_atomic_load_u64(word);
+    }
+}
+
+int fossil_type_atomic_tribool_array_snapshot(const atomic_tribool_array *arr, tribool_vec *dst) {
+    if (!arr || !dst) return -1;
+    if (fossil_type_tribool_vec_resize(dst, arr->length) != 0) return -1;
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(arr->length);
+    for (size_t i = 0; i < nwords; i++) {
+        uint64_t w = fossil_type_atomic_load_u64(&arr->words[i]);
+        w &= ~((w >> 1) & LANE_LO); /* 11 -> 10: waiters are not part of the value */
+        dst->words[i] = w;
+    }
+    if (arr->length % 32) dst->words[nwords - 1] &= (1ULL << (2 * (arr->length % 32))) - 1;
+    return 0;
+}
@@ -0,0 +1,339 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_cmp.h"
+#include "simd.h"
+
+/* ======================================================
+ * Block kernels
+ *
+ * A block kernel compares up to 64 rows of a against b
+ * (row-wise, or against b[0] when broadcast is set) and
+ * returns three bitmaps: a < b, a == b and a > b. Every
+ * operator is a combination of these; keeping > separate
+ * makes NaN rows false for <, <=, ==, >, >= and true for
+ * !=, as IEEE 754 requires.
+ * ====================================================== */
+
+typedef struct cmp_masks {
+    uint64_t lt, eq, gt;
+} cmp_masks;
+
+typedef cmp_masks (*cmp_block_fn)(const void *a, const void *b, int broadcast, size_t n);
+
+#define CMP_BLOCK_SCALAR(NAME, T)                                                 \
+    static cmp_masks NAME(const void *pa, const void *pb, int broadcast, size_t n) { \
+        const T *a = (const T *)pa;                                               \
+        const T *b = (const T *)pb;                                               \
+        cmp_masks m = {0, 0, 0};                                                  \
+        for (size_t i = 0; i < n; i++) {                                          \
+            T y = b[broadcast ? 0 : i];                                           \
+            m.lt |= (uint64_t)(a[i] < y) << i;                                    \
+            m.eq |= (uint64_t)(a[i] == y) << i;                                   \
+            m.gt |= (uint64_t)(a[i] > y) << i;                                    \
+        }                                                                         \
+        return m;                                                                 \
+    }
+
+CMP_BLOCK_SCALAR(block_i32_scalar, i32)
+CMP_BLOCK_SCALAR(block_i64_scalar, i64)
+CMP_BLOCK_SCALAR(block_f32_scalar, f32)
+CMP_BLOCK_SCALAR(block_f64_scalar, f64)
+
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+
+static cmp_masks block_i32_sse2(const void *pa, const void *pb, int broadcast, size_t n) {
+    if (n != 64) return block_i32_scalar(pa, pb, broadcast, n);
+    const i32 *a = (const i32 *)pa;
+    const i32 *b = (const i32 *)pb;
+    __m128i y = _mm_set1_epi32(b[0]);
+    cmp_masks m = {0, 0, 0};
+    for (size_t i = 0; i < 64; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(a + i));
+        if (!broadcast) y = _mm_loadu_si128((const __m128i *)(b + i));
+        m.lt |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x, y))) << i;
+        m.eq |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, y))) << i;
+        m.gt |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x, y))) << i;
+    }
+    return m;
+}
+
+static cmp_masks block_f32_sse2(const void *pa, const void *pb, int broadcast, size_t n) {
+    if (n != 64) return block_f32_scalar(pa, pb, broadcast, n);
+    const f32 *a = (const f32 *)pa;
+    const f32 *b = (const f32 *)pb;
+    __m128 y = _mm_set1_ps(b[0]);
+    cmp_masks m = {0, 0, 0};
+    for (size_t i = 0; i < 64; i += 4) {
+        __m128 x = _mm_loadu_ps(a + i);
+        if (!broadcast) y = _mm_loadu_ps(b + i);
+        m.lt |= (uint64_t)_mm_movemask_ps(_mm_cmplt_ps(x, y)) << i;
+        m.eq |= (uint64_t)_mm_movemask_ps(_mm_cmpeq_ps(x, y)) << i;
+        m.gt |= (uint64_t)_mm_movemask_ps(_mm_cmpgt_ps(x, y)) << i;
+    }
+    return m;
+}
+
+static cmp_masks block_f64_sse2(const void *pa, const void *pb, int broadcast, size_t n) {
+    if (n != 64) return block_f64_scalar(pa, pb, broadcast, n);
+    const f64 *a = (const f64 *)pa;
+    const f64 *b = (const f64 *)pb;
+    __m128d y = _mm_set1_pd(b[0]);
+    cmp_masks m = {0, 0, 0};
+    for (size_t i = 0; i < 64; i += 2) {
+        __m128d x = _mm_loadu_pd(a + i);
+        if (!broadcast) y = _mm_loadu_pd(b + i);
+        m.lt |= (uint64_t)_mm_movemask_pd(_mm_cmplt_pd(x, y)) << i;
+        m.eq |= (uint64_t)_mm_movemask_pd(_mm_cmpeq_pd(x, y)) << i;
+        m.gt |= (uint64_t)_mm_movemask_pd(_mm_cmpgt_pd(x, y)) << i;
+    }
+    return m;
+}
+
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+FOSSIL_TYPE_TARGET_AVX2
+static cmp_masks block_i32_avx2(const void *pa, const void *pb, int broadcast, size_t n) {
+    if (n != 64) return block_i32_scalar(pa, pb, broadcast, n);
+    const i32 *a = (const i32 *)pa;
+    const i32 *b = (const i32 *)pb;
+    __m256i y = _mm256_set1_epi32(b[0]);
+    cmp_masks m = {0, 0, 0};
+    for (size_t i = 0; i < 64; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+        if (!broadcast) y = _mm256_loadu_si256((const __m256i *)(b + i));
+        m.lt |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(y, x))) << i;
+        m.eq |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, y))) << i;
+        m.gt |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, y))) << i;
+    }
+    return m;
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static cmp_masks block_i64_avx2(const void *pa, const void *pb, int broadcast, size_t n) {
+    if (n != 64) return block_i64_scalar(pa, pb, broadcast, n);
+    const i64 *a = (const i64 *)pa;
+    const i64 *b = (const i64 *)pb;
+    __m256i y = _mm256_set1_epi64x(b[0]);
+    cmp_masks m = {0, 0, 0};
+    for (size_t i = 0; i < 64; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+        if (!broadcast) y = _mm256_loadu_si256((const __m256i *)(b + i));
+        m.lt |= (uint64_t)(unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(y, x))) << i;
+        m.eq |= (uint64_t)(unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(x, y))) << i;
+        m.gt |= (uint64_t)(unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(x, y))) << i;
+    }
+    return m;
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static cmp_masks block_f32_avx2(const void *pa, const void *pb, int broadcast, size_t n) {
+    if (n != 64) return block_f32_scalar(pa, pb, broadcast, n);
+    const f32 *a = (const f32 *)pa;
+    const f32 *b = (const f32 *)pb;
+    __m256 y = _mm256_set1_ps(b[0]);
+    cmp_masks m = {0, 0, 0};
+    for (size_t i = 0; i < 64; i += 8) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        if (!broadcast) y = _mm256_loadu_ps(b + i);
+        m.lt |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_LT_OQ)) << i;
+        m.eq |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_EQ_OQ)) << i;
+        m.gt |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_GT_OQ)) << i;
+    }
+    return m;
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static cmp_masks block_f64_avx2(const void *pa, const void *pb, int broadcast, size_t n) {
+    if (n != 64) return block_f64_scalar(pa, pb, broadcast, n);
+    const f64 *a = (const f64 *)pa;
+    const f64 *b = (const f64 *)pb;
+    __m256d y = _mm256_set1_pd(b[0]);
+    cmp_masks m = {0, 0, 0};
+    for (size_t i = 0; i < 64; i += 4) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        if (!broadcast) y = _mm256_loadu_pd(b + i);
+        m.lt |= (uint64_t)(unsigned)_mm256_movemask_pd(_mm256_cmp_pd(x, y, _CMP_LT_OQ)) << i;
+        m.eq |= (uint64_t)(unsigned)_mm256_movemask_pd(_mm256_cmp_pd(x, y, _CMP_EQ_OQ)) << i;
+        m.gt |= (uint64_t)(unsigned)_mm256_movemask_pd(_mm256_cmp_pd(x, y, _CMP_GT_OQ)) << i;
+    }
+    return m;
+}
+
+#endif
+
+/* ======================================================
+ * Kernel selection
+ * ====================================================== */
+
+typedef struct cmp_kernels {
+    cmp_block_fn i32_block;
+    cmp_block_fn i64_block;
+    cmp_block_fn f32_block;
+    cmp_block_fn f64_block;
+} cmp_kernels;
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+static const cmp_kernels kernels_avx2 = { block_i32_avx2, block_i64_avx2, block_f32_avx2, block_f64_avx2 };
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+static const cmp_kernels kernels_base = { block_i32_sse2, block_i64_scalar, block_f32_sse2, block_f64_sse2 };
+#else
+static const cmp_kernels kernels_base = { block_i32_scalar, block_i64_scalar, block_f32_scalar, block_f64_scalar };
+#endif
+
+static const cmp_kernels *select_kernels(void) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) return &kernels_avx2;
+#endif
+    return &kernels_base;
+}
+
+/* ======================================================
+ * Drivers
+ * ====================================================== */
+
+static uint64_t cmp_select(fossil_type_cmp_op op, cmp_masks m) {
+    switch (op) {
+        case FOSSIL_TYPE_CMP_LT: return m.lt;
+        case FOSSIL_TYPE_CMP_LE: return m.lt | m.eq;
+        case FOSSIL_TYPE_CMP_EQ: return m.eq;
+        case FOSSIL_TYPE_CMP_NE: return ~m.eq;
+        case FOSSIL_TYPE_CMP_GT: return m.gt;
+        case FOSSIL_TYPE_CMP_GE: return m.gt | m.eq;
+        default: return 0;
+    }
+}
+
+static uint64_t block_valid(const b64 *valid, size_t block) {
+    return valid ? valid[block] : ~0ULL;
+}
+
+/*
+ * Writes 64 rows (two packed words) from a truth bitmap and a known bitmap.
+ * Rows past count are cleared by the caller's masks, keeping padding lanes 00.
+ */
+static void emit_block(tribool_vec *dst, size_t block, uint64_t truth, uint64_t known, uint64_t rows) {
+    uint64_t t = truth & known & rows;
+    uint64_t u = ~known & rows;
+    size_t w = block * 2;
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(dst->length);
+    dst->words[w] = fossil_type_bits_spread_even(t) | (fossil_type_bits_spread_even(u) << 1);
+    if (w + 1 < nwords) {
+        dst->words[w + 1] = fossil_type_bits_spread_even(t >> 32) | (fossil_type_bits_spread_even(u >> 32) << 1);
+    }
+}
+
+static uint64_t block_rows(size_t n) {
+    return n == 64 ? ~0ULL : (1ULL << n) - 1;
+}
+
+static int cmp_run(tribool_vec *dst, fossil_type_cmp_op op, const void *a, const b64 *a_valid,
+                   const void *b, const b64 *b_valid, int broadcast, size_t size, size_t count,
+                   cmp_block_fn fn) {
+    if (!dst || ((!a || !b) && count)) return -1;
+    if ((unsigned)op > (unsigned)FOSSIL_TYPE_CMP_GE) return -1;
+    if (fossil_type_tribool_vec_resize(dst, count) != 0) return -1;
+    const unsigned char *pa = (const unsigned char *)a;
+    const unsigned char *pb = (const unsigned char *)b;
+    for (size_t k = 0; k * 64 < count; k++) {
+        size_t n = count - k * 64 < 64 ? count - k * 64 : 64;
+        cmp_masks m = fn(pa + k * 64 * size, broadcast ? pb : pb + k * 64 * size, broadcast, n);
+        uint64_t known = block_valid(a_valid, k) & block_valid(b_valid, k);
+        emit_block(dst, k, cmp_select(op, m), known, block_rows(n));
+    }
+    return 0;
+}
+
+static int between_run(tribool_vec *dst, const void *a, const b64 *a_valid, const void *lo,
+                       const void *hi, size_t size, size_t count, cmp_block_fn fn) {
+    if (!dst || (!a && count)) return -1;
+    if (fossil_type_tribool_vec_resize(dst, count) != 0) return -1;
+    const unsigned char *pa = (const unsigned char *)a;
+    for (size_t k = 0; k * 64 < count; k++) {
+        size_t n = count - k * 64 < 64 ? count - k * 64 : 64;
+        cmp_masks ml = fn(pa + k * 64 * size, lo, 1, n);
+        cmp_masks mh = fn(pa + k * 64 * size, hi, 1, n);
+        uint64_t truth = (ml.gt | ml.eq) & (mh.lt | mh.eq);
+        emit_block(dst, k, truth, block_valid(a_valid, k), block_rows(n));
+    }
+    return 0;
+}
+
+static int in_run(tribool_vec *dst, const void *a, const b64 *a_valid, const void *list,
+                  size_t list_count, int list_has_null, size_t size, size_t count, cmp_block_fn fn) {
+    if (!dst || (!a && count) || (!list && list_count)) return -1;
+    if (fossil_type_tribool_vec_resize(dst, count) != 0) return -1;
+    const unsigned char *pa = (const unsigned char *)a;
+    const unsigned char *pl = (const unsigned char *)list;
+    for (size_t k = 0; k * 64 < count; k++) {
+        size_t n = count - k * 64 < 64 ? count - k * 64 : 64;
+        uint64_t rows = block_rows(n);
+        uint64_t hit = 0;
+        for (size_t j = 0; j < list_count && (hit & rows) != rows; j++) {
+            hit |= fn(pa + k * 64 * size, pl + j * size, 1, n).eq;
+        }
+        /* A miss against a list holding NULL is UNKNOWN rather than FALSE. */
+        uint64_t known = block_valid(a_valid, k) & (list_has_null ? hit : ~0ULL);
+        emit_block(dst, k, hit, known, rows);
+    }
+    return 0;
+}
+
+/* ======================================================
+ * Public entry points
+ * ====================================================== */
+
+#define CMP_DEFINE(T)                                                                            \
+    int fossil_type_tribool_cmp_##T(tribool_vec *dst, fossil_type_cmp_op op,                    \
+                                    const T *a, const b64 *a_valid,                              \
+                                    const T *b, const b64 *b_valid, size_t count) {              \
+        return cmp_run(dst, op, a, a_valid, b, b_valid, 0, sizeof(T), count,                     \
+                       select_kernels()->T##_block);                                              \
+    }                                                                                            \
+    int fossil_type_tribool_cmp_##T##_scalar(tribool_vec *dst, fossil_type_cmp_op op,            \
+                                             const T *a, const b64 *a_valid, T value,            \
+                                             size_t count) {                                     \
+        return cmp_run(dst, op, a, a_valid, &value, NULL, 1, sizeof(T), count,                   \
+                       select_kernels()->T##_block);                                              \
+    }                                                                                            \
+    int fossil_type_tribool_between_##T(tribool_vec *dst, const T *a, const b64 *a_valid,        \
+                                        T lo, T hi, size_t count) {                              \
+        return between_run(dst, a, a_valid, &lo, &hi, sizeof(T), count,                          \
+                           select_kernels()->T##_block);                                          \
+    }                                                                                            \
+    int fossil_type_tribool_in_##T(tribool_vec *dst, const T *a, const b64 *a_valid,             \
+                                   const T *list, size_t list_count, int list_has_null,          \
+                                   size_t count) {                                               \
+        return in_run(dst, a, a_valid, list, list_count, list_has_null, sizeof(T), count,        \
+                      select_kernels()->T##_block);                                               \
+    }
+
+CMP_DEFINE(i32)
+CMP_DEFINE(i64)
+CMP_DEFINE(f32)
+CMP_DEFINE(f64)
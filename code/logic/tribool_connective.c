@@ -0,0 +1,292 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool.h"
+#include "fossil/type/tribool_vec.h"
+#include "simd.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define LANE_LO 0x5555555555555555ULL
+
+/* ======================================================
+ * Connective formulas
+ *
+ * Each connective is written once over bit planes holding
+ * one bit per lane: ta/ua/fa say which lanes of a are
+ * TRUE/UNKNOWN/FALSE (likewise for b), and the formula
+ * yields the TRUE and UNKNOWN planes of the result. The
+ * same expressions compile for 64-bit words and, with the
+ * GCC/Clang vector extension, for 256-bit AVX2 vectors.
+ * Not every formula reads every plane.
+ * ====================================================== */
+
+#define XOR_T         ((ta & fb) | (fa & tb))
+#define XOR_U         (ua | ub)
+#define IMPLIES_T     (fa | tb)
+#define IMPLIES_U     ((ua | ub) & ~IMPLIES_T)
+#define EQUIV_T       ((ta & tb) | (fa & fb))
+#define EQUIV_U       (ua | ub)
+#define LUK_XOR_T     XOR_T
+#define LUK_XOR_U     (ua ^ ub)
+#define LUK_IMPLIES_T (fa | tb | (ua & ub))
+#define LUK_IMPLIES_U ((ua | ub) & ~LUK_IMPLIES_T)
+#define LUK_EQUIV_T   ((ta & tb) | (fa & fb) | (ua & ub))
+#define LUK_EQUIV_U   (ua ^ ub)
+#define CONSENSUS_T   (ta & tb)
+#define CONSENSUS_U   (lo & ~((ta & tb) | (fa & fb)))
+#define MERGE_T       ((ta | tb) & ~(fa | fb))
+#define MERGE_U       (lo & ~(MERGE_T | ((fa | fb) & ~(ta | tb))))
+
+#define CONNECTIVE_PLANES(a, b)            \
+    ta = (a) & lo;                         \
+    ua = ((a) >> 1) & lo;                  \
+    fa = lo & ~((a) | ((a) >> 1));         \
+    tb = (b) & lo;                         \
+    ub = ((b) >> 1) & lo;                  \
+    fb = lo & ~((b) | ((b) >> 1));         \
+    (void)ta; (void)ua; (void)fa;          \
+    (void)tb; (void)ub; (void)fb
+
+typedef void (*connective_fn)(uint64_t *, const uint64_t *, const uint64_t *, size_t);
+
+#define CONNECTIVE_SCALAR(NAME, RT, RU)                                                 \
+    static void NAME##_scalar(uint64_t *dst, const uint64_t *a, const uint64_t *b,      \
+                              size_t n) {                                               \
+        const uint64_t lo = LANE_LO;                                                    \
+        for (size_t i = 0; i < n; i++) {                                                \
+            uint64_t ta, ua, fa, tb, ub, fb;                                            \
+            CONNECTIVE_PLANES(a[i], b[i]);                                              \
+            dst[i] = (RT) | ((RU) << 1);                                                \
+        }                                                                               \
+    }
+
+CONNECTIVE_SCALAR(xor, XOR_T, XOR_U)
+CONNECTIVE_SCALAR(implies, IMPLIES_T, IMPLIES_U)
+CONNECTIVE_SCALAR(equiv, EQUIV_T, EQUIV_U)
+CONNECTIVE_SCALAR(luk_xor, LUK_XOR_T, LUK_XOR_U)
+CONNECTIVE_SCALAR(luk_implies, LUK_IMPLIES_T, LUK_IMPLIES_U)
+CONNECTIVE_SCALAR(luk_equiv, LUK_EQUIV_T, LUK_EQUIV_U)
+CONNECTIVE_SCALAR(consensus, CONSENSUS_T, CONSENSUS_U)
+CONNECTIVE_SCALAR(merge, MERGE_T, MERGE_U)
+
+/* ======================================================
+ * AVX2 kernels (4 words per step, runtime selected)
+ * ====================================================== */
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+typedef uint64_t connective_v4 __attribute__((vector_size(32)));
+
+#define CONNECTIVE_AVX2(NAME, RT, RU)                                                   \
+    FOSSIL_TYPE_TARGET_AVX2                                                             \
+    static void NAME##_avx2(uint64_t *dst, const uint64_t *a, const uint64_t *b,        \
+                            size_t n) {                                                 \
+        const connective_v4 lo = { LANE_LO, LANE_LO, LANE_LO, LANE_LO };                \
+        size_t i = 0;                                                                   \
+        for (; i + 4 <= n; i += 4) {                                                    \
+            connective_v4 va, vb, ta, ua, fa, tb, ub, fb, r;                            \
+            memcpy(&va, a + i, sizeof(va));                                             \
+            memcpy(&vb, b + i, sizeof(vb));                                             \
+            CONNECTIVE_PLANES(va, vb);                                                  \
+            r = (RT) | ((RU) << 1);                                                     \
+            memcpy(dst + i, &r, sizeof(r));                                             \
+        }                                                                               \
+        NAME##_scalar(dst + i, a + i, b + i, n - i);                                    \
+    }
+
+CONNECTIVE_AVX2(xor, XOR_T, XOR_U)
+CONNECTIVE_AVX2(implies, IMPLIES_T, IMPLIES_U)
+CONNECTIVE_AVX2(equiv, EQUIV_T, EQUIV_U)
+CONNECTIVE_AVX2(luk_xor, LUK_XOR_T, LUK_XOR_U)
+CONNECTIVE_AVX2(luk_implies, LUK_IMPLIES_T, LUK_IMPLIES_U)
+CONNECTIVE_AVX2(luk_equiv, LUK_EQUIV_T, LUK_EQUIV_U)
+CONNECTIVE_AVX2(consensus, CONSENSUS_T, CONSENSUS_U)
+CONNECTIVE_AVX2(merge, MERGE_T, MERGE_U)
+
+#endif
+
+/* ======================================================
+ * Kernel selection
+ * ====================================================== */
+
+typedef enum connective {
+    CONNECTIVE_XOR,
+    CONNECTIVE_IMPLIES,
+    CONNECTIVE_EQUIV,
+    CONNECTIVE_LUK_XOR,
+    CONNECTIVE_LUK_IMPLIES,
+    CONNECTIVE_LUK_EQUIV,
+    CONNECTIVE_CONSENSUS,
+    CONNECTIVE_MERGE,
+    CONNECTIVE_COUNT
+} connective;
+
+typedef struct connective_kernels {
+    connective_fn fn[CONNECTIVE_COUNT];
+} connective_kernels;
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+static const connective_kernels kernels_avx2 = { {
+    xor_avx2, implies_avx2, equiv_avx2, luk_xor_avx2,
+    luk_implies_avx2, luk_equiv_avx2, consensus_avx2, merge_avx2
+} };
+#endif
+
+/* Baseline builds rely on the compiler to vectorize the word loops. */
+static const connective_kernels kernels_base = { {
+    xor_scalar, implies_scalar, equiv_scalar, luk_xor_scalar,
+    luk_implies_scalar, luk_equiv_scalar, consensus_scalar, merge_scalar
+} };
+
+static const connective_kernels *select_kernels(void) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) return &kernels_avx2;
+#endif
+    return &kernels_base;
+}
+
+/* Padding lanes read as FALSE, and IMPLIES/EQUIV of two FALSEs is TRUE; re-zero them. */
+static void clear_tail(tribool_vec *v) {
+    size_t rem = v->length % FOSSIL_TYPE_TRIBOOL_VEC_LANES;
+    if (rem) v->words[v->length / FOSSIL_TYPE_TRIBOOL_VEC_LANES] &= (1ULL << (2 * rem)) - 1;
+}
+
+static int vec_connective(connective op, tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    if (!dst || !a || !b || a->length != b->length) return -1;
+    if (fossil_type_tribool_vec_resize(dst, a->length) != 0) return -1;
+    if (!a->length) return 0;
+    select_kernels()->fn[op](dst->words, a->words, b->words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(a->length));
+    clear_tail(dst);
+    return 0;
+}
+
+int fossil_type_tribool_vec_xor(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return vec_connective(CONNECTIVE_XOR, dst, a, b);
+}
+
+int fossil_type_tribool_vec_implies(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return vec_connective(CONNECTIVE_IMPLIES, dst, a, b);
+}
+
+int fossil_type_tribool_vec_equiv(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return vec_connective(CONNECTIVE_EQUIV, dst, a, b);
+}
+
+int fossil_type_tribool_vec_luk_xor(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return vec_connective(CONNECTIVE_LUK_XOR, dst, a, b);
+}
+
+int fossil_type_tribool_vec_luk_implies(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return vec_connective(CONNECTIVE_LUK_IMPLIES, dst, a, b);
+}
+
+int fossil_type_tribool_vec_luk_equiv(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return vec_connective(CONNECTIVE_LUK_EQUIV, dst, a, b);
+}
+
+int fossil_type_tribool_vec_consensus(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return vec_connective(CONNECTIVE_CONSENSUS, dst, a, b);
+}
+
+int fossil_type_tribool_vec_merge(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return vec_connective(CONNECTIVE_MERGE, dst, a, b);
+}
+
+/* ======================================================
+ * Threshold and majority
+ * ====================================================== */
+
+tribool fossil_type_tribool_threshold(const tribool *values, size_t count, size_t k) {
+    if (k == 0) return FOSSIL_TYPE_TRIBOOL_TRUE;
+    if (!values) return FOSSIL_TYPE_TRIBOOL_FALSE;
+    size_t t = fossil_type_tribool_count_true(values, count);
+    if (t >= k) return FOSSIL_TYPE_TRIBOOL_TRUE;
+    if (count - fossil_type_tribool_count_false(values, count) < k) return FOSSIL_TYPE_TRIBOOL_FALSE;
+    return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+}
+
+tribool fossil_type_tribool_majority(const tribool *values, size_t count) {
+    return fossil_type_tribool_threshold(values, count, count / 2 + 1);
+}
+
+/* Enough bit planes to count to SIZE_MAX; a call uses only bit_width(count) of them. */
+#define COUNTER_PLANES (sizeof(size_t) * 8)
+
+/* Adds one bit per lane (the set bits of x) to a bit-sliced counter of n planes. */
+static void counter_add(uint64_t *planes, size_t n, uint64_t x) {
+    for (size_t p = 0; x && p < n; p++) {
+        uint64_t carry = planes[p] & x;
+        planes[p] ^= x;
+        x = carry;
+    }
+}
+
+/* Lanes whose bit-sliced counter of n planes is at least k. */
+static uint64_t counter_at_least(const uint64_t *planes, size_t n, size_t k) {
+    if (n < COUNTER_PLANES && (k >> n) != 0) return 0;
+    uint64_t gt = 0, eq = ~0ULL;
+    for (size_t p = n; p-- > 0;) {
+        if ((k >> p) & 1u) {
+            eq &= planes[p];
+        } else {
+            gt |= eq & planes[p];
+            eq &= ~planes[p];
+        }
+    }
+    return gt | eq;
+}
+
+int fossil_type_tribool_vec_threshold(tribool_vec *dst, const tribool_vec *const *inputs, size_t count, size_t k) {
+    if (!dst || !inputs || count == 0) return -1;
+    for (size_t i = 0; i < count; i++) {
+        if (!inputs[i] || inputs[i]->length != inputs[0]->length) return -1;
+    }
+    size_t length = inputs[0]->length;
+    /* dst may be one of the inputs; they all share its length, so this never reallocates it. */
+    if (fossil_type_tribool_vec_resize(dst, length) != 0) return -1;
+    if (!length) return 0;
+
+    /* A lane counts to at most count, so O(log count) planes suffice. */
+    size_t planes = fossil_type_bit_width64((uint64_t)count);
+
+    /* Word w of dst is written only after word w of every input has been read. */
+    for (size_t w = 0; w < FOSSIL_TYPE_TRIBOOL_VEC_WORDS(length); w++) {
+        uint64_t trues[COUNTER_PLANES], maybes[COUNTER_PLANES];
+        for (size_t p = 0; p < planes; p++) trues[p] = maybes[p] = 0;
+        for (size_t i = 0; i < count; i++) {
+            uint64_t x = inputs[i]->words[w];
+            counter_add(trues, planes, x & LANE_LO);
+            counter_add(maybes, planes, (x | (x >> 1)) & LANE_LO);
+        }
+        uint64_t t = counter_at_least(trues, planes, k) & LANE_LO;
+        uint64_t u = counter_at_least(maybes, planes, k) & LANE_LO & ~t;
+        dst->words[w] = t | (u << 1);
+    }
+    clear_tail(dst);
+    return 0;
+}
+
+int fossil_type_tribool_vec_majority(tribool_vec *dst, const tribool_vec *const *inputs, size_t count) {
+    return fossil_type_tribool_vec_threshold(dst, inputs, count, count / 2 + 1);
+}
@@ -0,0 +1,369 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_expr.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define LANE_LO 0x5555555555555555ULL
+
+/* Marks an empty slot of the sharing index. */
+#define INDEX_EMPTY 0xFFFFFFFFu
+
+/* Rows processed per VM pass: 256 words, 8192 rows, 2 KiB per register. */
+#define VM_BLOCK_WORDS 256
+
+static u32 const_code(tribool t) {
+    if (t == FOSSIL_TYPE_TRIBOOL_TRUE) return 1u;
+    if (t == FOSSIL_TYPE_TRIBOOL_FALSE) return 0u;
+    return 2u;
+}
+
+static tribool const_value(u32 code) {
+    return code == 1u ? FOSSIL_TYPE_TRIBOOL_TRUE
+         : code == 0u ? FOSSIL_TYPE_TRIBOOL_FALSE : FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+}
+
+/* ======================================================
+ * Node sharing
+ * ====================================================== */
+
+static size_t node_hash(u32 op, u32 a, u32 b) {
+    uint64_t h = ((uint64_t)op << 58) ^ ((uint64_t)a << 29) ^ b;
+    h ^= h >> 31;
+    h *= 0x9E3779B97F4A7C15ULL;
+    return (size_t)(h ^ (h >> 29));
+}
+
+static int index_rebuild(tribool_expr *e, size_t size) {
+    u32 *index = (u32 *)malloc(size * sizeof(u32));
+    if (!index) return -1;
+    memset(index, 0xFF, size * sizeof(u32));
+    for (size_t id = 0; id < e->count; id++) {
+        const fossil_type_tribool_expr_node *n = &e->nodes[id];
+        size_t slot = node_hash(n->op, n->a, n->b) & (size - 1);
+        while (index[slot] != INDEX_EMPTY) slot = (slot + 1) & (size - 1);
+        index[slot] = (u32)id;
+    }
+    free(e->index);
+    e->index = index;
+    e->index_size = size;
+    return 0;
+}
+
+/* Returns the existing node equal to (op, a, b), or appends a new one. */
+static tribool_expr_id intern(tribool_expr *e, u32 op, u32 a, u32 b) {
+    if (e->count >= FOSSIL_TYPE_TRIBOOL_EXPR_INVALID) return FOSSIL_TYPE_TRIBOOL_EXPR_INVALID;
+    if ((e->count + 1) * 2 > e->index_size) {
+        size_t size = e->index_size ? e->index_size * 2 : 64;
+        if (size > SIZE_MAX / sizeof(u32) || index_rebuild(e, size) != 0) return FOSSIL_TYPE_TRIBOOL_EXPR_INVALID;
+    }
+
+    size_t mask = e->index_size - 1;
+    size_t slot = node_hash(op, a, b) & mask;
+    while (e->index[slot] != INDEX_EMPTY) {
+        const fossil_type_tribool_expr_node *n = &e->nodes[e->index[slot]];
+        if (n->op == op && n->a == a && n->b == b) return e->index[slot];
+        slot = (slot + 1) & mask;
+    }
+
+    if (e->count == e->capacity) {
+        size_t capacity = e->capacity ? e->capacity * 2 : 32;
+        if (capacity > SIZE_MAX / sizeof(*e->nodes)) return FOSSIL_TYPE_TRIBOOL_EXPR_INVALID;
+        fossil_type_tribool_expr_node *nodes =
+            (fossil_type_tribool_expr_node *)realloc(e->nodes, capacity * sizeof(*nodes));
+        if (!nodes) return FOSSIL_TYPE_TRIBOOL_EXPR_INVALID;
+        e->nodes = nodes;
+        e->capacity = capacity;
+    }
+
+    tribool_expr_id id = (tribool_expr_id)e->count++;
+    e->nodes[id].op = op;
+    e->nodes[id].a = a;
+    e->nodes[id].b = b;
+    e->index[slot] = id;
+    return id;
+}
+
+/* ======================================================
+ * Expression Builder
+ * ====================================================== */
+
+void fossil_type_tribool_expr_init(tribool_expr *e) {
+    if (!e) return;
+    e->nodes = NULL;
+    e->count = 0;
+    e->capacity = 0;
+    e->index = NULL;
+    e->index_size = 0;
+}
+
+void fossil_type_tribool_expr_free(tribool_expr *e) {
+    if (!e) return;
+    free(e->nodes);
+    free(e->index);
+    fossil_type_tribool_expr_init(e);
+}
+
+size_t fossil_type_tribool_expr_count(const tribool_expr *e) {
+    return e ? e->count : 0;
+}
+
+static int valid_id(const tribool_expr *e, tribool_expr_id id) {
+    return e && id < e->count;
+}
+
+static int is_const(const tribool_expr *e, tribool_expr_id id, tribool *value) {
+    if (e->nodes[id].op != FOSSIL_TYPE_TRIBOOL_OP_CONST) return 0;
+    *value = const_value(e->nodes[id].a);
+    return 1;
+}
+
+/* True when node id is op(x, _) or op(_, x). */
+static int has_operand(const tribool_expr *e, tribool_expr_id id, u32 op, tribool_expr_id x) {
+    const fossil_type_tribool_expr_node *n = &e->nodes[id];
+    return n->op == op && (n->a == x || n->b == x);
+}
+
+tribool_expr_id fossil_type_tribool_expr_const(tribool_expr *e, tribool t) {
+    if (!e) return FOSSIL_TYPE_TRIBOOL_EXPR_INVALID;
+    return intern(e, FOSSIL_TYPE_TRIBOOL_OP_CONST, const_code(t), 0);
+}
+
+tribool_expr_id fossil_type_tribool_expr_input(tribool_expr *e, u32 column) {
+    if (!e || column >= FOSSIL_TYPE_TRIBOOL_PROGRAM_INPUT) return FOSSIL_TYPE_TRIBOOL_EXPR_INVALID;
+    return intern(e, FOSSIL_TYPE_TRIBOOL_OP_INPUT, column, 0);
+}
+
+tribool_expr_id fossil_type_tribool_expr_not(tribool_expr *e, tribool_expr_id a) {
+    tribool ca;
+    if (!valid_id(e, a)) return FOSSIL_TYPE_TRIBOOL_EXPR_INVALID;
+    if (is_const(e, a, &ca)) return fossil_type_tribool_expr_const(e, fossil_type_tribool_not(ca));
+    if (e->nodes[a].op == FOSSIL_TYPE_TRIBOOL_OP_NOT) return e->nodes[a].a;
+    return intern(e, FOSSIL_TYPE_TRIBOOL_OP_NOT, a, 0);
+}
+
+/*
+ * AND and OR share one folder: `absorb` is the value that decides the
+ * result on its own (FALSE for AND), `identity` the one that drops out.
+ */
+static tribool_expr_id build_binary(tribool_expr *e, u32 op, u32 dual, tribool absorb, tribool identity,
+                                    tribool_expr_id a, tribool_expr_id b) {
+    tribool ca, cb;
+    if (!valid_id(e, a) || !valid_id(e, b)) return FOSSIL_TYPE_TRIBOOL_EXPR_INVALID;
+    if (a == b) return a;
+
+    int ka = is_const(e, a, &ca);
+    int kb = is_const(e, b, &cb);
+    if (ka && kb) {
+        return fossil_type_tribool_expr_const(e, op == FOSSIL_TYPE_TRIBOOL_OP_AND
+                                                     ? fossil_type_tribool_and(ca, cb)
+                                                     : fossil_type_tribool_or(ca, cb));
+    }
+    if (ka && ca == absorb) return a;
+    if (ka && ca == identity) return b;
+    if (kb && cb == absorb) return b;
+    if (kb && cb == identity) return a;
+
+    if (has_operand(e, b, dual, a)) return a;
+    if (has_operand(e, a, dual, b)) return b;
+
+    if (a > b) {
+        tribool_expr_id t = a;
+        a = b;
+        b = t;
+    }
+    return intern(e, op, a, b);
+}
+
+tribool_expr_id fossil_type_tribool_expr_and(tribool_expr *e, tribool_expr_id a, tribool_expr_id b) {
+    return build_binary(e, FOSSIL_TYPE_TRIBOOL_OP_AND, FOSSIL_TYPE_TRIBOOL_OP_OR,
+                        FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_TRUE, a, b);
+}
+
+tribool_expr_id fossil_type_tribool_expr_or(tribool_expr *e, tribool_expr_id a, tribool_expr_id b) {
+    return build_binary(e, FOSSIL_TYPE_TRIBOOL_OP_OR, FOSSIL_TYPE_TRIBOOL_OP_AND,
+                        FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_FALSE, a, b);
+}
+
+/* ======================================================
+ * Compiler
+ * ====================================================== */
+
+void fossil_type_tribool_program_init(tribool_program *p) {
+    if (!p) return;
+    p->code = NULL;
+    p->length = 0;
+    p->registers = 0;
+    p->inputs = 0;
+}
+
+void fossil_type_tribool_program_free(tribool_program *p) {
+    if (!p) return;
+    free(p->code);
+    fossil_type_tribool_program_init(p);
+}
+
+static int is_binary(u32 op) {
+    return op == FOSSIL_TYPE_TRIBOOL_OP_AND || op == FOSSIL_TYPE_TRIBOOL_OP_OR;
+}
+
+int fossil_type_tribool_program_compile(tribool_program *p, const tribool_expr *e, tribool_expr_id root) {
+    if (!p || !valid_id(e, root)) return -1;
+
+    size_t n = (size_t)root + 1;
+    u32 *uses = (u32 *)calloc(n, sizeof(u32));       /* readers not yet emitted */
+    u32 *loc = (u32 *)malloc(n * sizeof(u32));       /* operand encoding of each node */
+    u32 *spare = (u32 *)malloc(n * sizeof(u32));     /* stack of free registers */
+    unsigned char *live = (unsigned char *)calloc(n, 1);
+    fossil_type_tribool_insn *code = (fossil_type_tribool_insn *)malloc(n * sizeof(*code));
+    if (!uses || !loc || !spare || !live || !code) {
+        free(uses); free(loc); free(spare); free(live); free(code);
+        return -1;
+    }
+
+    /* Operands always have smaller ids, so one backward sweep finds every reachable node. */
+    live[root] = 1;
+    for (size_t id = n; id-- > 0;) {
+        const fossil_type_tribool_expr_node *node = &e->nodes[id];
+        if (!live[id]) continue;
+        if (node->op == FOSSIL_TYPE_TRIBOOL_OP_NOT || is_binary(node->op)) {
+            live[node->a] = 1;
+            uses[node->a]++;
+        }
+        if (is_binary(node->op)) {
+            live[node->b] = 1;
+            uses[node->b]++;
+        }
+    }
+
+    size_t length = 0, registers = 0, inputs = 0, nspare = 0;
+    for (size_t id = 0; id < n; id++) {
+        const fossil_type_tribool_expr_node *node = &e->nodes[id];
+        if (!live[id]) continue;
+
+        if (node->op == FOSSIL_TYPE_TRIBOOL_OP_INPUT) {
+            loc[id] = FOSSIL_TYPE_TRIBOOL_PROGRAM_INPUT | node->a;
+            if ((size_t)node->a + 1 > inputs) inputs = (size_t)node->a + 1;
+            if (id == root) {
+                fossil_type_tribool_insn mov = { FOSSIL_TYPE_TRIBOOL_OP_MOV, 0, loc[id], 0 };
+                code[length++] = mov;
+                registers = 1;
+            }
+            continue;
+        }
+
+        fossil_type_tribool_insn insn = { node->op, 0, node->a, 0 };
+        if (node->op != FOSSIL_TYPE_TRIBOOL_OP_CONST) {
+            insn.a = loc[node->a];
+            if (is_binary(node->op)) insn.b = loc[node->b];
+            /* Release operands first: kernels are lane-wise, so dst may reuse one. */
+            if (--uses[node->a] == 0 && !(loc[node->a] & FOSSIL_TYPE_TRIBOOL_PROGRAM_INPUT)) {
+                spare[nspare++] = loc[node->a];
+            }
+            if (is_binary(node->op) && --uses[node->b] == 0 &&
+                !(loc[node->b] & FOSSIL_TYPE_TRIBOOL_PROGRAM_INPUT)) {
+                spare[nspare++] = loc[node->b];
+            }
+        }
+        insn.dst = nspare ? spare[--nspare] : (u32)registers++;
+        loc[id] = insn.dst;
+        code[length++] = insn;
+    }
+
+    free(uses); free(loc); free(spare); free(live);
+    free(p->code);
+    p->code = code;
+    p->length = length;
+    p->registers = registers;
+    p->inputs = inputs;
+    return 0;
+}
+
+/* ======================================================
+ * VM
+ * ====================================================== */
+
+static const uint64_t *vm_operand(u32 x, uint64_t *regs, const tribool_vec *const *inputs, size_t off) {
+    if (x & FOSSIL_TYPE_TRIBOOL_PROGRAM_INPUT) return inputs[x & ~FOSSIL_TYPE_TRIBOOL_PROGRAM_INPUT]->words + off;
+    return regs + (size_t)x * VM_BLOCK_WORDS;
+}
+
+int fossil_type_tribool_program_run(const tribool_program *p, tribool_vec *dst,
+                                    const tribool_vec *const *inputs, size_t input_count) {
+    if (!p || !dst || !p->length || input_count < p->inputs || (input_count && !inputs)) return -1;
+
+    size_t length = dst->length;
+    for (size_t c = 0; c < input_count; c++) {
+        if (!inputs[c]) return -1;
+        if (c == 0) length = inputs[0]->length;
+        else if (inputs[c]->length != length) return -1;
+    }
+    if (p->registers > SIZE_MAX / (VM_BLOCK_WORDS * sizeof(uint64_t))) return -1;
+    if (fossil_type_tribool_vec_resize(dst, length) != 0) return -1;
+
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(length);
+    if (nwords == 0) return 0;
+    uint64_t *regs = (uint64_t *)malloc(p->registers * VM_BLOCK_WORDS * sizeof(uint64_t));
+    if (!regs) return -1;
+
+    for (size_t off = 0; off < nwords; off += VM_BLOCK_WORDS) {
+        size_t count = nwords - off < VM_BLOCK_WORDS ? nwords - off : VM_BLOCK_WORDS;
+        for (size_t i = 0; i < p->length; i++) {
+            const fossil_type_tribool_insn *insn = &p->code[i];
+            /* The root writes straight into dst; inputs of this block have already been read. */
+            uint64_t *out = i + 1 == p->length ? dst->words + off : regs + (size_t)insn->dst * VM_BLOCK_WORDS;
+            switch (insn->op) {
+            case FOSSIL_TYPE_TRIBOOL_OP_CONST: {
+                uint64_t pattern = (uint64_t)insn->a * LANE_LO;
+                for (size_t w = 0; w < count; w++) out[w] = pattern;
+                break;
+            }
+            case FOSSIL_TYPE_TRIBOOL_OP_MOV:
+                memmove(out, vm_operand(insn->a, regs, inputs, off), count * sizeof(uint64_t));
+                break;
+            case FOSSIL_TYPE_TRIBOOL_OP_NOT:
+                fossil_type_tribool_words_not(out, vm_operand(insn->a, regs, inputs, off), count);
+                break;
+            case FOSSIL_TYPE_TRIBOOL_OP_AND:
+                fossil_type_tribool_words_and(out, vm_operand(insn->a, regs, inputs, off),
+                                              vm_operand(insn->b, regs, inputs, off), count);
+                break;
+            case FOSSIL_TYPE_TRIBOOL_OP_OR:
+                fossil_type_tribool_words_or(out, vm_operand(insn->a, regs, inputs, off),
+                                             vm_operand(insn->b, regs, inputs, off), count);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    free(regs);
+
+    /* NOT and UNKNOWN constants set padding lanes; the vector keeps them FALSE. */
+    if (length % FOSSIL_TYPE_TRIBOOL_VEC_LANES) {
+        dst->words[nwords - 1] &= (1ULL << (2 * (length % FOSSIL_TYPE_TRIBOOL_VEC_LANES))) - 1;
+    }
+    return 0;
+}
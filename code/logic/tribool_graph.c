@@ -0,0 +1,234 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_graph.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define NONE FOSSIL_TYPE_TRIBOOL_GRAPH_INVALID
+
+static tribool normalize(tribool t) {
+    return (t == FOSSIL_TYPE_TRIBOOL_TRUE || t == FOSSIL_TYPE_TRIBOOL_FALSE) ? t : FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+}
+
+/* Grows *items to hold at least need elements of size elem. */
+static int reserve(void **items, size_t *capacity, size_t need, size_t elem) {
+    if (need <= *capacity) return 0;
+    size_t cap = *capacity ? *capacity : 16;
+    while (cap < need) {
+        if (cap > SIZE_MAX / 2) return -1;
+        cap *= 2;
+    }
+    if (cap > SIZE_MAX / elem) return -1;
+    void *grown = realloc(*items, cap * elem);
+    if (!grown) return -1;
+    *items = grown;
+    *capacity = cap;
+    return 0;
+}
+
+/* ======================================================
+ * Dirty queue
+ *
+ * A binary min-heap of node ids, so dirty nodes are
+ * recomputed in topological order. Its capacity tracks
+ * the node count and a node is queued at most once, so
+ * pushes never allocate.
+ * ====================================================== */
+
+static void queue_push(tribool_graph *g, u32 id) {
+    size_t i = g->queued++;
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (g->queue[parent] <= id) break;
+        g->queue[i] = g->queue[parent];
+        i = parent;
+    }
+    g->queue[i] = id;
+    g->nodes[id].dirty = 1;
+}
+
+static u32 queue_pop(tribool_graph *g) {
+    u32 top = g->queue[0];
+    u32 last = g->queue[--g->queued];
+    size_t i = 0;
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= g->queued) break;
+        if (child + 1 < g->queued && g->queue[child + 1] < g->queue[child]) child++;
+        if (last <= g->queue[child]) break;
+        g->queue[i] = g->queue[child];
+        i = child;
+    }
+    if (g->queued) g->queue[i] = last;
+    g->nodes[top].dirty = 0;
+    return top;
+}
+
+/* ======================================================
+ * Node evaluation
+ * ====================================================== */
+
+static void count_value(fossil_type_tribool_graph_node *n, tribool v, int delta) {
+    if (v == FOSSIL_TYPE_TRIBOOL_FALSE) n->n_false += (u32)delta;
+    else if (v == FOSSIL_TYPE_TRIBOOL_UNKNOWN) n->n_unknown += (u32)delta;
+}
+
+static tribool node_eval(const tribool_graph *g, const fossil_type_tribool_graph_node *n) {
+    switch (n->op) {
+    case FOSSIL_TYPE_TRIBOOL_OP_INPUT:
+        return n->pending;
+    case FOSSIL_TYPE_TRIBOOL_OP_NOT:
+        return fossil_type_tribool_not(g->nodes[g->operands[n->operand_first]].value);
+    case FOSSIL_TYPE_TRIBOOL_OP_AND:
+        if (n->n_false) return FOSSIL_TYPE_TRIBOOL_FALSE;
+        return n->n_unknown ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : FOSSIL_TYPE_TRIBOOL_TRUE;
+    default:
+        if (n->operand_count - n->n_false - n->n_unknown) return FOSSIL_TYPE_TRIBOOL_TRUE;
+        return n->n_unknown ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : FOSSIL_TYPE_TRIBOOL_FALSE;
+    }
+}
+
+/* ======================================================
+ * Building
+ * ====================================================== */
+
+void fossil_type_tribool_graph_init(tribool_graph *g) {
+    if (!g) return;
+    memset(g, 0, sizeof(*g));
+}
+
+void fossil_type_tribool_graph_free(tribool_graph *g) {
+    if (!g) return;
+    free(g->nodes);
+    free(g->operands);
+    free(g->edges);
+    free(g->queue);
+    fossil_type_tribool_graph_init(g);
+}
+
+size_t fossil_type_tribool_graph_count(const tribool_graph *g) {
+    return g ? g->count : 0;
+}
+
+static u32 add_node(tribool_graph *g, u32 op, tribool initial, const u32 *operands, size_t count) {
+    if (!g || (count && !operands) || g->count >= NONE || count >= NONE) return NONE;
+    for (size_t i = 0; i < count; i++) {
+        if (operands[i] >= g->count) return NONE;
+    }
+    if (reserve((void **)&g->nodes, &g->node_capacity, g->count + 1, sizeof(*g->nodes)) != 0 ||
+        reserve((void **)&g->queue, &g->queue_capacity, g->count + 1, sizeof(*g->queue)) != 0 ||
+        reserve((void **)&g->operands, &g->operand_capacity, g->operand_count + count, sizeof(u32)) != 0 ||
+        reserve((void **)&g->edges, &g->edge_capacity, g->edge_count + count, sizeof(*g->edges)) != 0) {
+        return NONE;
+    }
+    if (g->operand_count + count >= NONE || g->edge_count + count >= NONE) return NONE;
+
+    u32 id = (u32)g->count;
+    fossil_type_tribool_graph_node *n = &g->nodes[id];
+    memset(n, 0, sizeof(*n));
+    n->op = op;
+    n->pending = normalize(initial);
+    n->operand_first = (u32)g->operand_count;
+    n->operand_count = (u32)count;
+    n->dependents = NONE;
+    for (size_t i = 0; i < count; i++) {
+        fossil_type_tribool_graph_node *operand = &g->nodes[operands[i]];
+        fossil_type_tribool_graph_edge *edge = &g->edges[g->edge_count];
+        edge->node = id;
+        edge->next = operand->dependents;
+        operand->dependents = (u32)g->edge_count++;
+        g->operands[g->operand_count++] = operands[i];
+        count_value(n, operand->value, 1);
+    }
+    g->count++;
+    n->value = node_eval(g, n);
+    return id;
+}
+
+u32 fossil_type_tribool_graph_input(tribool_graph *g, tribool initial) {
+    return add_node(g, FOSSIL_TYPE_TRIBOOL_OP_INPUT, initial, NULL, 0);
+}
+
+u32 fossil_type_tribool_graph_not(tribool_graph *g, u32 a) {
+    return add_node(g, FOSSIL_TYPE_TRIBOOL_OP_NOT, FOSSIL_TYPE_TRIBOOL_UNKNOWN, &a, 1);
+}
+
+u32 fossil_type_tribool_graph_and(tribool_graph *g, const u32 *operands, size_t count) {
+    return add_node(g, FOSSIL_TYPE_TRIBOOL_OP_AND, FOSSIL_TYPE_TRIBOOL_UNKNOWN, operands, count);
+}
+
+u32 fossil_type_tribool_graph_or(tribool_graph *g, const u32 *operands, size_t count) {
+    return add_node(g, FOSSIL_TYPE_TRIBOOL_OP_OR, FOSSIL_TYPE_TRIBOOL_UNKNOWN, operands, count);
+}
+
+/* ======================================================
+ * Updating
+ * ====================================================== */
+
+int fossil_type_tribool_graph_set(tribool_graph *g, u32 input, tribool value) {
+    if (!g || input >= g->count || g->nodes[input].op != FOSSIL_TYPE_TRIBOOL_OP_INPUT) return -1;
+    fossil_type_tribool_graph_node *n = &g->nodes[input];
+    n->pending = normalize(value);
+    if (!n->dirty && n->pending != n->value) queue_push(g, input);
+    return 0;
+}
+
+size_t fossil_type_tribool_graph_update(tribool_graph *g) {
+    if (!g) return 0;
+    size_t recomputed = 0, changed = 0;
+    while (g->queued) {
+        u32 id = queue_pop(g);
+        fossil_type_tribool_graph_node *n = &g->nodes[id];
+        tribool old = n->value;
+        tribool now = node_eval(g, n);
+        recomputed++;
+        if (now == old) continue;
+
+        changed++;
+        n->value = now;
+        for (u32 e = n->dependents; e != NONE; e = g->edges[e].next) {
+            fossil_type_tribool_graph_node *d = &g->nodes[g->edges[e].node];
+            count_value(d, old, -1);
+            count_value(d, now, 1);
+            if (!d->dirty) queue_push(g, g->edges[e].node);
+        }
+    }
+    if (recomputed) g->stats.updates++;
+    g->stats.recomputed += recomputed;
+    g->stats.changed += changed;
+    g->stats.last_recomputed = recomputed;
+    g->stats.last_changed = changed;
+    return recomputed;
+}
+
+tribool fossil_type_tribool_graph_value(const tribool_graph *g, u32 id) {
+    if (!g || id >= g->count) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    return g->nodes[id].value;
+}
+
+fossil_type_tribool_graph_stats fossil_type_tribool_graph_get_stats(const tribool_graph *g) {
+    fossil_type_tribool_graph_stats zero = {0, 0, 0, 0, 0};
+    return g ? g->stats : zero;
+}
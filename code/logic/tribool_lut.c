@@ -0,0 +1,199 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_lut.h"
+#include "simd.h"
+#include <string.h>
+
+#define LANE_LO 0x5555555555555555ULL
+
+/* Row weight of each input: 3^i. */
+static const u32 lut_weight[FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY] = {1, 3, 9, 27, 81};
+
+/* The base-3 digit of a value; anything but TRUE/FALSE is UNKNOWN. */
+static u32 lut_digit(tribool t) {
+    if (t == FOSSIL_TYPE_TRIBOOL_FALSE) return 0;
+    if (t == FOSSIL_TYPE_TRIBOOL_TRUE) return 1;
+    return 2;
+}
+
+static tribool lut_value(tribool t) {
+    return (tribool)lut_digit(t);
+}
+
+/* ======================================================
+ * Compilation
+ * ====================================================== */
+
+static void lut_reset(tribool_lut *lut, size_t arity) {
+    memset(lut, 0, sizeof(*lut));
+    lut->arity = (u32)arity;
+    lut->rows = 1;
+    for (size_t i = 0; i < arity; i++) lut->rows *= 3;
+}
+
+int fossil_type_tribool_lut_compile(tribool_lut *lut, size_t arity, const tribool *table) {
+    if (!lut || !table || arity > FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY) return -1;
+    lut_reset(lut, arity);
+    for (u32 r = 0; r < lut->rows; r++) lut->table[r] = (u8)lut_value(table[r]);
+    return 0;
+}
+
+int fossil_type_tribool_lut_compile_fn(tribool_lut *lut, size_t arity, fossil_type_tribool_lut_fn fn, void *user) {
+    if (!lut || !fn || arity > FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY) return -1;
+    lut_reset(lut, arity);
+
+    /* Walk the rows as a base-3 odometer over the inputs. */
+    tribool inputs[FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY] = {FOSSIL_TYPE_TRIBOOL_FALSE};
+    for (u32 r = 0; r < lut->rows; r++) {
+        lut->table[r] = (u8)lut_value(fn(inputs, user));
+        for (size_t i = 0; i < arity; i++) {
+            u32 d = lut_digit(inputs[i]);
+            inputs[i] = (tribool)(d == 2 ? 0 : d + 1);
+            if (d != 2) break;
+        }
+    }
+    return 0;
+}
+
+/* ======================================================
+ * Evaluation
+ * ====================================================== */
+
+tribool fossil_type_tribool_lut_eval(const tribool_lut *lut, const tribool *inputs) {
+    if (!lut || (lut->arity && !inputs) || lut->arity > FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY) {
+        return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    }
+    u32 row = 0;
+    for (u32 i = 0; i < lut->arity; i++) row += lut_digit(inputs[i]) * lut_weight[i];
+    return (tribool)lut->table[row];
+}
+
+/*
+ * Word kernels: every lane of the 2-bit encoding already is
+ * its base-3 digit, so the row of a lane is the weighted sum
+ * of its lane codes across the input words. Word w of dst
+ * is written only after word w of every input was read.
+ */
+typedef void (*lut_kernel)(const tribool_lut *, uint64_t *, const uint64_t *const *, size_t);
+
+static void run_scalar(const tribool_lut *lut, uint64_t *dst, const uint64_t *const *in, size_t nwords) {
+    for (size_t w = 0; w < nwords; w++) {
+        uint64_t x[FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY];
+        for (u32 i = 0; i < lut->arity; i++) {
+            /* An invalid 11 lane reads as UNKNOWN, keeping rows in range. */
+            x[i] = in[i][w] & ~((in[i][w] >> 1) & LANE_LO);
+        }
+        uint64_t out = 0;
+        for (unsigned lane = 0; lane < FOSSIL_TYPE_TRIBOOL_VEC_LANES; lane++) {
+            u32 row = 0;
+            for (u32 i = 0; i < lut->arity; i++) row += (u32)((x[i] >> (2 * lane)) & 3u) * lut_weight[i];
+            out |= (uint64_t)lut->table[row] << (2 * lane);
+        }
+        dst[w] = out;
+    }
+}
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+/*
+ * Expands the 32 lanes of a word to one byte each, sums the
+ * weighted digits as bytes (rows stay below 256) and fetches
+ * the rows with 32-bit gathers at byte scale; the table is
+ * padded so a gather at row 242 stays in bounds. Bits 0 and 1
+ * of each gathered value become the TRUE and UNKNOWN planes.
+ */
+FOSSIL_TYPE_TARGET_AVX2
+static void run_avx2(const tribool_lut *lut, uint64_t *dst, const uint64_t *const *in, size_t nwords) {
+    const __m256i pick = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                          4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+    const __m256i lo_bit = _mm256_set1_epi32(0x40100401);
+    const __m256i hi_bit = _mm256_add_epi8(lo_bit, lo_bit);
+    const int *table = (const int *)(const void *)lut->table;
+    __m256i w1[FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY], w2[FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY];
+    for (u32 i = 0; i < lut->arity; i++) {
+        w1[i] = _mm256_set1_epi8((char)lut_weight[i]);
+        w2[i] = _mm256_set1_epi8((char)(2 * lut_weight[i]));
+    }
+
+    for (size_t w = 0; w < nwords; w++) {
+        __m256i row = _mm256_setzero_si256();
+        for (u32 i = 0; i < lut->arity; i++) {
+            __m256i x  = _mm256_shuffle_epi8(_mm256_set1_epi64x((long long)in[i][w]), pick);
+            __m256i hi = _mm256_cmpeq_epi8(_mm256_and_si256(x, hi_bit), hi_bit);
+            __m256i lo = _mm256_andnot_si256(hi, _mm256_cmpeq_epi8(_mm256_and_si256(x, lo_bit), lo_bit));
+            row = _mm256_add_epi8(row, _mm256_and_si256(lo, w1[i]));
+            row = _mm256_add_epi8(row, _mm256_and_si256(hi, w2[i]));
+        }
+
+        __m128i half[2] = { _mm256_castsi256_si128(row), _mm256_extracti128_si256(row, 1) };
+        uint32_t t = 0, u = 0;
+        for (int q = 0; q < 4; q++) {
+            __m128i bytes = (q & 1) ? _mm_srli_si128(half[q >> 1], 8) : half[q >> 1];
+            __m256i g = _mm256_i32gather_epi32(table, _mm256_cvtepu8_epi32(bytes), 1);
+            t |= (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(g, 31))) << (8 * q);
+            u |= (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(g, 30))) << (8 * q);
+        }
+        dst[w] = fossil_type_bits_spread_even(t) | (fossil_type_bits_spread_even(u) << 1);
+    }
+}
+
+#endif
+
+static lut_kernel select_kernel(void) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) return run_avx2;
+#endif
+    return run_scalar;
+}
+
+int fossil_type_tribool_lut_run(const tribool_lut *lut, tribool_vec *dst,
+                                const tribool_vec *const *inputs, size_t input_count) {
+    if (!lut || !dst || input_count != lut->arity || lut->arity > FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY) return -1;
+    if (input_count && !inputs) return -1;
+
+    size_t length = dst->length;
+    for (size_t c = 0; c < input_count; c++) {
+        if (!inputs[c]) return -1;
+        if (c == 0) length = inputs[0]->length;
+        else if (inputs[c]->length != length) return -1;
+    }
+    if (fossil_type_tribool_vec_resize(dst, length) != 0) return -1;
+    if (input_count == 0) {
+        fossil_type_tribool_vec_fill(dst, (tribool)lut->table[0]);
+        return 0;
+    }
+
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(length);
+    if (nwords == 0) return 0;
+    const uint64_t *in[FOSSIL_TYPE_TRIBOOL_LUT_MAX_ARITY];
+    for (size_t c = 0; c < input_count; c++) in[c] = inputs[c]->words;
+    select_kernel()(lut, dst->words, in, nwords);
+
+    /* Padding lanes read row 0, which need not be FALSE; the vector keeps them FALSE. */
+    if (length % FOSSIL_TYPE_TRIBOOL_VEC_LANES) {
+        dst->words[nwords - 1] &= (1ULL << (2 * (length % FOSSIL_TYPE_TRIBOOL_VEC_LANES))) - 1;
+    }
+    return 0;
+}
@@ -0,0 +1,544 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE 1
+#endif
+
+#include "fossil/type/tribool_par.h"
+#include "atomic.h"
+#include "simd.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if !defined(_WIN32)
+#  include <pthread.h>
+#  include <unistd.h>
+#endif
+
+/* ======================================================
+ * Platform threads
+ * ====================================================== */
+
+#if defined(_WIN32)
+
+typedef HANDLE pool_thread;
+typedef SRWLOCK pool_mutex;
+typedef CONDITION_VARIABLE pool_cond;
+
+static void pool_mutex_init(pool_mutex *m) { InitializeSRWLock(m); }
+static void pool_mutex_destroy(pool_mutex *m) { (void)m; }
+static void pool_lock(pool_mutex *m) { AcquireSRWLockExclusive(m); }
+static void pool_unlock(pool_mutex *m) { ReleaseSRWLockExclusive(m); }
+static void pool_cond_init(pool_cond *c) { InitializeConditionVariable(c); }
+static void pool_cond_destroy(pool_cond *c) { (void)c; }
+static void pool_cond_wait(pool_cond *c, pool_mutex *m) { SleepConditionVariableSRW(c, m, INFINITE, 0); }
+static void pool_cond_broadcast(pool_cond *c) { WakeAllConditionVariable(c); }
+
+static size_t pool_online_processors(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? (size_t)info.dwNumberOfProcessors : 1;
+}
+
+#else
+
+typedef pthread_t pool_thread;
+typedef pthread_mutex_t pool_mutex;
+typedef pthread_cond_t pool_cond;
+
+static void pool_mutex_init(pool_mutex *m) { pthread_mutex_init(m, NULL); }
+static void pool_mutex_destroy(pool_mutex *m) { pthread_mutex_destroy(m); }
+static void pool_lock(pool_mutex *m) { pthread_mutex_lock(m); }
+static void pool_unlock(pool_mutex *m) { pthread_mutex_unlock(m); }
+static void pool_cond_init(pool_cond *c) { pthread_cond_init(c, NULL); }
+static void pool_cond_destroy(pool_cond *c) { pthread_cond_destroy(c); }
+static void pool_cond_wait(pool_cond *c, pool_mutex *m) { pthread_cond_wait(c, m); }
+static void pool_cond_broadcast(pool_cond *c) { pthread_cond_broadcast(c); }
+
+static size_t pool_online_processors(void) {
+#if defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (size_t)n : 1;
+#else
+    return 1;
+#endif
+}
+
+#endif
+
+/* ======================================================
+ * Pool state
+ *
+ * Each thread owns a run of chunk indices packed into one
+ * word as end << 32 | next. The owner takes chunks from the
+ * front; a thief moves the back half of a run to its own
+ * slot with one CAS, so every chunk sits in exactly one run
+ * until it is taken.
+ * ====================================================== */
+
+typedef struct pool_worker {
+    struct fossil_type_tribool_pool_impl *impl;
+    size_t id;
+    pool_thread thread;
+} pool_worker;
+
+struct fossil_type_tribool_pool_impl {
+    pool_mutex lock;
+    pool_cond wake;             /* Signals a new job or shutdown to the workers. */
+    pool_cond done;             /* Signals the caller that the workers finished. */
+    size_t threads;             /* Caller plus started workers. */
+    uint64_t generation;        /* Bumped once per job. */
+    size_t active;              /* Workers still inside the current job. */
+    int stop;
+
+    fossil_type_tribool_pool_fn fn;
+    void *ctx;
+    size_t count;
+    size_t grain;
+
+    fossil_type_atomic_u64 *runs;
+    pool_worker *workers;
+};
+
+typedef struct fossil_type_tribool_pool_impl pool_impl;
+
+#define RUN(next, end) (((uint64_t)(end) << 32) | (uint64_t)(next))
+#define RUN_NEXT(r)    ((uint32_t)(r))
+#define RUN_END(r)     ((uint32_t)((r) >> 32))
+
+static int run_pop(fossil_type_atomic_u64 *run, uint32_t *chunk) {
+    uint64_t r = fossil_type_atomic_load_u64(run);
+    while (RUN_NEXT(r) < RUN_END(r)) {
+        if (fossil_type_atomic_cas_u64(run, &r, r + 1)) {
+            *chunk = RUN_NEXT(r);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Moves the back half of the longest other run into the slot of self. */
+static int run_steal(pool_impl *p, size_t self) {
+    for (;;) {
+        size_t victim = SIZE_MAX;
+        uint32_t longest = 0;
+        for (size_t i = 0; i < p->threads; i++) {
+            uint64_t r = fossil_type_atomic_load_u64(&p->runs[i]);
+            if (i != self && RUN_NEXT(r) < RUN_END(r) && RUN_END(r) - RUN_NEXT(r) > longest) {
+                longest = RUN_END(r) - RUN_NEXT(r);
+                victim = i;
+            }
+        }
+        if (victim == SIZE_MAX) return 0;
+
+        uint64_t r = fossil_type_atomic_load_u64(&p->runs[victim]);
+        uint32_t next = RUN_NEXT(r), end = RUN_END(r);
+        if (next >= end) continue;
+        uint32_t mid = next + (end - next) / 2;
+        if (fossil_type_atomic_cas_u64(&p->runs[victim], &r, RUN(next, mid))) {
+            fossil_type_atomic_store_u64(&p->runs[self], RUN(mid, end));
+            return 1;
+        }
+    }
+}
+
+static void pool_work(pool_impl *p, size_t self) {
+    for (;;) {
+        uint32_t chunk;
+        if (!run_pop(&p->runs[self], &chunk)) {
+            if (!run_steal(p, self)) return;
+            continue;
+        }
+        size_t begin = (size_t)chunk * p->grain;
+        size_t end = p->count - begin > p->grain ? begin + p->grain : p->count;
+        p->fn(p->ctx, chunk, begin, end);
+    }
+}
+
+static void pool_worker_loop(pool_worker *w) {
+    pool_impl *p = w->impl;
+    uint64_t seen = 0;
+    pool_lock(&p->lock);
+    for (;;) {
+        while (!p->stop && p->generation == seen) pool_cond_wait(&p->wake, &p->lock);
+        if (p->stop) break;
+        seen = p->generation;
+        pool_unlock(&p->lock);
+        pool_work(p, w->id);
+        pool_lock(&p->lock);
+        if (--p->active == 0) pool_cond_broadcast(&p->done);
+    }
+    pool_unlock(&p->lock);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI pool_thread_main(LPVOID arg) {
+    pool_worker_loop((pool_worker *)arg);
+    return 0;
+}
+
+static int pool_thread_start(pool_worker *w) {
+    w->thread = CreateThread(NULL, 0, pool_thread_main, w, 0, NULL);
+    return w->thread ? 0 : -1;
+}
+
+static void pool_thread_join(pool_worker *w) {
+    WaitForSingleObject(w->thread, INFINITE);
+    CloseHandle(w->thread);
+}
+#else
+static void *pool_thread_main(void *arg) {
+    pool_worker_loop((pool_worker *)arg);
+    return NULL;
+}
+
+static int pool_thread_start(pool_worker *w) {
+    return pthread_create(&w->thread, NULL, pool_thread_main, w) == 0 ? 0 : -1;
+}
+
+static void pool_thread_join(pool_worker *w) {
+    pthread_join(w->thread, NULL);
+}
+#endif
+
+/* ======================================================
+ * Pool Management
+ * ====================================================== */
+
+static void pool_shutdown(pool_impl *p) {
+    pool_lock(&p->lock);
+    p->stop = 1;
+    pool_cond_broadcast(&p->wake);
+    pool_unlock(&p->lock);
+    for (size_t i = 1; i < p->threads; i++) pool_thread_join(&p->workers[i]);
+    pool_cond_destroy(&p->done);
+    pool_cond_destroy(&p->wake);
+    pool_mutex_destroy(&p->lock);
+    free(p->workers);
+    free((void *)p->runs);
+    free(p);
+}
+
+int fossil_type_tribool_pool_init(tribool_pool *pool, size_t threads) {
+    if (!pool) return -1;
+    pool->impl = NULL;
+    pool->threads = 1;
+    pool->grain = FOSSIL_TYPE_TRIBOOL_POOL_GRAIN;
+    if (threads == 0) threads = pool_online_processors();
+    if (threads > FOSSIL_TYPE_TRIBOOL_POOL_MAX_THREADS) threads = FOSSIL_TYPE_TRIBOOL_POOL_MAX_THREADS;
+
+    pool_impl *p = (pool_impl *)calloc(1, sizeof(*p));
+    if (!p) return -1;
+    p->runs = (fossil_type_atomic_u64 *)calloc(threads, sizeof(*p->runs));
+    p->workers = (pool_worker *)calloc(threads, sizeof(*p->workers));
+    if (!p->runs || !p->workers) {
+        free(p->workers);
+        free((void *)p->runs);
+        free(p);
+        return -1;
+    }
+    for (size_t i = 0; i < threads; i++) fossil_type_atomic_init_u64(&p->runs[i], 0);
+    pool_mutex_init(&p->lock);
+    pool_cond_init(&p->wake);
+    pool_cond_init(&p->done);
+
+    /* p->threads only counts workers that really started, so shutdown joins exactly those. */
+    p->threads = 1;
+    for (size_t i = 1; i < threads; i++) {
+        p->workers[i].impl = p;
+        p->workers[i].id = i;
+        if (pool_thread_start(&p->workers[i]) != 0) break;
+        p->threads++;
+    }
+    if (threads > 1 && p->threads == 1) {
+        pool_shutdown(p);
+        return -1;
+    }
+    pool->impl = p;
+    pool->threads = p->threads;
+    return 0;
+}
+
+void fossil_type_tribool_pool_free(tribool_pool *pool) {
+    if (!pool || !pool->impl) return;
+    pool_shutdown(pool->impl);
+    pool->impl = NULL;
+    pool->threads = 1;
+}
+
+void fossil_type_tribool_pool_set_grain(tribool_pool *pool, size_t words) {
+    if (pool) pool->grain = words ? words : FOSSIL_TYPE_TRIBOOL_POOL_GRAIN;
+}
+
+int fossil_type_tribool_pool_for(tribool_pool *pool, size_t count, size_t grain,
+                                 fossil_type_tribool_pool_fn fn, void *ctx) {
+    if (!fn) return -1;
+    if (count == 0) return 0;
+    pool_impl *p = pool ? pool->impl : NULL;
+    size_t threads = p ? p->threads : 1;
+    if (grain == 0) grain = (count - 1) / threads + 1;
+    size_t chunks = (count - 1) / grain + 1;
+    if (chunks > UINT32_MAX) return -1;
+
+    if (threads == 1 || chunks == 1) {
+        for (size_t c = 0; c < chunks; c++) {
+            size_t begin = c * grain;
+            fn(ctx, c, begin, count - begin > grain ? begin + grain : count);
+        }
+        return 0;
+    }
+
+    /* Hand every thread an equal run of chunks; the mutex publishes them with the job. */
+    for (size_t i = 0; i < threads; i++) {
+        fossil_type_atomic_store_u64(&p->runs[i], RUN(chunks * i / threads, chunks * (i + 1) / threads));
+    }
+    pool_lock(&p->lock);
+    p->fn = fn;
+    p->ctx = ctx;
+    p->count = count;
+    p->grain = grain;
+    p->active = threads - 1;
+    p->generation++;
+    pool_cond_broadcast(&p->wake);
+    pool_unlock(&p->lock);
+
+    pool_work(p, 0);
+
+    pool_lock(&p->lock);
+    while (p->active) pool_cond_wait(&p->done, &p->lock);
+    pool_unlock(&p->lock);
+    return 0;
+}
+
+/* ======================================================
+ * Parallel Bulk Operations
+ * ====================================================== */
+
+enum { PAR_AND, PAR_OR, PAR_NOT };
+
+typedef struct par_words {
+    int op;
+    uint64_t *dst;
+    const uint64_t *a;
+    const uint64_t *b;
+} par_words;
+
+static void par_words_chunk(void *ctx, size_t chunk, size_t begin, size_t end) {
+    const par_words *job = (const par_words *)ctx;
+    (void)chunk;
+    switch (job->op) {
+    case PAR_AND:
+        fossil_type_tribool_words_and(job->dst + begin, job->a + begin, job->b + begin, end - begin);
+        break;
+    case PAR_OR:
+        fossil_type_tribool_words_or(job->dst + begin, job->a + begin, job->b + begin, end - begin);
+        break;
+    default:
+        fossil_type_tribool_words_not(job->dst + begin, job->a + begin, end - begin);
+        break;
+    }
+}
+
+static size_t par_grain(const tribool_pool *pool) {
+    return pool && pool->grain ? pool->grain : FOSSIL_TYPE_TRIBOOL_POOL_GRAIN;
+}
+
+static int par_vec_words(tribool_pool *pool, int op, tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    if (!dst || !a || (op != PAR_NOT && (!b || a->length != b->length))) return -1;
+    if (fossil_type_tribool_vec_resize(dst, a->length) != 0) return -1;
+    if (!a->length) return 0;
+
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(a->length);
+    par_words job = { op, dst->words, a->words, b ? b->words : NULL };
+    if (fossil_type_tribool_pool_for(pool, nwords, par_grain(pool), par_words_chunk, &job) != 0) return -1;
+
+    /* NOT turns FALSE padding lanes into TRUE; the vector keeps them FALSE. */
+    if (a->length % FOSSIL_TYPE_TRIBOOL_VEC_LANES) {
+        dst->words[nwords - 1] &= (1ULL << (2 * (a->length % FOSSIL_TYPE_TRIBOOL_VEC_LANES))) - 1;
+    }
+    return 0;
+}
+
+int fossil_type_tribool_vec_and_par(tribool_pool *pool, tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return par_vec_words(pool, PAR_AND, dst, a, b);
+}
+
+int fossil_type_tribool_vec_or_par(tribool_pool *pool, tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    return par_vec_words(pool, PAR_OR, dst, a, b);
+}
+
+int fossil_type_tribool_vec_not_par(tribool_pool *pool, tribool_vec *dst, const tribool_vec *a) {
+    return par_vec_words(pool, PAR_NOT, dst, a, NULL);
+}
+
+/*
+ * Reductions run the serial kernel over a view of each chunk and
+ * store one partial per chunk; the caller folds them in chunk
+ * order. Once a chunk settles all/any, later chunks skip their
+ * scan: the settling value dominates the fold, so the result is
+ * unchanged. Counting FALSE reads each word once and stores two
+ * partials per chunk, TRUE and UNKNOWN; FALSE is what is left.
+ */
+enum { PAR_ALL, PAR_ANY, PAR_COUNT_TRUE, PAR_COUNT_UNKNOWN, PAR_COUNT_SPLIT };
+
+#define LANE_LO 0x5555555555555555ULL
+#define LANE_HI 0xAAAAAAAAAAAAAAAAULL
+
+typedef struct par_reduce {
+    int op;
+    const tribool_vec *v;
+    tribool *values;
+    size_t *counts;
+    fossil_type_atomic_u32 settled;
+} par_reduce;
+
+static void par_reduce_chunk(void *ctx, size_t chunk, size_t begin, size_t end) {
+    par_reduce *job = (par_reduce *)ctx;
+    size_t first = begin * FOSSIL_TYPE_TRIBOOL_VEC_LANES;
+    size_t lanes = end * FOSSIL_TYPE_TRIBOOL_VEC_LANES < job->v->length
+                 ? (end - begin) * FOSSIL_TYPE_TRIBOOL_VEC_LANES : job->v->length - first;
+    tribool_vec view = { job->v->words + begin, lanes };
+
+    switch (job->op) {
+    case PAR_ALL:
+    case PAR_ANY: {
+        tribool settle = job->op == PAR_ALL ? FOSSIL_TYPE_TRIBOOL_FALSE : FOSSIL_TYPE_TRIBOOL_TRUE;
+        if (fossil_type_atomic_load_u32(&job->settled)) {
+            job->values[chunk] = fossil_type_tribool_not(settle);
+            return;
+        }
+        job->values[chunk] = job->op == PAR_ALL ? fossil_type_tribool_vec_all(&view) : fossil_type_tribool_vec_any(&view);
+        if (job->values[chunk] == settle) fossil_type_atomic_store_u32(&job->settled, 1);
+        break;
+    }
+    case PAR_COUNT_TRUE:
+        job->counts[chunk] = fossil_type_tribool_vec_count_true(&view);
+        break;
+    case PAR_COUNT_SPLIT: {
+        /* Padding lanes are 00, so whole words can be counted. */
+        size_t t = 0, u = 0;
+        for (size_t w = begin; w < end; w++) {
+            uint64_t x = job->v->words[w];
+            t += fossil_type_popcount64(x & LANE_LO);
+            u += fossil_type_popcount64(x & LANE_HI);
+        }
+        job->counts[2 * chunk] = t;
+        job->counts[2 * chunk + 1] = u;
+        break;
+    }
+    default:
+        job->counts[chunk] = fossil_type_tribool_vec_count_unknown(&view);
+        break;
+    }
+}
+
+/* Runs a reduction job; returns 0 and fills values or counts, or -1 to fall back to serial. */
+static int par_reduce_run(tribool_pool *pool, par_reduce *job, size_t *chunks) {
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(job->v->length);
+    size_t grain = par_grain(pool);
+    *chunks = (nwords - 1) / grain + 1;
+    if (!pool || !pool->impl || *chunks == 1) return -1;
+
+    job->values = NULL;
+    job->counts = NULL;
+    if (job->op == PAR_ALL || job->op == PAR_ANY) job->values = (tribool *)malloc(*chunks * sizeof(tribool));
+    else job->counts = (size_t *)malloc(*chunks * (job->op == PAR_COUNT_SPLIT ? 2 : 1) * sizeof(size_t));
+    if (!job->values && !job->counts) return -1;
+    fossil_type_atomic_init_u32(&job->settled, 0);
+
+    if (fossil_type_tribool_pool_for(pool, nwords, grain, par_reduce_chunk, job) != 0) {
+        free(job->values);
+        free(job->counts);
+        return -1;
+    }
+    return 0;
+}
+
+static tribool par_fold(tribool_pool *pool, int op, const tribool_vec *v) {
+    par_reduce job;
+    size_t chunks;
+    job.op = op;
+    job.v = v;
+    if (par_reduce_run(pool, &job, &chunks) != 0) {
+        return op == PAR_ALL ? fossil_type_tribool_vec_all(v) : fossil_type_tribool_vec_any(v);
+    }
+    tribool r = job.values[0];
+    for (size_t c = 1; c < chunks; c++) {
+        r = op == PAR_ALL ? fossil_type_tribool_and(r, job.values[c]) : fossil_type_tribool_or(r, job.values[c]);
+    }
+    free(job.values);
+    return r;
+}
+
+static size_t par_count(tribool_pool *pool, int op, const tribool_vec *v) {
+    par_reduce job;
+    size_t chunks;
+    job.op = op;
+    job.v = v;
+    if (par_reduce_run(pool, &job, &chunks) != 0) {
+        return op == PAR_COUNT_TRUE ? fossil_type_tribool_vec_count_true(v) : fossil_type_tribool_vec_count_unknown(v);
+    }
+    size_t total = 0;
+    for (size_t c = 0; c < chunks; c++) total += job.counts[c];
+    free(job.counts);
+    return total;
+}
+
+tribool fossil_type_tribool_vec_all_par(tribool_pool *pool, const tribool_vec *v) {
+    if (!v || !v->length) return FOSSIL_TYPE_TRIBOOL_TRUE;
+    return par_fold(pool, PAR_ALL, v);
+}
+
+tribool fossil_type_tribool_vec_any_par(tribool_pool *pool, const tribool_vec *v) {
+    if (!v || !v->length) return FOSSIL_TYPE_TRIBOOL_FALSE;
+    return par_fold(pool, PAR_ANY, v);
+}
+
+size_t fossil_type_tribool_vec_count_true_par(tribool_pool *pool, const tribool_vec *v) {
+    if (!v || !v->length) return 0;
+    return par_count(pool, PAR_COUNT_TRUE, v);
+}
+
+size_t fossil_type_tribool_vec_count_unknown_par(tribool_pool *pool, const tribool_vec *v) {
+    if (!v || !v->length) return 0;
+    return par_count(pool, PAR_COUNT_UNKNOWN, v);
+}
+
+size_t fossil_type_tribool_vec_count_false_par(tribool_pool *pool, const tribool_vec *v) {
+    if (!v || !v->length) return 0;
+    par_reduce job;
+    size_t chunks;
+    job.op = PAR_COUNT_SPLIT;
+    job.v = v;
+    if (par_reduce_run(pool, &job, &chunks) != 0) return fossil_type_tribool_vec_count_false(v);
+    size_t trues = 0, unknowns = 0;
+    for (size_t c = 0; c < chunks; c++) {
+        trues += job.counts[2 * c];
+        unknowns += job.counts[2 * c + 1];
+    }
+    free(job.counts);
+    return v->length - trues - unknowns;
+}
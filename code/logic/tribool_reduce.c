@@ -0,0 +1,465 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool.h"
+#include "fossil/type/tribool_vec.h"
+#include "fossil/type/tribool_slice.h"
+#include "simd.h"
+
+#define LANE_LO 0x5555555555555555ULL
+#define LANE_HI 0xAAAAAAAAAAAAAAAAULL
+
+/* ======================================================
+ * Array kernels
+ *
+ * The SIMD scans only skip over blocks that cannot change
+ * the answer; the scalar loop always finishes the job from
+ * the returned index, so results match it exactly.
+ * ====================================================== */
+
+/* The SIMD paths read tribools as 32-bit lanes (the enum size on x86 ABIs). */
+static int tribool_is_i32(void) {
+    return sizeof(tribool) == sizeof(int32_t);
+}
+
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+
+/* Skips 16-lane blocks free of `stop`; flags blocks holding anything but `keep`. */
+static size_t scan_stop_sse2(const tribool *v, size_t n, int stop, int keep, int *other) {
+    const __m128i s = _mm_set1_epi32(stop);
+    const __m128i k = _mm_set1_epi32(keep);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i a0 = _mm_loadu_si128((const __m128i *)(v + i));
+        __m128i a1 = _mm_loadu_si128((const __m128i *)(v + i + 4));
+        __m128i a2 = _mm_loadu_si128((const __m128i *)(v + i + 8));
+        __m128i a3 = _mm_loadu_si128((const __m128i *)(v + i + 12));
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(a0, s), _mm_cmpeq_epi32(a1, s)),
+                                   _mm_or_si128(_mm_cmpeq_epi32(a2, s), _mm_cmpeq_epi32(a3, s)));
+        if (_mm_movemask_epi8(hit)) break;
+        __m128i kept = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi32(a0, k), _mm_cmpeq_epi32(a1, k)),
+                                     _mm_and_si128(_mm_cmpeq_epi32(a2, k), _mm_cmpeq_epi32(a3, k)));
+        if (_mm_movemask_epi8(kept) != 0xFFFF) *other = 1;
+    }
+    return i;
+}
+
+/* Skips 16-lane blocks where every lane is TRUE or FALSE. */
+static size_t scan_unknown_sse2(const tribool *v, size_t n) {
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i a0 = _mm_andnot_si128(one, _mm_loadu_si128((const __m128i *)(v + i)));
+        __m128i a1 = _mm_andnot_si128(one, _mm_loadu_si128((const __m128i *)(v + i + 4)));
+        __m128i a2 = _mm_andnot_si128(one, _mm_loadu_si128((const __m128i *)(v + i + 8)));
+        __m128i a3 = _mm_andnot_si128(one, _mm_loadu_si128((const __m128i *)(v + i + 12)));
+        __m128i any = _mm_or_si128(_mm_or_si128(a0, a1), _mm_or_si128(a2, a3));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xFFFF) break;
+    }
+    return i;
+}
+
+/* Counts TRUE and FALSE lanes in whole 4-lane vectors; returns lanes consumed. */
+static size_t count_sse2(const tribool *v, size_t n, size_t *t, size_t *f) {
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    while (i + 4 <= n) {
+        /* Flush the 32-bit lane counters before they can overflow. */
+        size_t end = n - i > ((size_t)1 << 30) ? i + ((size_t)1 << 30) : n;
+        __m128i ct = zero, cf = zero;
+        for (; i + 4 <= end; i += 4) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(v + i));
+            ct = _mm_sub_epi32(ct, _mm_cmpeq_epi32(a, one));
+            cf = _mm_sub_epi32(cf, _mm_cmpeq_epi32(a, zero));
+        }
+        uint32_t lt[4], lf[4];
+        _mm_storeu_si128((__m128i *)lt, ct);
+        _mm_storeu_si128((__m128i *)lf, cf);
+        *t += (size_t)lt[0] + lt[1] + lt[2] + lt[3];
+        *f += (size_t)lf[0] + lf[1] + lf[2] + lf[3];
+    }
+    return i;
+}
+
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+FOSSIL_TYPE_TARGET_AVX2
+static size_t scan_stop_avx2(const tribool *v, size_t n, int stop, int keep, int *other) {
+    const __m256i s = _mm256_set1_epi32(stop);
+    const __m256i k = _mm256_set1_epi32(keep);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a0 = _mm256_loadu_si256((const __m256i *)(v + i));
+        __m256i a1 = _mm256_loadu_si256((const __m256i *)(v + i + 8));
+        __m256i a2 = _mm256_loadu_si256((const __m256i *)(v + i + 16));
+        __m256i a3 = _mm256_loadu_si256((const __m256i *)(v + i + 24));
+        __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi32(a0, s), _mm256_cmpeq_epi32(a1, s)),
+                                      _mm256_or_si256(_mm256_cmpeq_epi32(a2, s), _mm256_cmpeq_epi32(a3, s)));
+        if (_mm256_movemask_epi8(hit)) break;
+        __m256i kept = _mm256_and_si256(_mm256_and_si256(_mm256_cmpeq_epi32(a0, k), _mm256_cmpeq_epi32(a1, k)),
+                                        _mm256_and_si256(_mm256_cmpeq_epi32(a2, k), _mm256_cmpeq_epi32(a3, k)));
+        if (_mm256_movemask_epi8(kept) != -1) *other = 1;
+    }
+    return i;
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static size_t scan_unknown_avx2(const tribool *v, size_t n) {
+    const __m256i one = _mm256_set1_epi32(1);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a0 = _mm256_andnot_si256(one, _mm256_loadu_si256((const __m256i *)(v + i)));
+        __m256i a1 = _mm256_andnot_si256(one, _mm256_loadu_si256((const __m256i *)(v + i + 8)));
+        __m256i a2 = _mm256_andnot_si256(one, _mm256_loadu_si256((const __m256i *)(v + i + 16)));
+        __m256i a3 = _mm256_andnot_si256(one, _mm256_loadu_si256((const __m256i *)(v + i + 24)));
+        __m256i any = _mm256_or_si256(_mm256_or_si256(a0, a1), _mm256_or_si256(a2, a3));
+        if (!_mm256_testz_si256(any, any)) break;
+    }
+    return i;
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static size_t count_avx2(const tribool *v, size_t n, size_t *t, size_t *f) {
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    while (i + 8 <= n) {
+        size_t end = n - i > ((size_t)1 << 31) ? i + ((size_t)1 << 31) : n;
+        __m256i ct = zero, cf = zero;
+        for (; i + 8 <= end; i += 8) {
+            __m256i a = _mm256_loadu_si256((const __m256i *)(v + i));
+            ct = _mm256_sub_epi32(ct, _mm256_cmpeq_epi32(a, one));
+            cf = _mm256_sub_epi32(cf, _mm256_cmpeq_epi32(a, zero));
+        }
+        uint32_t lt[8], lf[8];
+        _mm256_storeu_si256((__m256i *)lt, ct);
+        _mm256_storeu_si256((__m256i *)lf, cf);
+        for (int j = 0; j < 8; j++) {
+            *t += lt[j];
+            *f += lf[j];
+        }
+    }
+    return i;
+}
+
+#endif
+
+static size_t scan_stop(const tribool *v, size_t n, tribool stop, tribool keep, int *other) {
+    if (!tribool_is_i32()) return 0;
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) return scan_stop_avx2(v, n, (int)stop, (int)keep, other);
+#endif
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+    return scan_stop_sse2(v, n, (int)stop, (int)keep, other);
+#else
+    (void)v; (void)n; (void)stop; (void)keep; (void)other;
+    return 0;
+#endif
+}
+
+static size_t scan_unknown(const tribool *v, size_t n) {
+    if (!tribool_is_i32()) return 0;
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) return scan_unknown_avx2(v, n);
+#endif
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+    return scan_unknown_sse2(v, n);
+#else
+    (void)v; (void)n;
+    return 0;
+#endif
+}
+
+static void count_array(const tribool *v, size_t n, size_t *t, size_t *f) {
+    size_t i = 0;
+    *t = 0;
+    *f = 0;
+    if (tribool_is_i32()) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+        if (fossil_type_simd_has_avx2()) i = count_avx2(v, n, t, f);
+        else
+#endif
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+        i = count_sse2(v, n, t, f);
+#endif
+    }
+    for (; i < n; i++) {
+        *t += v[i] == FOSSIL_TYPE_TRIBOOL_TRUE;
+        *f += v[i] == FOSSIL_TYPE_TRIBOOL_FALSE;
+    }
+}
+
+/* ======================================================
+ * Array reductions
+ * ====================================================== */
+
+tribool fossil_type_tribool_all(const tribool *values, size_t count) {
+    if (!values) return FOSSIL_TYPE_TRIBOOL_TRUE;
+    int unknown = 0;
+    size_t i = scan_stop(values, count, FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_TRUE, &unknown);
+    for (; i < count; i++) {
+        if (values[i] == FOSSIL_TYPE_TRIBOOL_FALSE) return FOSSIL_TYPE_TRIBOOL_FALSE;
+        if (values[i] != FOSSIL_TYPE_TRIBOOL_TRUE) unknown = 1;
+    }
+    return unknown ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : FOSSIL_TYPE_TRIBOOL_TRUE;
+}
+
+tribool fossil_type_tribool_any(const tribool *values, size_t count) {
+    if (!values) return FOSSIL_TYPE_TRIBOOL_FALSE;
+    int unknown = 0;
+    size_t i = scan_stop(values, count, FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_FALSE, &unknown);
+    for (; i < count; i++) {
+        if (values[i] == FOSSIL_TYPE_TRIBOOL_TRUE) return FOSSIL_TYPE_TRIBOOL_TRUE;
+        if (values[i] != FOSSIL_TYPE_TRIBOOL_FALSE) unknown = 1;
+    }
+    return unknown ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : FOSSIL_TYPE_TRIBOOL_FALSE;
+}
+
+tribool fossil_type_tribool_none(const tribool *values, size_t count) {
+    return fossil_type_tribool_not(fossil_type_tribool_any(values, count));
+}
+
+size_t fossil_type_tribool_count_true(const tribool *values, size_t count) {
+    size_t t, f;
+    if (!values) return 0;
+    count_array(values, count, &t, &f);
+    return t;
+}
+
+size_t fossil_type_tribool_count_false(const tribool *values, size_t count) {
+    size_t t, f;
+    if (!values) return 0;
+    count_array(values, count, &t, &f);
+    return f;
+}
+
+size_t fossil_type_tribool_count_unknown(const tribool *values, size_t count) {
+    size_t t, f;
+    if (!values) return 0;
+    count_array(values, count, &t, &f);
+    return count - t - f;
+}
+
+size_t fossil_type_tribool_find_first_unknown(const tribool *values, size_t count) {
+    if (!values) return FOSSIL_TYPE_TRIBOOL_NPOS;
+    for (size_t i = scan_unknown(values, count); i < count; i++) {
+        if (values[i] != FOSSIL_TYPE_TRIBOOL_TRUE && values[i] != FOSSIL_TYPE_TRIBOOL_FALSE) return i;
+    }
+    return FOSSIL_TYPE_TRIBOOL_NPOS;
+}
+
+/* ======================================================
+ * Packed vector reductions
+ * ====================================================== */
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+/* Nibble-table popcount (Mula) of (word & mask) over whole words. */
+FOSSIL_TYPE_TARGET_AVX2
+static size_t popcount_words_avx2(const uint64_t *w, size_t n, uint64_t mask, size_t *total) {
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    const __m256i m = _mm256_set1_epi64x((long long)mask);
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x  = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(w + i)), m);
+        __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(x, low));
+        __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(x, 4), low));
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    *total += (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    return i;
+}
+
+#endif
+
+static size_t popcount_words(const uint64_t *w, size_t n, uint64_t mask) {
+    size_t total = 0, i = 0;
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) i = popcount_words_avx2(w, n, mask, &total);
+#endif
+    for (; i < n; i++) total += fossil_type_popcount64(w[i] & mask);
+    return total;
+}
+
+static inline uint64_t vec_tail_mask(size_t length) {
+    size_t rem = length % FOSSIL_TYPE_TRIBOOL_VEC_LANES;
+    return rem ? (1ULL << (2 * rem)) - 1 : ~0ULL;
+}
+
+tribool fossil_type_tribool_vec_all(const tribool_vec *v) {
+    if (!v || !v->length) return FOSSIL_TYPE_TRIBOOL_TRUE;
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(v->length);
+    size_t full = nwords - 1;
+    uint64_t unknown = 0;
+    size_t i = 0;
+
+    /* Eight words (256 lanes) per early-exit check. */
+    for (; i + 8 <= full; i += 8) {
+        uint64_t f = 0, u = 0;
+        for (size_t j = 0; j < 8; j++) {
+            uint64_t w = v->words[i + j];
+            f |= ~(w | (w >> 1));
+            u |= w;
+        }
+        if (f & LANE_LO) return FOSSIL_TYPE_TRIBOOL_FALSE;
+        unknown |= u;
+    }
+    for (; i < nwords; i++) {
+        uint64_t w = v->words[i];
+        uint64_t mask = i == full ? vec_tail_mask(v->length) : ~0ULL;
+        if (~(w | (w >> 1)) & LANE_LO & mask) return FOSSIL_TYPE_TRIBOOL_FALSE;
+        unknown |= w;
+    }
+    return (unknown & LANE_HI) ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : FOSSIL_TYPE_TRIBOOL_TRUE;
+}
+
+tribool fossil_type_tribool_vec_any(const tribool_vec *v) {
+    if (!v || !v->length) return FOSSIL_TYPE_TRIBOOL_FALSE;
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(v->length);
+    uint64_t unknown = 0;
+    size_t i = 0;
+
+    /* Padding lanes are 00, so no tail mask is needed for TRUE or UNKNOWN bits. */
+    for (; i + 8 <= nwords; i += 8) {
+        uint64_t acc = 0;
+        for (size_t j = 0; j < 8; j++) acc |= v->words[i + j];
+        if (acc & LANE_LO) return FOSSIL_TYPE_TRIBOOL_TRUE;
+        unknown |= acc;
+    }
+    for (; i < nwords; i++) {
+        if (v->words[i] & LANE_LO) return FOSSIL_TYPE_TRIBOOL_TRUE;
+        unknown |= v->words[i];
+    }
+    return (unknown & LANE_HI) ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : FOSSIL_TYPE_TRIBOOL_FALSE;
+}
+
+tribool fossil_type_tribool_vec_none(const tribool_vec *v) {
+    return fossil_type_tribool_not(fossil_type_tribool_vec_any(v));
+}
+
+size_t fossil_type_tribool_vec_count_true(const tribool_vec *v) {
+    if (!v || !v->length) return 0;
+    return popcount_words(v->words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(v->length), LANE_LO);
+}
+
+size_t fossil_type_tribool_vec_count_unknown(const tribool_vec *v) {
+    if (!v || !v->length) return 0;
+    return popcount_words(v->words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(v->length), LANE_HI);
+}
+
+size_t fossil_type_tribool_vec_count_false(const tribool_vec *v) {
+    if (!v || !v->length) return 0;
+    return v->length - fossil_type_tribool_vec_count_true(v) - fossil_type_tribool_vec_count_unknown(v);
+}
+
+size_t fossil_type_tribool_vec_find_first_unknown(const tribool_vec *v) {
+    if (!v) return FOSSIL_TYPE_TRIBOOL_NPOS;
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(v->length);
+    for (size_t i = 0; i < nwords; i++) {
+        uint64_t u = v->words[i] & LANE_HI;
+        if (u) return i * FOSSIL_TYPE_TRIBOOL_VEC_LANES + fossil_type_ctz64(u) / 2;
+    }
+    return FOSSIL_TYPE_TRIBOOL_NPOS;
+}
+
+/* ======================================================
+ * Slice reductions
+ * ====================================================== */
+
+/* Mask of the lanes of slice i that fall inside count. */
+static inline b64 slice_mask(size_t i, size_t count) {
+    size_t lanes = count - i * FOSSIL_TYPE_TRIBOOL_SLICE_LANES;
+    return lanes >= FOSSIL_TYPE_TRIBOOL_SLICE_LANES ? ~0ULL : (1ULL << lanes) - 1;
+}
+
+tribool fossil_type_tribool_slices_all(const tribool_slice *s, size_t count) {
+    if (!s) return FOSSIL_TYPE_TRIBOOL_TRUE;
+    b64 unknown = 0;
+    for (size_t i = 0; i < FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(count); i++) {
+        b64 m = slice_mask(i, count);
+        if (s[i].known & ~s[i].truth & m) return FOSSIL_TYPE_TRIBOOL_FALSE;
+        unknown |= ~s[i].known & m;
+    }
+    return unknown ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : FOSSIL_TYPE_TRIBOOL_TRUE;
+}
+
+tribool fossil_type_tribool_slices_any(const tribool_slice *s, size_t count) {
+    if (!s) return FOSSIL_TYPE_TRIBOOL_FALSE;
+    b64 unknown = 0;
+    for (size_t i = 0; i < FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(count); i++) {
+        b64 m = slice_mask(i, count);
+        if (s[i].truth & s[i].known & m) return FOSSIL_TYPE_TRIBOOL_TRUE;
+        unknown |= ~s[i].known & m;
+    }
+    return unknown ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : FOSSIL_TYPE_TRIBOOL_FALSE;
+}
+
+tribool fossil_type_tribool_slices_none(const tribool_slice *s, size_t count) {
+    return fossil_type_tribool_not(fossil_type_tribool_slices_any(s, count));
+}
+
+size_t fossil_type_tribool_slices_count_true(const tribool_slice *s, size_t count) {
+    size_t total = 0;
+    if (!s) return 0;
+    for (size_t i = 0; i < FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(count); i++) {
+        total += fossil_type_popcount64(s[i].truth & s[i].known & slice_mask(i, count));
+    }
+    return total;
+}
+
+size_t fossil_type_tribool_slices_count_false(const tribool_slice *s, size_t count) {
+    size_t total = 0;
+    if (!s) return 0;
+    for (size_t i = 0; i < FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(count); i++) {
+        total += fossil_type_popcount64(s[i].known & ~s[i].truth & slice_mask(i, count));
+    }
+    return total;
+}
+
+size_t fossil_type_tribool_slices_count_unknown(const tribool_slice *s, size_t count) {
+    size_t total = 0;
+    if (!s) return 0;
+    for (size_t i = 0; i < FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(count); i++) {
+        total += fossil_type_popcount64(~s[i].known & slice_mask(i, count));
+    }
+    return total;
+}
+
+size_t fossil_type_tribool_slices_find_first_unknown(const tribool_slice *s, size_t count) {
+    if (!s) return FOSSIL_TYPE_TRIBOOL_NPOS;
+    for (size_t i = 0; i < FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(count); i++) {
+        b64 u = ~s[i].known & slice_mask(i, count);
+        if (u) return i * FOSSIL_TYPE_TRIBOOL_SLICE_LANES + fossil_type_ctz64(u);
+    }
+    return FOSSIL_TYPE_TRIBOOL_NPOS;
+}
@@ -0,0 +1,246 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_rle.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ======================================================
+ * Storage helpers
+ * ====================================================== */
+
+static int rle_reserve(tribool_rle *r, size_t runs) {
+    if (runs <= r->capacity) return 0;
+    size_t cap = r->capacity ? r->capacity : 8;
+    while (cap < runs) {
+        if (cap > SIZE_MAX / 2 / sizeof(size_t)) return -1;
+        cap *= 2;
+    }
+    tribool8 *values = (tribool8 *)realloc(r->values, cap * sizeof(tribool8));
+    if (!values) return -1;
+    r->values = values;
+    size_t *ends = (size_t *)realloc(r->ends, cap * sizeof(size_t));
+    if (!ends) return -1;
+    r->ends = ends;
+    r->capacity = cap;
+    return 0;
+}
+
+/* Appends a canonical value, merging into the last run when it matches. */
+static int rle_push(tribool_rle *r, tribool8 t, size_t count) {
+    if (count == 0) return 0;
+    if (count > SIZE_MAX - r->length) return -1;
+    if (r->runs && r->values[r->runs - 1] == t) {
+        r->length += count;
+        r->ends[r->runs - 1] = r->length;
+        return 0;
+    }
+    if (rle_reserve(r, r->runs + 1) != 0) return -1;
+    r->length += count;
+    r->values[r->runs] = t;
+    r->ends[r->runs] = r->length;
+    r->runs++;
+    return 0;
+}
+
+/* Hands the contents of src over to dst, freeing what dst held. */
+static void rle_move(tribool_rle *dst, tribool_rle *src) {
+    fossil_type_tribool_rle_free(dst);
+    *dst = *src;
+    fossil_type_tribool_rle_init(src);
+}
+
+/* ======================================================
+ * Lifecycle
+ * ====================================================== */
+
+int fossil_type_tribool_rle_init(tribool_rle *r) {
+    if (!r) return -1;
+    r->values = NULL;
+    r->ends = NULL;
+    r->runs = 0;
+    r->capacity = 0;
+    r->length = 0;
+    return 0;
+}
+
+void fossil_type_tribool_rle_free(tribool_rle *r) {
+    if (!r) return;
+    free(r->values);
+    free(r->ends);
+    fossil_type_tribool_rle_init(r);
+}
+
+int fossil_type_tribool_rle_copy(tribool_rle *dst, const tribool_rle *src) {
+    if (!dst || !src) return -1;
+    if (dst == src) return 0;
+    dst->runs = 0;
+    dst->length = 0;
+    if (rle_reserve(dst, src->runs) != 0) return -1;
+    if (src->runs) {
+        memcpy(dst->values, src->values, src->runs * sizeof(tribool8));
+        memcpy(dst->ends, src->ends, src->runs * sizeof(size_t));
+    }
+    dst->runs = src->runs;
+    dst->length = src->length;
+    return 0;
+}
+
+/* ======================================================
+ * Access
+ * ====================================================== */
+
+int fossil_type_tribool_rle_append(tribool_rle *r, tribool t) {
+    return fossil_type_tribool_rle_append_run(r, t, 1);
+}
+
+int fossil_type_tribool_rle_append_run(tribool_rle *r, tribool t, size_t count) {
+    if (!r) return -1;
+    return rle_push(r, fossil_type_tribool8_from(t), count);
+}
+
+size_t fossil_type_tribool_rle_length(const tribool_rle *r) {
+    return r ? r->length : 0;
+}
+
+size_t fossil_type_tribool_rle_runs(const tribool_rle *r) {
+    return r ? r->runs : 0;
+}
+
+size_t fossil_type_tribool_rle_find_run(const tribool_rle *r, size_t index) {
+    if (!r || index >= r->length) return FOSSIL_TYPE_TRIBOOL_NPOS;
+    /* First run whose end is past index. */
+    size_t lo = 0, hi = r->runs - 1;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (r->ends[mid] > index) hi = mid;
+        else lo = mid + 1;
+    }
+    return lo;
+}
+
+tribool fossil_type_tribool_rle_get(const tribool_rle *r, size_t index) {
+    size_t run = fossil_type_tribool_rle_find_run(r, index);
+    if (run == FOSSIL_TYPE_TRIBOOL_NPOS) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    return fossil_type_tribool8_to(r->values[run]);
+}
+
+/* ======================================================
+ * Logic
+ * ====================================================== */
+
+static int rle_binary(tribool_rle *dst, const tribool_rle *a, const tribool_rle *b,
+                      tribool (*op)(tribool, tribool)) {
+    tribool_rle out;
+    size_t i = 0, j = 0, pos = 0;
+    if (!dst || !a || !b || a->length != b->length) return -1;
+    fossil_type_tribool_rle_init(&out);
+
+    while (pos < a->length) {
+        size_t end = a->ends[i] < b->ends[j] ? a->ends[i] : b->ends[j];
+        tribool t = op(fossil_type_tribool8_to(a->values[i]), fossil_type_tribool8_to(b->values[j]));
+        if (rle_push(&out, fossil_type_tribool8_from(t), end - pos) != 0) {
+            fossil_type_tribool_rle_free(&out);
+            return -1;
+        }
+        pos = end;
+        if (a->ends[i] == end) i++;
+        if (b->ends[j] == end) j++;
+    }
+    rle_move(dst, &out);
+    return 0;
+}
+
+int fossil_type_tribool_rle_and(tribool_rle *dst, const tribool_rle *a, const tribool_rle *b) {
+    return rle_binary(dst, a, b, fossil_type_tribool_and);
+}
+
+int fossil_type_tribool_rle_or(tribool_rle *dst, const tribool_rle *a, const tribool_rle *b) {
+    return rle_binary(dst, a, b, fossil_type_tribool_or);
+}
+
+int fossil_type_tribool_rle_not(tribool_rle *dst, const tribool_rle *a) {
+    if (!dst || !a) return -1;
+    /* NOT is a bijection, so run boundaries are unchanged. */
+    if (dst != a && fossil_type_tribool_rle_copy(dst, a) != 0) return -1;
+    for (size_t i = 0; i < dst->runs; i++) {
+        dst->values[i] = fossil_type_tribool8_from(fossil_type_tribool_not(fossil_type_tribool8_to(dst->values[i])));
+    }
+    return 0;
+}
+
+/* ======================================================
+ * Conversion
+ * ====================================================== */
+
+int fossil_type_tribool_rle_pack(tribool_rle *r, const tribool *src, size_t count) {
+    tribool_rle out;
+    if (!r || (!src && count)) return -1;
+    fossil_type_tribool_rle_init(&out);
+    size_t start = 0;
+    for (size_t i = 1; i <= count; i++) {
+        if (i == count || fossil_type_tribool8_from(src[i]) != fossil_type_tribool8_from(src[start])) {
+            if (rle_push(&out, fossil_type_tribool8_from(src[start]), i - start) != 0) {
+                fossil_type_tribool_rle_free(&out);
+                return -1;
+            }
+            start = i;
+        }
+    }
+    rle_move(r, &out);
+    return 0;
+}
+
+void fossil_type_tribool_rle_unpack(const tribool_rle *r, tribool *dst) {
+    if (!r || !dst) return;
+    size_t pos = 0;
+    for (size_t i = 0; i < r->runs; i++) {
+        tribool t = fossil_type_tribool8_to(r->values[i]);
+        for (; pos < r->ends[i]; pos++) dst[pos] = t;
+    }
+}
+
+/* Writes lane code `code` into lanes [from, to) one word at a time. */
+static void vec_fill_range(tribool_vec *v, size_t from, size_t to, tribool8 code) {
+    const uint64_t pattern = (uint64_t)code * 0x5555555555555555ULL;
+    while (from < to) {
+        size_t lane = from % FOSSIL_TYPE_TRIBOOL_VEC_LANES;
+        size_t n = FOSSIL_TYPE_TRIBOOL_VEC_LANES - lane;
+        if (n > to - from) n = to - from;
+        uint64_t mask = (n == FOSSIL_TYPE_TRIBOOL_VEC_LANES ? ~0ULL : (1ULL << (2 * n)) - 1) << (2 * lane);
+        uint64_t *w = &v->words[from / FOSSIL_TYPE_TRIBOOL_VEC_LANES];
+        *w = (*w & ~mask) | (pattern & mask);
+        from += n;
+    }
+}
+
+int fossil_type_tribool_rle_to_vec(tribool_vec *v, const tribool_rle *r) {
+    if (!v || !r) return -1;
+    if (fossil_type_tribool_vec_resize(v, r->length) != 0) return -1;
+    for (size_t i = 0, pos = 0; i < r->runs; pos = r->ends[i], i++) {
+        vec_fill_range(v, pos, r->ends[i], r->values[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,384 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_select.h"
+#include "simd.h"
+
+#define LANE_LO 0x5555555555555555ULL
+
+/* ======================================================
+ * Index compress kernels
+ *
+ * An emit kernel appends base + i for every set bit i of a
+ * 64-row mask and returns how many it wrote. When full is
+ * set the whole block lies inside the input, so the
+ * caller's output has room for 8 unconditional stores per
+ * 8-row group; partial blocks take the exact scalar path.
+ * ====================================================== */
+
+static const uint64_t select_table[256] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000100ULL,
+    0x0000000000000002ULL, 0x0000000000000200ULL, 0x0000000000000201ULL, 0x0000000000020100ULL,
+    0x0000000000000003ULL, 0x0000000000000300ULL, 0x0000000000000301ULL, 0x0000000000030100ULL,
+    0x0000000000000302ULL, 0x0000000000030200ULL, 0x0000000000030201ULL, 0x0000000003020100ULL,
+    0x0000000000000004ULL, 0x0000000000000400ULL, 0x0000000000000401ULL, 0x0000000000040100ULL,
+    0x0000000000000402ULL, 0x0000000000040200ULL, 0x0000000000040201ULL, 0x0000000004020100ULL,
+    0x0000000000000403ULL, 0x0000000000040300ULL, 0x0000000000040301ULL, 0x0000000004030100ULL,
+    0x0000000000040302ULL, 0x0000000004030200ULL, 0x0000000004030201ULL, 0x0000000403020100ULL,
+    0x0000000000000005ULL, 0x0000000000000500ULL, 0x0000000000000501ULL, 0x0000000000050100ULL,
+    0x0000000000000502ULL, 0x0000000000050200ULL, 0x0000000000050201ULL, 0x0000000005020100ULL,
+    0x0000000000000503ULL, 0x0000000000050300ULL, 0x0000000000050301ULL, 0x0000000005030100ULL,
+    0x0000000000050302ULL, 0x0000000005030200ULL, 0x0000000005030201ULL, 0x0000000503020100ULL,
+    0x0000000000000504ULL, 0x0000000000050400ULL, 0x0000000000050401ULL, 0x0000000005040100ULL,
+    0x0000000000050402ULL, 0x0000000005040200ULL, 0x0000000005040201ULL, 0x0000000504020100ULL,
+    0x0000000000050403ULL, 0x0000000005040300ULL, 0x0000000005040301ULL, 0x0000000504030100ULL,
+    0x0000000005040302ULL, 0x0000000504030200ULL, 0x0000000504030201ULL, 0x0000050403020100ULL,
+    0x0000000000000006ULL, 0x0000000000000600ULL, 0x0000000000000601ULL, 0x0000000000060100ULL,
+    0x0000000000000602ULL, 0x0000000000060200ULL, 0x0000000000060201ULL, 0x0000000006020100ULL,
+    0x0000000000000603ULL, 0x0000000000060300ULL, 0x0000000000060301ULL, 0x0000000006030100ULL,
+    0x0000000000060302ULL, 0x0000000006030200ULL, 0x0000000006030201ULL, 0x0000000603020100ULL,
+    0x0000000000000604ULL, 0x0000000000060400ULL, 0x0000000000060401ULL, 0x0000000006040100ULL,
+    0x0000000000060402ULL, 0x0000000006040200ULL, 0x0000000006040201ULL, 0x0000000604020100ULL,
+    0x0000000000060403ULL, 0x0000000006040300ULL, 0x0000000006040301ULL, 0x0000000604030100ULL,
+    0x0000000006040302ULL, 0x0000000604030200ULL, 0x0000000604030201ULL, 0x0000060403020100ULL,
+    0x0000000000000605ULL, 0x0000000000060500ULL, 0x0000000000060501ULL, 0x0000000006050100ULL,
+    0x0000000000060502ULL, 0x0000000006050200ULL, 0x0000000006050201ULL, 0x0000000605020100ULL,
+    0x0000000000060503ULL, 0x0000000006050300ULL, 0x0000000006050301ULL, 0x0000000605030100ULL,
+    0x0000000006050302ULL, 0x0000000605030200ULL, 0x0000000605030201ULL, 0x0000060503020100ULL,
+    0x0000000000060504ULL, 0x0000000006050400ULL, 0x0000000006050401ULL, 0x0000000605040100ULL,
+    0x0000000006050402ULL, 0x0000000605040200ULL, 0x0000000605040201ULL, 0x0000060504020100ULL,
+    0x0000000006050403ULL, 0x0000000605040300ULL, 0x0000000605040301ULL, 0x0000060504030100ULL,
+    0x0000000605040302ULL, 0x0000060504030200ULL, 0x0000060504030201ULL, 0x0006050403020100ULL,
+    0x0000000000000007ULL, 0x0000000000000700ULL, 0x0000000000000701ULL, 0x0000000000070100ULL,
+    0x0000000000000702ULL, 0x0000000000070200ULL, 0x0000000000070201ULL, 0x0000000007020100ULL,
+    0x0000000000000703ULL, 0x0000000000070300ULL, 0x0000000000070301ULL, 0x0000000007030100ULL,
+    0x0000000000070302ULL, 0x0000000007030200ULL, 0x0000000007030201ULL, 0x0000000703020100ULL,
+    0x0000000000000704ULL, 0x0000000000070400ULL, 0x0000000000070401ULL, 0x0000000007040100ULL,
+    0x0000000000070402ULL, 0x0000000007040200ULL, 0x0000000007040201ULL, 0x0000000704020100ULL,
+    0x0000000000070403ULL, 0x0000000007040300ULL, 0x0000000007040301ULL, 0x0000000704030100ULL,
+    0x0000000007040302ULL, 0x0000000704030200ULL, 0x0000000704030201ULL, 0x0000070403020100ULL,
+    0x0000000000000705ULL, 0x0000000000070500ULL, 0x0000000000070501ULL, 0x0000000007050100ULL,
+    0x0000000000070502ULL, 0x0000000007050200ULL, 0x0000000007050201ULL, 0x0000000705020100ULL,
+    0x0000000000070503ULL, 0x0000000007050300ULL, 0x0000000007050301ULL, 0x0000000705030100ULL,
+    0x0000000007050302ULL, 0x0000000705030200ULL, 0x0000000705030201ULL, 0x0000070503020100ULL,
+    0x0000000000070504ULL, 0x0000000007050400ULL, 0x0000000007050401ULL, 0x0000000705040100ULL,
+    0x0000000007050402ULL, 0x0000000705040200ULL, 0x0000000705040201ULL, 0x0000070504020100ULL,
+    0x0000000007050403ULL, 0x0000000705040300ULL, 0x0000000705040301ULL, 0x0000070504030100ULL,
+    0x0000000705040302ULL, 0x0000070504030200ULL, 0x0000070504030201ULL, 0x0007050403020100ULL,
+    0x0000000000000706ULL, 0x0000000000070600ULL, 0x0000000000070601ULL, 0x0000000007060100ULL,
+    0x0000000000070602ULL, 0x0000000007060200ULL, 0x0000000007060201ULL, 0x0000000706020100ULL,
+    0x0000000000070603ULL, 0x0000000007060300ULL, 0x0000000007060301ULL, 0x0000000706030100ULL,
+    0x0000000007060302ULL, 0x0000000706030200ULL, 0x0000000706030201ULL, 0x0000070603020100ULL,
+    0x0000000000070604ULL, 0x0000000007060400ULL, 0x0000000007060401ULL, 0x0000000706040100ULL,
+    0x0000000007060402ULL, 0x0000000706040200ULL, 0x0000000706040201ULL, 0x0000070604020100ULL,
+    0x0000000007060403ULL, 0x0000000706040300ULL, 0x0000000706040301ULL, 0x0000070604030100ULL,
+    0x0000000706040302ULL, 0x0000070604030200ULL, 0x0000070604030201ULL, 0x0007060403020100ULL,
+    0x0000000000070605ULL, 0x0000000007060500ULL, 0x0000000007060501ULL, 0x0000000706050100ULL,
+    0x0000000007060502ULL, 0x0000000706050200ULL, 0x0000000706050201ULL, 0x0000070605020100ULL,
+    0x0000000007060503ULL, 0x0000000706050300ULL, 0x0000000706050301ULL, 0x0000070605030100ULL,
+    0x0000000706050302ULL, 0x0000070605030200ULL, 0x0000070605030201ULL, 0x0007060503020100ULL,
+    0x0000000007060504ULL, 0x0000000706050400ULL, 0x0000000706050401ULL, 0x0000070605040100ULL,
+    0x0000000706050402ULL, 0x0000070605040200ULL, 0x0000070605040201ULL, 0x0007060504020100ULL,
+    0x0000000706050403ULL, 0x0000070605040300ULL, 0x0000070605040301ULL, 0x0007060504030100ULL,
+    0x0000070605040302ULL, 0x0007060504030200ULL, 0x0007060504030201ULL, 0x0706050403020100ULL
+};
+
+typedef size_t (*select_emit_fn)(u32 *dst, uint64_t mask, u32 base, int full);
+
+static size_t emit_scalar(u32 *dst, uint64_t mask, u32 base, int full) {
+    size_t n = 0;
+    (void)full;
+    while (mask) {
+        dst[n++] = base + fossil_type_ctz64(mask);
+        mask &= mask - 1;
+    }
+    return n;
+}
+
+#if !defined(FOSSIL_TYPE_HAVE_SSE2)
+
+/* Portable table lookup: eight indices per mask byte, written unconditionally. */
+static size_t emit_table(u32 *dst, uint64_t mask, u32 base, int full) {
+    if (!full) return emit_scalar(dst, mask, base, full);
+    u32 *p = dst;
+    for (unsigned j = 0; j < 8; j++) {
+        unsigned bits = (unsigned)(mask >> (8 * j)) & 0xFFu;
+        uint64_t e = select_table[bits];
+        for (unsigned k = 0; k < 8; k++) p[k] = base + 8 * j + (u32)((e >> (8 * k)) & 0xFFu);
+        p += fossil_type_popcount64(bits);
+    }
+    return (size_t)(p - dst);
+}
+
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+
+static size_t emit_sse2(u32 *dst, uint64_t mask, u32 base, int full) {
+    if (!full) return emit_scalar(dst, mask, base, full);
+    const __m128i zero = _mm_setzero_si128();
+    u32 *p = dst;
+    for (unsigned j = 0; j < 8; j++) {
+        unsigned bits = (unsigned)(mask >> (8 * j)) & 0xFFu;
+        __m128i bytes = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&select_table[bits]), zero);
+        __m128i off = _mm_set1_epi32((int)(base + 8 * j));
+        _mm_storeu_si128((__m128i *)p,       _mm_add_epi32(_mm_unpacklo_epi16(bytes, zero), off));
+        _mm_storeu_si128((__m128i *)(p + 4), _mm_add_epi32(_mm_unpackhi_epi16(bytes, zero), off));
+        p += fossil_type_popcount64(bits);
+    }
+    return (size_t)(p - dst);
+}
+
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_BMI2)
+
+/* pdep spreads the mask byte to one 0xFF byte per set bit; pext then packs the lane numbers. */
+FOSSIL_TYPE_TARGET_AVX2_BMI2
+static size_t emit_bmi2(u32 *dst, uint64_t mask, u32 base, int full) {
+    if (!full) return emit_scalar(dst, mask, base, full);
+    u32 *p = dst;
+    for (unsigned j = 0; j < 8; j++) {
+        unsigned bits = (unsigned)(mask >> (8 * j)) & 0xFFu;
+        uint64_t spread = _pdep_u64(bits, 0x0101010101010101ULL) * 0xFFu;
+        uint64_t lanes = _pext_u64(0x0706050403020100ULL, spread);
+        __m256i idx = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long)lanes));
+        _mm256_storeu_si256((__m256i *)p, _mm256_add_epi32(idx, _mm256_set1_epi32((int)(base + 8 * j))));
+        p += fossil_type_popcount64(bits);
+    }
+    return (size_t)(p - dst);
+}
+
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_AVX512)
+
+/* VPCOMPRESSD stores exactly the selected lanes, so partial blocks need no fallback. */
+FOSSIL_TYPE_TARGET_AVX512
+static size_t emit_avx512(u32 *dst, uint64_t mask, u32 base, int full) {
+    const __m512i iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    u32 *p = dst;
+    (void)full;
+    for (unsigned j = 0; j < 4; j++) {
+        unsigned bits = (unsigned)(mask >> (16 * j)) & 0xFFFFu;
+        __m512i idx = _mm512_add_epi32(iota, _mm512_set1_epi32((int)(base + 16 * j)));
+        _mm512_mask_compressstoreu_epi32(p, (__mmask16)bits, idx);
+        p += fossil_type_popcount64(bits);
+    }
+    return (size_t)(p - dst);
+}
+
+#endif
+
+typedef struct select_kernels {
+    const char *name;
+    select_emit_fn emit;
+} select_kernels;
+
+#if defined(FOSSIL_TYPE_HAVE_AVX512)
+static const select_kernels kernels_avx512 = { "avx512", emit_avx512 };
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_BMI2)
+static const select_kernels kernels_bmi2 = { "bmi2", emit_bmi2 };
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+static const select_kernels kernels_base = { "sse2", emit_sse2 };
+#else
+static const select_kernels kernels_base = { "table", emit_table };
+#endif
+
+static const select_kernels *select_kernels_get(void) {
+#if defined(FOSSIL_TYPE_HAVE_AVX512)
+    if (fossil_type_simd_has_avx512()) return &kernels_avx512;
+#endif
+#if defined(FOSSIL_TYPE_HAVE_BMI2)
+    if (fossil_type_simd_has_bmi2()) return &kernels_bmi2;
+#endif
+    return &kernels_base;
+}
+
+const char *fossil_type_tribool_select_kernel(void) {
+    return select_kernels_get()->name;
+}
+
+/* ======================================================
+ * Row masks
+ *
+ * Both input forms are first turned into TRUE and UNKNOWN
+ * bitmaps for 64 rows; FALSE is whatever is left.
+ * ====================================================== */
+
+typedef struct select_masks {
+    uint64_t t, u;
+} select_masks;
+
+/* The SIMD paths read tribools as 32-bit lanes (the enum size on x86 ABIs). */
+static int tribool_is_i32(void) {
+    return sizeof(tribool) == sizeof(int32_t);
+}
+
+static select_masks array_masks_scalar(const tribool *src, size_t n) {
+    select_masks m = {0, 0};
+    for (size_t i = 0; i < n; i++) {
+        m.t |= (uint64_t)(src[i] == FOSSIL_TYPE_TRIBOOL_TRUE) << i;
+        m.u |= (uint64_t)(src[i] != FOSSIL_TYPE_TRIBOOL_TRUE && src[i] != FOSSIL_TYPE_TRIBOOL_FALSE) << i;
+    }
+    return m;
+}
+
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+
+static select_masks array_masks_sse2(const tribool *src) {
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i zero = _mm_setzero_si128();
+    uint64_t t = 0, f = 0;
+    for (size_t i = 0; i < 64; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(src + i));
+        t |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, one))) << i;
+        f |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, zero))) << i;
+    }
+    select_masks m = { t, ~(t | f) };
+    return m;
+}
+
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+FOSSIL_TYPE_TARGET_AVX2
+static select_masks array_masks_avx2(const tribool *src) {
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i zero = _mm256_setzero_si256();
+    uint64_t t = 0, f = 0;
+    for (size_t i = 0; i < 64; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+        t |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, one))) << i;
+        f |= (uint64_t)(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, zero))) << i;
+    }
+    select_masks m = { t, ~(t | f) };
+    return m;
+}
+
+#endif
+
+static select_masks array_masks(const tribool *src, size_t n) {
+    if (n == 64 && tribool_is_i32()) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+        if (fossil_type_simd_has_avx2()) return array_masks_avx2(src);
+#endif
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+        return array_masks_sse2(src);
+#endif
+    }
+    return array_masks_scalar(src, n);
+}
+
+/* Lanes 64k .. 64k + 63 of a packed vector; padding lanes are 00 and never match TRUE or UNKNOWN. */
+static select_masks vec_masks(const tribool_vec *v, size_t block) {
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(v->length);
+    uint64_t w0 = v->words[2 * block];
+    uint64_t w1 = 2 * block + 1 < nwords ? v->words[2 * block + 1] : 0;
+    select_masks m;
+    m.t = fossil_type_bits_compress_even(w0 & LANE_LO) |
+          (fossil_type_bits_compress_even(w1 & LANE_LO) << 32);
+    m.u = fossil_type_bits_compress_even((w0 >> 1) & LANE_LO) |
+          (fossil_type_bits_compress_even((w1 >> 1) & LANE_LO) << 32);
+    return m;
+}
+
+/* ======================================================
+ * Drivers
+ * ====================================================== */
+
+static uint64_t match_mask(select_masks m, tribool match, uint64_t rows) {
+    if (match == FOSSIL_TYPE_TRIBOOL_TRUE) return m.t;
+    if (match == FOSSIL_TYPE_TRIBOOL_FALSE) return rows & ~(m.t | m.u);
+    return m.u & rows;
+}
+
+static uint64_t block_rows(size_t n) {
+    return n == 64 ? ~0ULL : (1ULL << n) - 1;
+}
+
+static int select_count_ok(size_t count) {
+    return (uint64_t)count <= UINT32_MAX;
+}
+
+size_t fossil_type_tribool_select(u32 *dst, const tribool *src, size_t count, tribool match) {
+    if (!dst || !src || !select_count_ok(count)) return 0;
+    select_emit_fn emit = select_kernels_get()->emit;
+    size_t out = 0;
+    for (size_t base = 0; base < count; base += 64) {
+        size_t n = count - base < 64 ? count - base : 64;
+        select_masks m = array_masks(src + base, n);
+        out += emit(dst + out, match_mask(m, match, block_rows(n)), (u32)base, n == 64);
+    }
+    return out;
+}
+
+size_t fossil_type_tribool_select_split(u32 *true_dst, u32 *unknown_dst, size_t *unknown_count,
+                                        const tribool *src, size_t count) {
+    size_t nt = 0, nu = 0;
+    if (unknown_count) *unknown_count = 0;
+    if (!true_dst || !unknown_dst || !src || !select_count_ok(count)) return 0;
+    select_emit_fn emit = select_kernels_get()->emit;
+    for (size_t base = 0; base < count; base += 64) {
+        size_t n = count - base < 64 ? count - base : 64;
+        select_masks m = array_masks(src + base, n);
+        nt += emit(true_dst + nt, m.t, (u32)base, n == 64);
+        nu += emit(unknown_dst + nu, m.u & block_rows(n), (u32)base, n == 64);
+    }
+    if (unknown_count) *unknown_count = nu;
+    return nt;
+}
+
+size_t fossil_type_tribool_vec_select(u32 *dst, const tribool_vec *v, tribool match) {
+    if (!dst || !v || !select_count_ok(v->length)) return 0;
+    select_emit_fn emit = select_kernels_get()->emit;
+    size_t out = 0;
+    for (size_t base = 0; base < v->length; base += 64) {
+        size_t n = v->length - base < 64 ? v->length - base : 64;
+        select_masks m = vec_masks(v, base / 64);
+        out += emit(dst + out, match_mask(m, match, block_rows(n)), (u32)base, n == 64);
+    }
+    return out;
+}
+
+size_t fossil_type_tribool_vec_select_split(u32 *true_dst, u32 *unknown_dst, size_t *unknown_count,
+                                            const tribool_vec *v) {
+    size_t nt = 0, nu = 0;
+    if (unknown_count) *unknown_count = 0;
+    if (!true_dst || !unknown_dst || !v || !select_count_ok(v->length)) return 0;
+    select_emit_fn emit = select_kernels_get()->emit;
+    for (size_t base = 0; base < v->length; base += 64) {
+        size_t n = v->length - base < 64 ? v->length - base : 64;
+        select_masks m = vec_masks(v, base / 64);
+        nt += emit(true_dst + nt, m.t, (u32)base, n == 64);
+        nu += emit(unknown_dst + nu, m.u, (u32)base, n == 64);
+    }
+    if (unknown_count) *unknown_count = nu;
+    return nt;
+}
@@ -0,0 +1,198 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_slice.h"
+#include "simd.h"
+
+/* ======================================================
+ * Plane logic
+ * ====================================================== */
+
+/*
+ * With f = known & ~truth (the FALSE plane):
+ *   AND: truth = ta & tb,  false = fa | fb
+ *   OR:  truth = ta | tb,  false = fa & fb
+ *   NOT: truth = f,        known unchanged
+ */
+static inline tribool_slice plane_and(tribool_slice a, tribool_slice b) {
+    tribool_slice r;
+    r.truth = a.truth & b.truth;
+    r.known = r.truth | (a.known & ~a.truth) | (b.known & ~b.truth);
+    return r;
+}
+
+static inline tribool_slice plane_or(tribool_slice a, tribool_slice b) {
+    tribool_slice r;
+    r.truth = a.truth | b.truth;
+    r.known = r.truth | ((a.known & ~a.truth) & (b.known & ~b.truth));
+    return r;
+}
+
+static inline tribool_slice plane_not(tribool_slice a) {
+    tribool_slice r;
+    r.known = a.known;
+    r.truth = a.known & ~a.truth;
+    return r;
+}
+
+/* ======================================================
+ * Constructors and access
+ * ====================================================== */
+
+tribool_slice fossil_type_tribool_slice_make(b64 known, b64 truth) {
+    tribool_slice s;
+    s.known = known;
+    s.truth = truth & known;
+    return s;
+}
+
+tribool_slice fossil_type_tribool_slice_fill(tribool t) {
+    tribool_slice s;
+    s.known = (t == FOSSIL_TYPE_TRIBOOL_TRUE || t == FOSSIL_TYPE_TRIBOOL_FALSE) ? ~0ULL : 0;
+    s.truth = (t == FOSSIL_TYPE_TRIBOOL_TRUE) ? ~0ULL : 0;
+    return s;
+}
+
+tribool fossil_type_tribool_slice_get(tribool_slice s, unsigned lane) {
+    if (lane >= FOSSIL_TYPE_TRIBOOL_SLICE_LANES) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    if (!((s.known >> lane) & 1u)) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    return ((s.truth >> lane) & 1u) ? FOSSIL_TYPE_TRIBOOL_TRUE : FOSSIL_TYPE_TRIBOOL_FALSE;
+}
+
+void fossil_type_tribool_slice_set(tribool_slice *s, unsigned lane, tribool t) {
+    if (!s || lane >= FOSSIL_TYPE_TRIBOOL_SLICE_LANES) return;
+    b64 bit = 1ULL << lane;
+    s->known &= ~bit;
+    s->truth &= ~bit;
+    if (t == FOSSIL_TYPE_TRIBOOL_TRUE) {
+        s->known |= bit;
+        s->truth |= bit;
+    } else if (t == FOSSIL_TYPE_TRIBOOL_FALSE) {
+        s->known |= bit;
+    }
+}
+
+/* ======================================================
+ * Logic
+ * ====================================================== */
+
+tribool_slice fossil_type_tribool_slice_and(tribool_slice a, tribool_slice b) {
+    return plane_and(a, b);
+}
+
+tribool_slice fossil_type_tribool_slice_or(tribool_slice a, tribool_slice b) {
+    return plane_or(a, b);
+}
+
+tribool_slice fossil_type_tribool_slice_not(tribool_slice a) {
+    return plane_not(a);
+}
+
+void fossil_type_tribool_slices_and(tribool_slice *dst, const tribool_slice *a,
+                                    const tribool_slice *b, size_t count) {
+    if (!dst || !a || !b) return;
+    for (size_t i = 0; i < count; i++) dst[i] = plane_and(a[i], b[i]);
+}
+
+void fossil_type_tribool_slices_or(tribool_slice *dst, const tribool_slice *a,
+                                   const tribool_slice *b, size_t count) {
+    if (!dst || !a || !b) return;
+    for (size_t i = 0; i < count; i++) dst[i] = plane_or(a[i], b[i]);
+}
+
+void fossil_type_tribool_slices_not(tribool_slice *dst, const tribool_slice *a, size_t count) {
+    if (!dst || !a) return;
+    for (size_t i = 0; i < count; i++) dst[i] = plane_not(a[i]);
+}
+
+/* ======================================================
+ * Conversion
+ * ====================================================== */
+
+void fossil_type_tribool_slices_pack(tribool_slice *dst, const tribool *src, size_t count) {
+    if (!dst || (!src && count)) return;
+    for (size_t base = 0; base < count; base += FOSSIL_TYPE_TRIBOOL_SLICE_LANES) {
+        size_t lanes = count - base < FOSSIL_TYPE_TRIBOOL_SLICE_LANES
+                     ? count - base : FOSSIL_TYPE_TRIBOOL_SLICE_LANES;
+        b64 known = 0, truth = 0;
+        for (size_t j = 0; j < lanes; j++) {
+            tribool t = src[base + j];
+            known |= (b64)(t == FOSSIL_TYPE_TRIBOOL_TRUE || t == FOSSIL_TYPE_TRIBOOL_FALSE) << j;
+            truth |= (b64)(t == FOSSIL_TYPE_TRIBOOL_TRUE) << j;
+        }
+        dst[base / FOSSIL_TYPE_TRIBOOL_SLICE_LANES].known = known;
+        dst[base / FOSSIL_TYPE_TRIBOOL_SLICE_LANES].truth = truth;
+    }
+}
+
+void fossil_type_tribool_slices_unpack(tribool *dst, const tribool_slice *src, size_t count) {
+    if (!dst || !src) return;
+    for (size_t i = 0; i < count; i++) {
+        tribool_slice s = src[i / FOSSIL_TYPE_TRIBOOL_SLICE_LANES];
+        unsigned lane = (unsigned)(i % FOSSIL_TYPE_TRIBOOL_SLICE_LANES);
+        unsigned known = (unsigned)((s.known >> lane) & 1u);
+        unsigned truth = (unsigned)((s.truth >> lane) & 1u);
+        dst[i] = known ? (tribool)truth : FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    }
+}
+
+/*
+ * A packed word holds 32 lanes with the TRUE bit on even positions and the
+ * UNKNOWN bit on odd positions, so each plane half is one even-bit compress.
+ */
+void fossil_type_tribool_vec_to_slices(tribool_slice *dst, const tribool_vec *v) {
+    if (!dst || !v) return;
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(v->length);
+    for (size_t w = 0; w < nwords; w += 2) {
+        uint64_t lo = v->words[w];
+        uint64_t hi = w + 1 < nwords ? v->words[w + 1] : 0;
+        b64 truth   = fossil_type_bits_compress_even(lo) | (fossil_type_bits_compress_even(hi) << 32);
+        b64 unknown = fossil_type_bits_compress_even(lo >> 1) | (fossil_type_bits_compress_even(hi >> 1) << 32);
+        dst[w / 2].truth = truth;
+        dst[w / 2].known = ~unknown;
+    }
+
+    /* Lanes past the end hold zero padding; report them as UNKNOWN. */
+    size_t rem = v->length % FOSSIL_TYPE_TRIBOOL_SLICE_LANES;
+    if (rem) dst[v->length / FOSSIL_TYPE_TRIBOOL_SLICE_LANES].known &= (1ULL << rem) - 1;
+}
+
+int fossil_type_tribool_vec_from_slices(tribool_vec *v, const tribool_slice *src, size_t length) {
+    if (!v || (!src && length)) return -1;
+    if (fossil_type_tribool_vec_resize(v, length) != 0) return -1;
+
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(length);
+    for (size_t w = 0; w < nwords; w++) {
+        tribool_slice s = src[w / 2];
+        unsigned shift = (w & 1u) ? 32u : 0u;
+        uint64_t truth   = (s.truth & s.known) >> shift;
+        uint64_t unknown = ~s.known >> shift;
+        v->words[w] = fossil_type_bits_spread_even(truth)
+                    | (fossil_type_bits_spread_even(unknown) << 1);
+    }
+
+    size_t rem = length % FOSSIL_TYPE_TRIBOOL_VEC_LANES;
+    if (rem) v->words[nwords - 1] &= (1ULL << (2 * rem)) - 1;
+    return 0;
+}
@@ -0,0 +1,306 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_table.h"
+#include "simd.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LANE_LO 0x5555555555555555ULL
+
+#define OBSERVED_TRUE  1u
+#define OBSERVED_FALSE 2u
+
+#define TABLE_LANES FOSSIL_TYPE_TRIBOOL_VEC_LANES
+#define TABLE_WORDS(n) FOSSIL_TYPE_TRIBOOL_VEC_WORDS(n)
+
+/* Slots of a word where both values were observed, one bit per slot at the even positions. */
+static inline uint64_t conflict_bits(uint64_t x) {
+    return x & (x >> 1) & LANE_LO;
+}
+
+/* ======================================================
+ * Lifecycle and Access
+ * ====================================================== */
+
+int fossil_type_tribool_table_init(tribool_table *t, size_t length) {
+    if (!t) return -1;
+    t->words = NULL;
+    t->length = 0;
+    return fossil_type_tribool_table_grow(t, length);
+}
+
+void fossil_type_tribool_table_free(tribool_table *t) {
+    if (!t) return;
+    free(t->words);
+    t->words = NULL;
+    t->length = 0;
+}
+
+int fossil_type_tribool_table_grow(tribool_table *t, size_t length) {
+    if (!t || length < t->length || length > SIZE_MAX - TABLE_LANES) return -1;
+    size_t old_words = TABLE_WORDS(t->length);
+    size_t new_words = TABLE_WORDS(length);
+    if (new_words > old_words) {
+        if (new_words > SIZE_MAX / sizeof(uint64_t)) return -1;
+        uint64_t *words = (uint64_t *)realloc(t->words, new_words * sizeof(uint64_t));
+        if (!words) return -1;
+        memset(words + old_words, 0, (new_words - old_words) * sizeof(uint64_t));
+        t->words = words;
+    }
+    t->length = length;
+    return 0;
+}
+
+int fossil_type_tribool_table_observe(tribool_table *t, size_t slot, tribool value) {
+    if (!t || slot >= t->length) return -1;
+    uint64_t bits = value == FOSSIL_TYPE_TRIBOOL_TRUE ? OBSERVED_TRUE
+                  : value == FOSSIL_TYPE_TRIBOOL_FALSE ? OBSERVED_FALSE : 0u;
+    t->words[slot / TABLE_LANES] |= bits << (2 * (slot % TABLE_LANES));
+    return 0;
+}
+
+static tribool resolve_slot(unsigned bits, fossil_type_tribool_conflict policy) {
+    switch (bits) {
+    case OBSERVED_TRUE:  return FOSSIL_TYPE_TRIBOOL_TRUE;
+    case OBSERVED_FALSE: return FOSSIL_TYPE_TRIBOOL_FALSE;
+    case OBSERVED_TRUE | OBSERVED_FALSE:
+        if (policy == FOSSIL_TYPE_TRIBOOL_CONFLICT_TRUE) return FOSSIL_TYPE_TRIBOOL_TRUE;
+        if (policy == FOSSIL_TYPE_TRIBOOL_CONFLICT_FALSE) return FOSSIL_TYPE_TRIBOOL_FALSE;
+        return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    default:
+        return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    }
+}
+
+static unsigned slot_bits(const tribool_table *t, size_t slot) {
+    return (unsigned)(t->words[slot / TABLE_LANES] >> (2 * (slot % TABLE_LANES))) & 3u;
+}
+
+tribool fossil_type_tribool_table_get(const tribool_table *t, size_t slot, fossil_type_tribool_conflict policy) {
+    if (!t || slot >= t->length) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    return resolve_slot(slot_bits(t, slot), policy);
+}
+
+int fossil_type_tribool_table_is_conflict(const tribool_table *t, size_t slot) {
+    if (!t || slot >= t->length) return 0;
+    return slot_bits(t, slot) == (OBSERVED_TRUE | OBSERVED_FALSE);
+}
+
+size_t fossil_type_tribool_table_count_conflicts(const tribool_table *t) {
+    size_t total = 0;
+    if (!t) return 0;
+    for (size_t w = 0; w < TABLE_WORDS(t->length); w++) total += fossil_type_popcount64(conflict_bits(t->words[w]));
+    return total;
+}
+
+/* ======================================================
+ * Bulk Operations
+ *
+ * Word loops simple enough for the compiler to vectorize;
+ * the join is a plain OR and new conflicts are the conflict
+ * bits the OR added.
+ * ====================================================== */
+
+/* ORs src into dst over n words; returns the number of slots that became conflicting. */
+static size_t join_words(uint64_t *dst, const uint64_t *src, size_t n) {
+    size_t conflicts = 0;
+    for (size_t w = 0; w < n; w++) {
+        uint64_t before = dst[w];
+        uint64_t after = before | src[w];
+        dst[w] = after;
+        conflicts += fossil_type_popcount64(conflict_bits(after) & ~conflict_bits(before));
+    }
+    return conflicts;
+}
+
+int fossil_type_tribool_table_merge(tribool_table *dst, const tribool_table *src, size_t *conflicts) {
+    if (!dst || !src) return -1;
+    if (src->length > dst->length && fossil_type_tribool_table_grow(dst, src->length) != 0) return -1;
+    size_t added = join_words(dst->words, src->words, TABLE_WORDS(src->length));
+    if (conflicts) *conflicts = added;
+    return 0;
+}
+
+int fossil_type_tribool_table_observe_vec(tribool_table *t, const tribool_vec *v, size_t *conflicts) {
+    if (!t || !v) return -1;
+    if (v->length > t->length && fossil_type_tribool_table_grow(t, v->length) != 0) return -1;
+
+    size_t nwords = TABLE_WORDS(v->length);
+    size_t added = 0;
+    for (size_t w = 0; w < nwords; w++) {
+        uint64_t x = v->words[w];
+        uint64_t seen_true = x & LANE_LO;
+        uint64_t seen_false = LANE_LO & ~(x | (x >> 1));
+        /* Padding lanes of the vector read as FALSE; they are not observations. */
+        if (w + 1 == nwords && v->length % TABLE_LANES) {
+            seen_false &= (1ULL << (2 * (v->length % TABLE_LANES))) - 1;
+        }
+        uint64_t obs = seen_true | (seen_false << 1);
+        added += join_words(&t->words[w], &obs, 1);
+    }
+    if (conflicts) *conflicts = added;
+    return 0;
+}
+
+int fossil_type_tribool_table_resolve(tribool_vec *dst, const tribool_table *t, fossil_type_tribool_conflict policy) {
+    if (!dst || !t) return -1;
+    if (fossil_type_tribool_vec_resize(dst, t->length) != 0) return -1;
+
+    uint64_t conflict_true = policy == FOSSIL_TYPE_TRIBOOL_CONFLICT_TRUE ? ~0ULL : 0;
+    uint64_t conflict_unknown = policy == FOSSIL_TYPE_TRIBOOL_CONFLICT_UNKNOWN ? ~0ULL : 0;
+    size_t nwords = TABLE_WORDS(t->length);
+    for (size_t w = 0; w < nwords; w++) {
+        uint64_t x = t->words[w];
+        uint64_t seen_true = x & LANE_LO;
+        uint64_t seen_false = (x >> 1) & LANE_LO;
+        uint64_t both = seen_true & seen_false;
+        uint64_t vt = (seen_true & ~seen_false) | (both & conflict_true);
+        uint64_t vu = (LANE_LO & ~(seen_true | seen_false)) | (both & conflict_unknown);
+        dst->words[w] = vt | (vu << 1);
+    }
+    /* Empty padding slots resolve to UNKNOWN; the vector keeps them FALSE. */
+    if (t->length % TABLE_LANES) dst->words[nwords - 1] &= (1ULL << (2 * (t->length % TABLE_LANES))) - 1;
+    return 0;
+}
+
+/* ======================================================
+ * Deltas
+ * ====================================================== */
+
+int fossil_type_tribool_delta_init(tribool_delta *d) {
+    if (!d) return -1;
+    d->bytes = NULL;
+    d->size = 0;
+    d->capacity = 0;
+    return 0;
+}
+
+void fossil_type_tribool_delta_free(tribool_delta *d) {
+    if (!d) return;
+    free(d->bytes);
+    fossil_type_tribool_delta_init(d);
+}
+
+static int delta_reserve(tribool_delta *d, size_t extra) {
+    if (extra <= d->capacity - d->size) return 0;
+    if (d->size > SIZE_MAX / 2 - extra) return -1;
+    size_t cap = d->capacity ? d->capacity : 64;
+    while (cap - d->size < extra) cap *= 2;
+    u8 *bytes = (u8 *)realloc(d->bytes, cap);
+    if (!bytes) return -1;
+    d->bytes = bytes;
+    d->capacity = cap;
+    return 0;
+}
+
+static int delta_put(tribool_delta *d, uint64_t x) {
+    if (delta_reserve(d, 10) != 0) return -1;
+    while (x >= 0x80u) {
+        d->bytes[d->size++] = (u8)(x | 0x80u);
+        x >>= 7;
+    }
+    d->bytes[d->size++] = (u8)x;
+    return 0;
+}
+
+static int delta_get(const tribool_delta *d, size_t *pos, uint64_t *out) {
+    uint64_t x = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (*pos >= d->size) return -1;
+        u8 byte = d->bytes[(*pos)++];
+        x |= (uint64_t)(byte & 0x7Fu) << shift;
+        if (!(byte & 0x80u)) {
+            *out = x;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int fossil_type_tribool_table_diff(tribool_delta *d, const tribool_table *newer, const tribool_table *older) {
+    if (!d || !newer) return -1;
+    d->size = 0;
+
+    size_t nwords = TABLE_WORDS(newer->length);
+    size_t known = older ? TABLE_WORDS(older->length) : 0;
+    size_t count = 0;
+    for (size_t w = 0; w < nwords; w++) {
+        uint64_t added = newer->words[w] & ~(w < known ? older->words[w] : 0);
+        count += fossil_type_popcount64(((added >> 1) | added) & LANE_LO);
+    }
+
+    if (delta_put(d, newer->length) != 0 || delta_put(d, count) != 0) return -1;
+    size_t prev = 0; /* One past the previous entry. */
+    for (size_t w = 0; w < nwords; w++) {
+        uint64_t added = newer->words[w] & ~(w < known ? older->words[w] : 0);
+        uint64_t slots = ((added >> 1) | added) & LANE_LO;
+        while (slots) {
+            unsigned bit = fossil_type_ctz64(slots);
+            size_t slot = w * TABLE_LANES + bit / 2;
+            uint64_t gap = slot - prev;
+            if (gap > (UINT64_MAX >> 2)) return -1;
+            if (delta_put(d, (gap << 2) | ((added >> bit) & 3u)) != 0) return -1;
+            prev = slot + 1;
+            slots &= slots - 1;
+        }
+    }
+    return 0;
+}
+
+/* Walks the entries of a delta; with t set it joins them, otherwise it only validates. */
+static int delta_walk(const tribool_delta *d, tribool_table *t, size_t *length, size_t *conflicts) {
+    size_t pos = 0;
+    uint64_t len, count;
+    if (delta_get(d, &pos, &len) != 0 || len > SIZE_MAX - TABLE_LANES) return -1;
+    if (delta_get(d, &pos, &count) != 0) return -1;
+
+    uint64_t next = 0; /* One past the previous entry. */
+    size_t added = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t entry;
+        if (delta_get(d, &pos, &entry) != 0) return -1;
+        uint64_t bits = entry & 3u, gap = entry >> 2;
+        if (!bits || next >= len || gap >= len - next) return -1;
+        uint64_t slot = next + gap;
+        if (t) {
+            uint64_t obs = bits << (2 * (slot % TABLE_LANES));
+            added += join_words(&t->words[slot / TABLE_LANES], &obs, 1);
+        }
+        next = slot + 1;
+    }
+    if (pos != d->size) return -1;
+    *length = (size_t)len;
+    if (conflicts) *conflicts = added;
+    return 0;
+}
+
+int fossil_type_tribool_table_apply(tribool_table *t, const tribool_delta *d, size_t *conflicts) {
+    size_t length;
+    if (!t || !d) return -1;
+    if (delta_walk(d, NULL, &length, NULL) != 0) return -1;
+    if (length > t->length && fossil_type_tribool_table_grow(t, length) != 0) return -1;
+    return delta_walk(d, t, &length, conflicts);
+}
@@ -0,0 +1,240 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_trit.h"
+#include <string.h>
+
+/* Values converted per batch on the tribool paths (16 encoded bytes). */
+#define TRIT_BLOCK 80
+
+/* ======================================================
+ * Decode tables
+ *
+ * Entry b is byte b split into its five trits: once as one
+ * byte per trit, once as five 2-bit lanes of a packed
+ * vector word.
+ * ====================================================== */
+
+static const tribool8 trit_decode_bytes[243][5] = {
+    {0,0,0,0,0}, {1,0,0,0,0}, {2,0,0,0,0}, {0,1,0,0,0}, {1,1,0,0,0}, {2,1,0,0,0},
+    {0,2,0,0,0}, {1,2,0,0,0}, {2,2,0,0,0}, {0,0,1,0,0}, {1,0,1,0,0}, {2,0,1,0,0},
+    {0,1,1,0,0}, {1,1,1,0,0}, {2,1,1,0,0}, {0,2,1,0,0}, {1,2,1,0,0}, {2,2,1,0,0},
+    {0,0,2,0,0}, {1,0,2,0,0}, {2,0,2,0,0}, {0,1,2,0,0}, {1,1,2,0,0}, {2,1,2,0,0},
+    {0,2,2,0,0}, {1,2,2,0,0}, {2,2,2,0,0}, {0,0,0,1,0}, {1,0,0,1,0}, {2,0,0,1,0},
+    {0,1,0,1,0}, {1,1,0,1,0}, {2,1,0,1,0}, {0,2,0,1,0}, {1,2,0,1,0}, {2,2,0,1,0},
+    {0,0,1,1,0}, {1,0,1,1,0}, {2,0,1,1,0}, {0,1,1,1,0}, {1,1,1,1,0}, {2,1,1,1,0},
+    {0,2,1,1,0}, {1,2,1,1,0}, {2,2,1,1,0}, {0,0,2,1,0}, {1,0,2,1,0}, {2,0,2,1,0},
+    {0,1,2,1,0}, {1,1,2,1,0}, {2,1,2,1,0}, {0,2,2,1,0}, {1,2,2,1,0}, {2,2,2,1,0},
+    {0,0,0,2,0}, {1,0,0,2,0}, {2,0,0,2,0}, {0,1,0,2,0}, {1,1,0,2,0}, {2,1,0,2,0},
+    {0,2,0,2,0}, {1,2,0,2,0}, {2,2,0,2,0}, {0,0,1,2,0}, {1,0,1,2,0}, {2,0,1,2,0},
+    {0,1,1,2,0}, {1,1,1,2,0}, {2,1,1,2,0}, {0,2,1,2,0}, {1,2,1,2,0}, {2,2,1,2,0},
+    {0,0,2,2,0}, {1,0,2,2,0}, {2,0,2,2,0}, {0,1,2,2,0}, {1,1,2,2,0}, {2,1,2,2,0},
+    {0,2,2,2,0}, {1,2,2,2,0}, {2,2,2,2,0}, {0,0,0,0,1}, {1,0,0,0,1}, {2,0,0,0,1},
+    {0,1,0,0,1}, {1,1,0,0,1}, {2,1,0,0,1}, {0,2,0,0,1}, {1,2,0,0,1}, {2,2,0,0,1},
+    {0,0,1,0,1}, {1,0,1,0,1}, {2,0,1,0,1}, {0,1,1,0,1}, {1,1,1,0,1}, {2,1,1,0,1},
+    {0,2,1,0,1}, {1,2,1,0,1}, {2,2,1,0,1}, {0,0,2,0,1}, {1,0,2,0,1}, {2,0,2,0,1},
+    {0,1,2,0,1}, {1,1,2,0,1}, {2,1,2,0,1}, {0,2,2,0,1}, {1,2,2,0,1}, {2,2,2,0,1},
+    {0,0,0,1,1}, {1,0,0,1,1}, {2,0,0,1,1}, {0,1,0,1,1}, {1,1,0,1,1}, {2,1,0,1,1},
+    {0,2,0,1,1}, {1,2,0,1,1}, {2,2,0,1,1}, {0,0,1,1,1}, {1,0,1,1,1}, {2,0,1,1,1},
+    {0,1,1,1,1}, {1,1,1,1,1}, {2,1,1,1,1}, {0,2,1,1,1}, {1,2,1,1,1}, {2,2,1,1,1},
+    {0,0,2,1,1}, {1,0,2,1,1}, {2,0,2,1,1}, {0,1,2,1,1}, {1,1,2,1,1}, {2,1,2,1,1},
+    {0,2,2,1,1}, {1,2,2,1,1}, {2,2,2,1,1}, {0,0,0,2,1}, {1,0,0,2,1}, {2,0,0,2,1},
+    {0,1,0,2,1}, {1,1,0,2,1}, {2,1,0,2,1}, {0,2,0,2,1}, {1,2,0,2,1}, {2,2,0,2,1},
+    {0,0,1,2,1}, {1,0,1,2,1}, {2,0,1,2,1}, {0,1,1,2,1}, {1,1,1,2,1}, {2,1,1,2,1},
+    {0,2,1,2,1}, {1,2,1,2,1}, {2,2,1,2,1}, {0,0,2,2,1}, {1,0,2,2,1}, {2,0,2,2,1},
+    {0,1,2,2,1}, {1,1,2,2,1}, {2,1,2,2,1}, {0,2,2,2,1}, {1,2,2,2,1}, {2,2,2,2,1},
+    {0,0,0,0,2}, {1,0,0,0,2}, {2,0,0,0,2}, {0,1,0,0,2}, {1,1,0,0,2}, {2,1,0,0,2},
+    {0,2,0,0,2}, {1,2,0,0,2}, {2,2,0,0,2}, {0,0,1,0,2}, {1,0,1,0,2}, {2,0,1,0,2},
+    {0,1,1,0,2}, {1,1,1,0,2}, {2,1,1,0,2}, {0,2,1,0,2}, {1,2,1,0,2}, {2,2,1,0,2},
+    {0,0,2,0,2}, {1,0,2,0,2}, {2,0,2,0,2}, {0,1,2,0,2}, {1,1,2,0,2}, {2,1,2,0,2},
+    {0,2,2,0,2}, {1,2,2,0,2}, {2,2,2,0,2}, {0,0,0,1,2}, {1,0,0,1,2}, {2,0,0,1,2},
+    {0,1,0,1,2}, {1,1,0,1,2}, {2,1,0,1,2}, {0,2,0,1,2}, {1,2,0,1,2}, {2,2,0,1,2},
+    {0,0,1,1,2}, {1,0,1,1,2}, {2,0,1,1,2}, {0,1,1,1,2}, {1,1,1,1,2}, {2,1,1,1,2},
+    {0,2,1,1,2}, {1,2,1,1,2}, {2,2,1,1,2}, {0,0,2,1,2}, {1,0,2,1,2}, {2,0,2,1,2},
+    {0,1,2,1,2}, {1,1,2,1,2}, {2,1,2,1,2}, {0,2,2,1,2}, {1,2,2,1,2}, {2,2,2,1,2},
+    {0,0,0,2,2}, {1,0,0,2,2}, {2,0,0,2,2}, {0,1,0,2,2}, {1,1,0,2,2}, {2,1,0,2,2},
+    {0,2,0,2,2}, {1,2,0,2,2}, {2,2,0,2,2}, {0,0,1,2,2}, {1,0,1,2,2}, {2,0,1,2,2},
+    {0,1,1,2,2}, {1,1,1,2,2}, {2,1,1,2,2}, {0,2,1,2,2}, {1,2,1,2,2}, {2,2,1,2,2},
+    {0,0,2,2,2}, {1,0,2,2,2}, {2,0,2,2,2}, {0,1,2,2,2}, {1,1,2,2,2}, {2,1,2,2,2},
+    {0,2,2,2,2}, {1,2,2,2,2}, {2,2,2,2,2}
+};
+
+static const uint16_t trit_decode_lanes[243] = {
+    0x000, 0x001, 0x002, 0x004, 0x005, 0x006, 0x008, 0x009, 0x00A,
+    0x010, 0x011, 0x012, 0x014, 0x015, 0x016, 0x018, 0x019, 0x01A,
+    0x020, 0x021, 0x022, 0x024, 0x025, 0x026, 0x028, 0x029, 0x02A,
+    0x040, 0x041, 0x042, 0x044, 0x045, 0x046, 0x048, 0x049, 0x04A,
+    0x050, 0x051, 0x052, 0x054, 0x055, 0x056, 0x058, 0x059, 0x05A,
+    0x060, 0x061, 0x062, 0x064, 0x065, 0x066, 0x068, 0x069, 0x06A,
+    0x080, 0x081, 0x082, 0x084, 0x085, 0x086, 0x088, 0x089, 0x08A,
+    0x090, 0x091, 0x092, 0x094, 0x095, 0x096, 0x098, 0x099, 0x09A,
+    0x0A0, 0x0A1, 0x0A2, 0x0A4, 0x0A5, 0x0A6, 0x0A8, 0x0A9, 0x0AA,
+    0x100, 0x101, 0x102, 0x104, 0x105, 0x106, 0x108, 0x109, 0x10A,
+    0x110, 0x111, 0x112, 0x114, 0x115, 0x116, 0x118, 0x119, 0x11A,
+    0x120, 0x121, 0x122, 0x124, 0x125, 0x126, 0x128, 0x129, 0x12A,
+    0x140, 0x141, 0x142, 0x144, 0x145, 0x146, 0x148, 0x149, 0x14A,
+    0x150, 0x151, 0x152, 0x154, 0x155, 0x156, 0x158, 0x159, 0x15A,
+    0x160, 0x161, 0x162, 0x164, 0x165, 0x166, 0x168, 0x169, 0x16A,
+    0x180, 0x181, 0x182, 0x184, 0x185, 0x186, 0x188, 0x189, 0x18A,
+    0x190, 0x191, 0x192, 0x194, 0x195, 0x196, 0x198, 0x199, 0x19A,
+    0x1A0, 0x1A1, 0x1A2, 0x1A4, 0x1A5, 0x1A6, 0x1A8, 0x1A9, 0x1AA,
+    0x200, 0x201, 0x202, 0x204, 0x205, 0x206, 0x208, 0x209, 0x20A,
+    0x210, 0x211, 0x212, 0x214, 0x215, 0x216, 0x218, 0x219, 0x21A,
+    0x220, 0x221, 0x222, 0x224, 0x225, 0x226, 0x228, 0x229, 0x22A,
+    0x240, 0x241, 0x242, 0x244, 0x245, 0x246, 0x248, 0x249, 0x24A,
+    0x250, 0x251, 0x252, 0x254, 0x255, 0x256, 0x258, 0x259, 0x25A,
+    0x260, 0x261, 0x262, 0x264, 0x265, 0x266, 0x268, 0x269, 0x26A,
+    0x280, 0x281, 0x282, 0x284, 0x285, 0x286, 0x288, 0x289, 0x28A,
+    0x290, 0x291, 0x292, 0x294, 0x295, 0x296, 0x298, 0x299, 0x29A,
+    0x2A0, 0x2A1, 0x2A2, 0x2A4, 0x2A5, 0x2A6, 0x2A8, 0x2A9, 0x2AA
+};
+
+/* ======================================================
+ * Byte-level helpers
+ * ====================================================== */
+
+static inline unsigned trit_digit(unsigned t) {
+    return t < 2u ? t : 2u;
+}
+
+static inline uint8_t trit_pack5(const tribool8 *s) {
+    return (uint8_t)(trit_digit(s[0]) + 3u * (trit_digit(s[1]) + 3u * (trit_digit(s[2]) +
+                     3u * (trit_digit(s[3]) + 3u * trit_digit(s[4])))));
+}
+
+/* Packs five 2-bit lane codes (10 bits of a vector word); code 3 reads as UNKNOWN. */
+static inline uint8_t trit_pack_lanes(unsigned x) {
+    return (uint8_t)(trit_digit(x & 3u) + 3u * (trit_digit((x >> 2) & 3u) + 3u * (trit_digit((x >> 4) & 3u) +
+                     3u * (trit_digit((x >> 6) & 3u) + 3u * trit_digit((x >> 8) & 3u)))));
+}
+
+/* ======================================================
+ * Arrays
+ * ====================================================== */
+
+size_t fossil_type_tribool8_trit_encode(uint8_t *dst, const tribool8 *src, size_t count) {
+    if (!dst || !src) return 0;
+    size_t full = count / FOSSIL_TYPE_TRIT_PER_BYTE;
+    size_t rem = count % FOSSIL_TYPE_TRIT_PER_BYTE;
+    for (size_t i = 0; i < full; i++) dst[i] = trit_pack5(src + i * FOSSIL_TYPE_TRIT_PER_BYTE);
+    if (rem) {
+        tribool8 tail[FOSSIL_TYPE_TRIT_PER_BYTE] = {0, 0, 0, 0, 0};
+        memcpy(tail, src + full * FOSSIL_TYPE_TRIT_PER_BYTE, rem);
+        dst[full] = trit_pack5(tail);
+    }
+    return FOSSIL_TYPE_TRIT_BYTES(count);
+}
+
+int fossil_type_tribool8_trit_decode(tribool8 *dst, const uint8_t *src, size_t count) {
+    if (!dst || !src) return -1;
+    size_t full = count / FOSSIL_TYPE_TRIT_PER_BYTE;
+    size_t rem = count % FOSSIL_TYPE_TRIT_PER_BYTE;
+    for (size_t i = 0; i < full; i++) {
+        if (src[i] >= 243) return -1;
+        memcpy(dst + i * FOSSIL_TYPE_TRIT_PER_BYTE, trit_decode_bytes[src[i]], FOSSIL_TYPE_TRIT_PER_BYTE);
+    }
+    if (rem) {
+        if (src[full] >= 243) return -1;
+        memcpy(dst + full * FOSSIL_TYPE_TRIT_PER_BYTE, trit_decode_bytes[src[full]], rem);
+    }
+    return 0;
+}
+
+/*
+ * The tribool paths work in blocks: the SIMD narrow/widen kernels move
+ * values between the enum and one-byte forms, and the byte code above
+ * does the base-3 step.
+ */
+size_t fossil_type_tribool_trit_encode(uint8_t *dst, const tribool *src, size_t count) {
+    tribool8 block[TRIT_BLOCK];
+    if (!dst || !src) return 0;
+    for (size_t i = 0; i < count; i += TRIT_BLOCK) {
+        size_t n = count - i < TRIT_BLOCK ? count - i : TRIT_BLOCK;
+        fossil_type_tribool_narrow(block, src + i, n);
+        fossil_type_tribool8_trit_encode(dst + i / FOSSIL_TYPE_TRIT_PER_BYTE, block, n);
+    }
+    return FOSSIL_TYPE_TRIT_BYTES(count);
+}
+
+int fossil_type_tribool_trit_decode(tribool *dst, const uint8_t *src, size_t count) {
+    tribool8 block[TRIT_BLOCK];
+    if (!dst || !src) return -1;
+    for (size_t i = 0; i < count; i += TRIT_BLOCK) {
+        size_t n = count - i < TRIT_BLOCK ? count - i : TRIT_BLOCK;
+        if (fossil_type_tribool8_trit_decode(block, src + i / FOSSIL_TYPE_TRIT_PER_BYTE, n) != 0) return -1;
+        fossil_type_tribool_widen(dst + i, block, n);
+    }
+    return 0;
+}
+
+/* ======================================================
+ * Packed vectors
+ *
+ * Five lanes are ten bits, so byte j covers bits
+ * [10j, 10j + 10) of the word stream and may straddle
+ * two words.
+ * ====================================================== */
+
+size_t fossil_type_tribool_vec_trit_encode(uint8_t *dst, const tribool_vec *v) {
+    if (!dst || !v) return 0;
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(v->length);
+    size_t nbytes = FOSSIL_TYPE_TRIT_BYTES(v->length);
+    for (size_t j = 0; j < nbytes; j++) {
+        size_t bit = j * 10;
+        size_t w = bit / 64;
+        unsigned sh = (unsigned)(bit % 64);
+        uint64_t x = v->words[w] >> sh;
+        if (sh > 54 && w + 1 < nwords) x |= v->words[w + 1] << (64 - sh);
+        /* Lanes past the length are padding (00) and encode as 0. */
+        dst[j] = trit_pack_lanes((unsigned)(x & 0x3FFu));
+    }
+    return nbytes;
+}
+
+int fossil_type_tribool_vec_trit_decode(tribool_vec *v, const uint8_t *src, size_t count) {
+    if (!v || !src) return -1;
+    if (fossil_type_tribool_vec_resize(v, count) != 0) return -1;
+    size_t nwords = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(count);
+    size_t nbytes = FOSSIL_TYPE_TRIT_BYTES(count);
+    uint64_t acc = 0;
+    unsigned used = 0;
+    size_t w = 0;
+    for (size_t j = 0; j < nbytes; j++) {
+        if (src[j] >= 243) return -1;
+        uint64_t x = trit_decode_lanes[src[j]];
+        acc |= x << used;
+        used += 10;
+        if (used >= 64) {
+            if (w < nwords) v->words[w++] = acc;
+            used -= 64;
+            acc = used ? x >> (10 - used) : 0;
+        }
+    }
+    if (w < nwords) v->words[w] = acc;
+    /* Clear lanes past count in case the stream's padding trits were not 0. */
+    if (count % FOSSIL_TYPE_TRIBOOL_VEC_LANES) {
+        v->words[nwords - 1] &= (1ULL << (2 * (count % FOSSIL_TYPE_TRIBOOL_VEC_LANES))) - 1;
+    }
+    return 0;
+}
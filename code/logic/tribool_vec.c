@@ -0,0 +1,457 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2013
+ *
+ * Copyright (C) 2013-Current Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/type/tribool_vec.h"
+#include "simd.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Bit 0 of every lane (the TRUE bit) and bit 1 (the UNKNOWN bit). */
+#define LANE_LO 0x5555555555555555ULL
+#define LANE_HI 0xAAAAAAAAAAAAAAAAULL
+
+/* ======================================================
+ * Scalar word logic
+ * ====================================================== */
+
+/*
+ * Per lane, with k = lane | (lane >> 1) meaning "not FALSE":
+ *   AND: t = ta & tb, unknown when both are non-false but not both true
+ *   OR:  t = ta | tb, unknown when either is non-false but neither true
+ *   NOT: TRUE bit becomes "was FALSE", UNKNOWN bit is kept
+ */
+static inline uint64_t word_and(uint64_t a, uint64_t b) {
+    uint64_t t  = a & b & LANE_LO;
+    uint64_t nf = (a | (a >> 1)) & (b | (b >> 1)) & LANE_LO;
+    return t | ((nf & ~t) << 1);
+}
+
+static inline uint64_t word_or(uint64_t a, uint64_t b) {
+    uint64_t t  = (a | b) & LANE_LO;
+    uint64_t nf = (a | (a >> 1) | b | (b >> 1)) & LANE_LO;
+    return t | ((nf & ~t) << 1);
+}
+
+static inline uint64_t word_not(uint64_t a) {
+    return (~(a | (a >> 1)) & LANE_LO) | (a & LANE_HI);
+}
+
+static void and_scalar(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = word_and(a[i], b[i]);
+}
+
+static void or_scalar(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = word_or(a[i], b[i]);
+}
+
+static void not_scalar(uint64_t *dst, const uint64_t *a, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = word_not(a[i]);
+}
+
+/* ======================================================
+ * SSE2 kernels (2 words per step)
+ * ====================================================== */
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+
+static void and_sse2(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    const __m128i lo = _mm_set1_epi64x((long long)LANE_LO);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i x  = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i y  = _mm_loadu_si128((const __m128i *)(b + i));
+        __m128i t  = _mm_and_si128(_mm_and_si128(x, y), lo);
+        __m128i kx = _mm_or_si128(x, _mm_srli_epi64(x, 1));
+        __m128i ky = _mm_or_si128(y, _mm_srli_epi64(y, 1));
+        __m128i nf = _mm_and_si128(_mm_and_si128(kx, ky), lo);
+        __m128i r  = _mm_or_si128(t, _mm_slli_epi64(_mm_andnot_si128(t, nf), 1));
+        _mm_storeu_si128((__m128i *)(dst + i), r);
+    }
+    and_scalar(dst + i, a + i, b + i, n - i);
+}
+
+static void or_sse2(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    const __m128i lo = _mm_set1_epi64x((long long)LANE_LO);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i x  = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i y  = _mm_loadu_si128((const __m128i *)(b + i));
+        __m128i xy = _mm_or_si128(x, y);
+        __m128i t  = _mm_and_si128(xy, lo);
+        __m128i nf = _mm_and_si128(_mm_or_si128(xy, _mm_srli_epi64(xy, 1)), lo);
+        __m128i r  = _mm_or_si128(t, _mm_slli_epi64(_mm_andnot_si128(t, nf), 1));
+        _mm_storeu_si128((__m128i *)(dst + i), r);
+    }
+    or_scalar(dst + i, a + i, b + i, n - i);
+}
+
+static void not_sse2(uint64_t *dst, const uint64_t *a, size_t n) {
+    const __m128i lo = _mm_set1_epi64x((long long)LANE_LO);
+    const __m128i hi = _mm_set1_epi64x((long long)LANE_HI);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i f = _mm_andnot_si128(_mm_or_si128(x, _mm_srli_epi64(x, 1)), lo);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(f, _mm_and_si128(x, hi)));
+    }
+    not_scalar(dst + i, a + i, n - i);
+}
+
+#endif
+
+/* ======================================================
+ * AVX2 kernels (4 words per step, runtime selected)
+ * ====================================================== */
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+
+FOSSIL_TYPE_TARGET_AVX2
+static void and_avx2(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    const __m256i lo = _mm256_set1_epi64x((long long)LANE_LO);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x  = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i y  = _mm256_loadu_si256((const __m256i *)(b + i));
+        __m256i t  = _mm256_and_si256(_mm256_and_si256(x, y), lo);
+        __m256i kx = _mm256_or_si256(x, _mm256_srli_epi64(x, 1));
+        __m256i ky = _mm256_or_si256(y, _mm256_srli_epi64(y, 1));
+        __m256i nf = _mm256_and_si256(_mm256_and_si256(kx, ky), lo);
+        __m256i r  = _mm256_or_si256(t, _mm256_slli_epi64(_mm256_andnot_si256(t, nf), 1));
+        _mm256_storeu_si256((__m256i *)(dst + i), r);
+    }
+    and_scalar(dst + i, a + i, b + i, n - i);
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static void or_avx2(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    const __m256i lo = _mm256_set1_epi64x((long long)LANE_LO);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x  = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i y  = _mm256_loadu_si256((const __m256i *)(b + i));
+        __m256i xy = _mm256_or_si256(x, y);
+        __m256i t  = _mm256_and_si256(xy, lo);
+        __m256i nf = _mm256_and_si256(_mm256_or_si256(xy, _mm256_srli_epi64(xy, 1)), lo);
+        __m256i r  = _mm256_or_si256(t, _mm256_slli_epi64(_mm256_andnot_si256(t, nf), 1));
+        _mm256_storeu_si256((__m256i *)(dst + i), r);
+    }
+    or_scalar(dst + i, a + i, b + i, n - i);
+}
+
+FOSSIL_TYPE_TARGET_AVX2
+static void not_avx2(uint64_t *dst, const uint64_t *a, size_t n) {
+    const __m256i lo = _mm256_set1_epi64x((long long)LANE_LO);
+    const __m256i hi = _mm256_set1_epi64x((long long)LANE_HI);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i f = _mm256_andnot_si256(_mm256_or_si256(x, _mm256_srli_epi64(x, 1)), lo);
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_or_si256(f, _mm256_and_si256(x, hi)));
+    }
+    not_scalar(dst + i, a + i, n - i);
+}
+
+#endif
+
+/* ======================================================
+ * NEON kernels (2 words per step)
+ * ====================================================== */
+#if defined(FOSSIL_TYPE_HAVE_NEON)
+
+static void and_neon(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    const uint64x2_t lo = vdupq_n_u64(LANE_LO);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        uint64x2_t x  = vld1q_u64(a + i);
+        uint64x2_t y  = vld1q_u64(b + i);
+        uint64x2_t t  = vandq_u64(vandq_u64(x, y), lo);
+        uint64x2_t kx = vorrq_u64(x, vshrq_n_u64(x, 1));
+        uint64x2_t ky = vorrq_u64(y, vshrq_n_u64(y, 1));
+        uint64x2_t nf = vandq_u64(vandq_u64(kx, ky), lo);
+        vst1q_u64(dst + i, vorrq_u64(t, vshlq_n_u64(vbicq_u64(nf, t), 1)));
+    }
+    and_scalar(dst + i, a + i, b + i, n - i);
+}
+
+static void or_neon(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t n) {
+    const uint64x2_t lo = vdupq_n_u64(LANE_LO);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        uint64x2_t xy = vorrq_u64(vld1q_u64(a + i), vld1q_u64(b + i));
+        uint64x2_t t  = vandq_u64(xy, lo);
+        uint64x2_t nf = vandq_u64(vorrq_u64(xy, vshrq_n_u64(xy, 1)), lo);
+        vst1q_u64(dst + i, vorrq_u64(t, vshlq_n_u64(vbicq_u64(nf, t), 1)));
+    }
+    or_scalar(dst + i, a + i, b + i, n - i);
+}
+
+static void not_neon(uint64_t *dst, const uint64_t *a, size_t n) {
+    const uint64x2_t lo = vdupq_n_u64(LANE_LO);
+    const uint64x2_t hi = vdupq_n_u64(LANE_HI);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        uint64x2_t x = vld1q_u64(a + i);
+        uint64x2_t f = vbicq_u64(lo, vorrq_u64(x, vshrq_n_u64(x, 1)));
+        vst1q_u64(dst + i, vorrq_u64(f, vandq_u64(x, hi)));
+    }
+    not_scalar(dst + i, a + i, n - i);
+}
+
+#endif
+
+/* ======================================================
+ * Kernel selection
+ * ====================================================== */
+
+typedef struct tribool_vec_kernels {
+    const char *name;
+    void (*and_words)(uint64_t *, const uint64_t *, const uint64_t *, size_t);
+    void (*or_words)(uint64_t *, const uint64_t *, const uint64_t *, size_t);
+    void (*not_words)(uint64_t *, const uint64_t *, size_t);
+} tribool_vec_kernels;
+
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+static const tribool_vec_kernels kernels_avx2 = { "avx2", and_avx2, or_avx2, not_avx2 };
+#endif
+
+#if defined(FOSSIL_TYPE_HAVE_SSE2)
+static const tribool_vec_kernels kernels_base = { "sse2", and_sse2, or_sse2, not_sse2 };
+#elif defined(FOSSIL_TYPE_HAVE_NEON)
+static const tribool_vec_kernels kernels_base = { "neon", and_neon, or_neon, not_neon };
+#else
+static const tribool_vec_kernels kernels_base = { "scalar", and_scalar, or_scalar, not_scalar };
+#endif
+
+static const tribool_vec_kernels *select_kernels(void) {
+#if defined(FOSSIL_TYPE_HAVE_AVX2)
+    if (fossil_type_simd_has_avx2()) return &kernels_avx2;
+#endif
+    return &kernels_base;
+}
+
+void fossil_type_tribool_words_and(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t nwords) {
+    if (!dst || !a || !b) return;
+    select_kernels()->and_words(dst, a, b, nwords);
+}
+
+void fossil_type_tribool_words_or(uint64_t *dst, const uint64_t *a, const uint64_t *b, size_t nwords) {
+    if (!dst || !a || !b) return;
+    select_kernels()->or_words(dst, a, b, nwords);
+}
+
+void fossil_type_tribool_words_not(uint64_t *dst, const uint64_t *a, size_t nwords) {
+    if (!dst || !a) return;
+    select_kernels()->not_words(dst, a, nwords);
+}
+
+const char *fossil_type_tribool_vec_kernel(void) {
+    return select_kernels()->name;
+}
+
+/* ======================================================
+ * Helpers
+ * ====================================================== */
+
+static inline uint64_t lane_code(tribool t) {
+    unsigned c = (unsigned)t;
+    return c > FOSSIL_TYPE_TRIBOOL_UNKNOWN ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : c;
+}
+
+static inline uint64_t lane_pattern(tribool t) {
+    return lane_code(t) * LANE_LO;
+}
+
+/* Mask of the valid lanes in the last word of a vector of the given length. */
+static inline uint64_t tail_mask(size_t length) {
+    size_t rem = length % FOSSIL_TYPE_TRIBOOL_VEC_LANES;
+    return rem ? (1ULL << (2 * rem)) - 1 : ~0ULL;
+}
+
+static void clear_tail(tribool_vec *v) {
+    if (v->length) v->words[(v->length - 1) / FOSSIL_TYPE_TRIBOOL_VEC_LANES] &= tail_mask(v->length);
+}
+
+/* Stores the same value into lanes [from, to). */
+static void fill_range(uint64_t *words, size_t from, size_t to, tribool t) {
+    uint64_t pattern = lane_pattern(t);
+    while (from < to && from % FOSSIL_TYPE_TRIBOOL_VEC_LANES) {
+        size_t shift = 2 * (from % FOSSIL_TYPE_TRIBOOL_VEC_LANES);
+        uint64_t *w = &words[from / FOSSIL_TYPE_TRIBOOL_VEC_LANES];
+        *w = (*w & ~(3ULL << shift)) | (lane_code(t) << shift);
+        from++;
+    }
+    for (; from + FOSSIL_TYPE_TRIBOOL_VEC_LANES <= to; from += FOSSIL_TYPE_TRIBOOL_VEC_LANES) {
+        words[from / FOSSIL_TYPE_TRIBOOL_VEC_LANES] = pattern;
+    }
+    if (from < to) {
+        uint64_t *w = &words[from / FOSSIL_TYPE_TRIBOOL_VEC_LANES];
+        uint64_t mask = tail_mask(to);
+        *w = (*w & ~mask) | (pattern & mask);
+    }
+}
+
+/* ======================================================
+ * Lifetime
+ * ====================================================== */
+
+int fossil_type_tribool_vec_init(tribool_vec *v, size_t length) {
+    if (!v) return -1;
+    v->words = NULL;
+    v->length = 0;
+    return fossil_type_tribool_vec_resize(v, length);
+}
+
+void fossil_type_tribool_vec_free(tribool_vec *v) {
+    if (!v) return;
+    free(v->words);
+    v->words = NULL;
+    v->length = 0;
+}
+
+int fossil_type_tribool_vec_resize(tribool_vec *v, size_t length) {
+    if (!v) return -1;
+    if (length > SIZE_MAX - FOSSIL_TYPE_TRIBOOL_VEC_LANES) return -1;
+
+    size_t old_words = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(v->length);
+    size_t new_words = FOSSIL_TYPE_TRIBOOL_VEC_WORDS(length);
+    if (new_words == 0) {
+        fossil_type_tribool_vec_free(v);
+        return 0;
+    }
+    if (new_words != old_words) {
+        if (new_words > SIZE_MAX / sizeof(uint64_t)) return -1;
+        uint64_t *words = (uint64_t *)realloc(v->words, new_words * sizeof(uint64_t));
+        if (!words) return -1;
+        if (new_words > old_words) {
+            memset(words + old_words, 0, (new_words - old_words) * sizeof(uint64_t));
+        }
+        v->words = words;
+    }
+
+    size_t old_length = v->length;
+    v->length = length;
+    if (length > old_length) {
+        fill_range(v->words, old_length, length, FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    } else {
+        clear_tail(v);
+    }
+    return 0;
+}
+
+int fossil_type_tribool_vec_copy(tribool_vec *dst, const tribool_vec *src) {
+    if (!dst || !src) return -1;
+    if (dst == src) return 0;
+    if (fossil_type_tribool_vec_resize(dst, src->length) != 0) return -1;
+    if (src->length) {
+        memcpy(dst->words, src->words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(src->length) * sizeof(uint64_t));
+    }
+    return 0;
+}
+
+/* ======================================================
+ * Element access
+ * ====================================================== */
+
+size_t fossil_type_tribool_vec_length(const tribool_vec *v) {
+    return v ? v->length : 0;
+}
+
+tribool fossil_type_tribool_vec_get(const tribool_vec *v, size_t index) {
+    if (!v || index >= v->length) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    uint64_t w = v->words[index / FOSSIL_TYPE_TRIBOOL_VEC_LANES];
+    return (tribool)((w >> (2 * (index % FOSSIL_TYPE_TRIBOOL_VEC_LANES))) & 3u);
+}
+
+void fossil_type_tribool_vec_set(tribool_vec *v, size_t index, tribool t) {
+    if (!v || index >= v->length) return;
+    size_t shift = 2 * (index % FOSSIL_TYPE_TRIBOOL_VEC_LANES);
+    uint64_t *w = &v->words[index / FOSSIL_TYPE_TRIBOOL_VEC_LANES];
+    *w = (*w & ~(3ULL << shift)) | (lane_code(t) << shift);
+}
+
+void fossil_type_tribool_vec_fill(tribool_vec *v, tribool t) {
+    if (!v || !v->length) return;
+    fill_range(v->words, 0, v->length, t);
+}
+
+int fossil_type_tribool_vec_pack(tribool_vec *v, const tribool *src, size_t count) {
+    if (!v || (!src && count)) return -1;
+    if (fossil_type_tribool_vec_resize(v, count) != 0) return -1;
+
+    size_t full = count / FOSSIL_TYPE_TRIBOOL_VEC_LANES;
+    for (size_t w = 0; w < full; w++) {
+        const tribool *s = src + w * FOSSIL_TYPE_TRIBOOL_VEC_LANES;
+        uint64_t word = 0;
+        for (size_t j = 0; j < FOSSIL_TYPE_TRIBOOL_VEC_LANES; j++) {
+            word |= lane_code(s[j]) << (2 * j);
+        }
+        v->words[w] = word;
+    }
+    if (count % FOSSIL_TYPE_TRIBOOL_VEC_LANES) {
+        const tribool *s = src + full * FOSSIL_TYPE_TRIBOOL_VEC_LANES;
+        uint64_t word = 0;
+        for (size_t j = 0; j < count % FOSSIL_TYPE_TRIBOOL_VEC_LANES; j++) {
+            word |= lane_code(s[j]) << (2 * j);
+        }
+        v->words[full] = word;
+    }
+    return 0;
+}
+
+void fossil_type_tribool_vec_unpack(const tribool_vec *v, tribool *dst) {
+    if (!v || !dst) return;
+    for (size_t i = 0; i < v->length; i++) {
+        uint64_t w = v->words[i / FOSSIL_TYPE_TRIBOOL_VEC_LANES];
+        dst[i] = (tribool)((w >> (2 * (i % FOSSIL_TYPE_TRIBOOL_VEC_LANES))) & 3u);
+    }
+}
+
+/* ======================================================
+ * Logic
+ * ====================================================== */
+
+int fossil_type_tribool_vec_and(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    if (!dst || !a || !b || a->length != b->length) return -1;
+    if (fossil_type_tribool_vec_resize(dst, a->length) != 0) return -1;
+    if (!a->length) return 0;
+    select_kernels()->and_words(dst->words, a->words, b->words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(a->length));
+    clear_tail(dst);
+    return 0;
+}
+
+int fossil_type_tribool_vec_or(tribool_vec *dst, const tribool_vec *a, const tribool_vec *b) {
+    if (!dst || !a || !b || a->length != b->length) return -1;
+    if (fossil_type_tribool_vec_resize(dst, a->length) != 0) return -1;
+    if (!a->length) return 0;
+    select_kernels()->or_words(dst->words, a->words, b->words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(a->length));
+    clear_tail(dst);
+    return 0;
+}
+
+int fossil_type_tribool_vec_not(tribool_vec *dst, const tribool_vec *a) {
+    if (!dst || !a) return -1;
+    if (fossil_type_tribool_vec_resize(dst, a->length) != 0) return -1;
+    if (!a->length) return 0;
+    select_kernels()->not_words(dst->words, a->words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(a->length));
+    clear_tail(dst);
+    return 0;
+}
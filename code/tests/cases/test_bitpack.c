@@ -0,0 +1,190 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <stdlib.h>
+#include <string.h>
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_bitpack_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_bitpack_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_bitpack_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: i64 columns round-trip at every width, with both block sizes
+FOSSIL_TEST(c_test_bitpack_roundtrip_i64) {
+    enum { N = 1000 };
+    int64_t src[N], out[N];
+    size_t sizes[2] = {FOSSIL_TYPE_BITPACK_BLOCK, FOSSIL_TYPE_BITPACK_BLOCK_SMALL};
+    fossil_type_bitpack p;
+    fossil_type_bitpack_init(&p);
+
+    for (unsigned width = 0; width <= 64; width++) {
+        uint64_t mask = width == 64 ? ~0ULL : (1ULL << width) - 1;
+        for (size_t i = 0; i < N; i++) {
+            uint64_t r = ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand() ^ ((uint64_t)rand() << 60);
+            src[i] = (int64_t)((uint64_t)-5000 + (r & mask));
+        }
+        for (int s = 0; s < 2; s++) {
+            memset(out, 0, sizeof(out));
+            ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, src, FOSSIL_TYPE_KIND_I64, N, sizes[s]) == 0);
+            ASSUME_ITS_TRUE(p.block_count == (N + sizes[s] - 1) / sizes[s]);
+            ASSUME_ITS_TRUE(p.blocks[0].width <= width);
+            ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, out) == 0);
+            ASSUME_ITS_TRUE(memcmp(src, out, sizeof(src)) == 0);
+        }
+    }
+    fossil_type_bitpack_free(&p);
+}
+
+// Test: extremes of every integer kind round-trip
+FOSSIL_TEST(c_test_bitpack_kinds) {
+    int8_t i8[5] = {INT8_MIN, -1, 0, 1, INT8_MAX}, o8[5];
+    uint8_t u8[4] = {0, 1, 200, UINT8_MAX}, p8[4];
+    int16_t i16[3] = {INT16_MIN, 7, INT16_MAX}, o16[3];
+    uint16_t u16[3] = {65535, 0, 32768}, p16[3];
+    int32_t i32[3] = {INT32_MIN, -3, INT32_MAX}, o32[3];
+    uint32_t u32[3] = {UINT32_MAX, 5, 0}, p32[3];
+    uint64_t u64[3] = {UINT64_MAX, 0, (uint64_t)INT64_MAX + 1}, p64[3];
+    int64_t i64[3] = {INT64_MIN, INT64_MAX, 0}, o64[3];
+    fossil_type_bitpack p;
+    fossil_type_bitpack_init(&p);
+
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, i8, FOSSIL_TYPE_KIND_I8, 5, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.blocks[0].width == 8 && fossil_type_bitpack_decode(&p, o8) == 0 && memcmp(i8, o8, 5) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, u8, FOSSIL_TYPE_KIND_U8, 4, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, p8) == 0 && memcmp(u8, p8, 4) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, i16, FOSSIL_TYPE_KIND_I16, 3, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, o16) == 0 && memcmp(i16, o16, sizeof(i16)) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, u16, FOSSIL_TYPE_KIND_H16, 3, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, p16) == 0 && memcmp(u16, p16, sizeof(u16)) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, i32, FOSSIL_TYPE_KIND_I32, 3, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, o32) == 0 && memcmp(i32, o32, sizeof(i32)) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, u32, FOSSIL_TYPE_KIND_U32, 3, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.blocks[0].width == 32 && p.blocks[0].base == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, p32) == 0 && memcmp(u32, p32, sizeof(u32)) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, u64, FOSSIL_TYPE_KIND_U64, 3, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.blocks[0].width == 64);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, p64) == 0 && memcmp(u64, p64, sizeof(u64)) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, i64, FOSSIL_TYPE_KIND_I64, 3, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.blocks[0].base == (uint64_t)INT64_MIN && p.blocks[0].width == 64);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, o64) == 0 && memcmp(i64, o64, sizeof(i64)) == 0);
+    fossil_type_bitpack_free(&p);
+}
+
+// Test: single blocks and single values decode on their own
+FOSSIL_TEST(c_test_bitpack_random_access) {
+    enum { N = 700 };
+    int32_t src[N], out[FOSSIL_TYPE_BITPACK_BLOCK];
+    fossil_type_bitpack p;
+    fossil_type_bitpack_init(&p);
+    for (size_t i = 0; i < N; i++) src[i] = (int32_t)(i * 37 % 1001) - 500;
+
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, src, FOSSIL_TYPE_KIND_I32, N, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.block_count == 3);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode_block(&p, 2, out) == 0);
+    ASSUME_ITS_TRUE(memcmp(out, src + 512, (N - 512) * sizeof(int32_t)) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode_block(&p, 1, out) == 0);
+    ASSUME_ITS_TRUE(memcmp(out, src + 256, 256 * sizeof(int32_t)) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode_block(&p, 3, out) == -1);
+
+    for (size_t i = 0; i < N; i += 13) {
+        int32_t v = 0;
+        ASSUME_ITS_TRUE(fossil_type_bitpack_get(&p, i, &v) == 0 && v == src[i]);
+    }
+    ASSUME_ITS_TRUE(fossil_type_bitpack_get(&p, N, out) == -1);
+    fossil_type_bitpack_free(&p);
+}
+
+// Test: narrow ranges take a fraction of the raw size
+FOSSIL_TEST(c_test_bitpack_footprint) {
+    enum { N = 4096 };
+    int64_t src[N];
+    fossil_type_bitpack p;
+    fossil_type_bitpack_init(&p);
+    for (size_t i = 0; i < N; i++) src[i] = 1000000 + (int64_t)(i % 16);
+
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, src, FOSSIL_TYPE_KIND_I64, N, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.blocks[0].width == 4 && p.blocks[0].base == 1000000);
+    ASSUME_ITS_TRUE(p.word_count == N * 4 / 64);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_bytes(&p) * 10 < sizeof(src));
+
+    for (size_t i = 0; i < N; i++) src[i] = -42;
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, src, FOSSIL_TYPE_KIND_I64, N, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.word_count == 0 && p.blocks[15].width == 0);
+    int64_t v = 0;
+    ASSUME_ITS_TRUE(fossil_type_bitpack_get(&p, N - 1, &v) == 0 && v == -42);
+    fossil_type_bitpack_free(&p);
+}
+
+// Test: type IDs, empty columns and rejected arguments
+FOSSIL_TEST(c_test_bitpack_edges) {
+    uint16_t src[3] = {10, 20, 30}, out[3] = {0, 0, 0};
+    double reals[2] = {1.0, 2.0};
+    fossil_type_bitpack p;
+    fossil_type_bitpack_init(&p);
+
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode_id(&p, src, "u16", 3, FOSSIL_TYPE_BITPACK_BLOCK_SMALL) == 0);
+    ASSUME_ITS_TRUE(p.kind == FOSSIL_TYPE_KIND_U16 && p.block_size == 128);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, out) == 0 && out[2] == 30);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode_id(&p, reals, "f64", 2, FOSSIL_TYPE_BITPACK_BLOCK) == -1);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode_id(&p, src, "nope", 3, FOSSIL_TYPE_BITPACK_BLOCK) == -1);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, src, FOSSIL_TYPE_KIND_BOOL, 3, FOSSIL_TYPE_BITPACK_BLOCK) == -1);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, src, FOSSIL_TYPE_KIND_U16, 3, 64) == -1);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, NULL, FOSSIL_TYPE_KIND_U16, 3, FOSSIL_TYPE_BITPACK_BLOCK) == -1);
+    ASSUME_ITS_TRUE(p.count == 3);
+
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode(&p, NULL, FOSSIL_TYPE_KIND_U16, 0, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.count == 0 && p.block_count == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(&p, NULL) == 0);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_decode(NULL, out) == -1);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_bytes(NULL) == 0);
+    fossil_type_bitpack_free(&p);
+    fossil_type_bitpack_free(NULL);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_bitpack_tests) {
+    FOSSIL_ADD_TEST(c_bitpack_suite, c_test_bitpack_roundtrip_i64);
+    FOSSIL_ADD_TEST(c_bitpack_suite, c_test_bitpack_kinds);
+    FOSSIL_ADD_TEST(c_bitpack_suite, c_test_bitpack_random_access);
+    FOSSIL_ADD_TEST(c_bitpack_suite, c_test_bitpack_footprint);
+    FOSSIL_ADD_TEST(c_bitpack_suite, c_test_bitpack_edges);
+
+    FOSSIL_ADD_SUITE(c_bitpack_suite);
+}
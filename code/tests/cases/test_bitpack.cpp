@@ -0,0 +1,88 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_bitpack_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_bitpack_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_bitpack_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: BitPack round-trips a span and picks the kind from the element type
+FOSSIL_TEST(cpp_test_BitPack_span) {
+    std::vector<uint32_t> values(1000);
+    for (size_t i = 0; i < values.size(); i++) values[i] = 70000u + (uint32_t)(i * 7 % 300);
+
+    fossil::type::BitPack pack;
+    ASSUME_ITS_TRUE(pack.encode(std::span<const uint32_t>(values)));
+    ASSUME_ITS_TRUE(pack.kind() == FOSSIL_TYPE_KIND_U32);
+    ASSUME_ITS_TRUE(pack.size() == 1000 && pack.block_count() == 4);
+    ASSUME_ITS_TRUE(pack.bytes() < values.size() * sizeof(uint32_t) / 2);
+
+    std::vector<uint32_t> out(values.size());
+    ASSUME_ITS_TRUE(pack.decode(std::span<uint32_t>(out)));
+    ASSUME_ITS_TRUE(out == values);
+}
+
+// Test: BitPack random access checks the element width
+FOSSIL_TEST(cpp_test_BitPack_access) {
+    std::vector<int16_t> values(300);
+    for (size_t i = 0; i < values.size(); i++) values[i] = (int16_t)(i % 2 ? -(int)i : (int)i);
+
+    fossil::type::BitPack pack;
+    ASSUME_ITS_TRUE(pack.encode(std::span<const int16_t>(values), FOSSIL_TYPE_BITPACK_BLOCK_SMALL));
+    ASSUME_ITS_TRUE(pack.get<int16_t>(299) == -299);
+    ASSUME_ITS_TRUE(pack.get<int64_t>(299) == 0);
+
+    std::vector<int16_t> block(pack.block_size());
+    std::vector<int32_t> wrong(pack.block_size());
+    ASSUME_ITS_TRUE(pack.decode_block(1, std::span<int16_t>(block)));
+    ASSUME_ITS_TRUE(block[0] == 128 && block[1] == -129);
+    ASSUME_ITS_TRUE(!pack.decode_block(1, std::span<int32_t>(wrong)));
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_bitpack_tests) {
+    FOSSIL_ADD_TEST(cpp_bitpack_suite, cpp_test_BitPack_span);
+    FOSSIL_ADD_TEST(cpp_bitpack_suite, cpp_test_BitPack_access);
+
+    FOSSIL_ADD_SUITE(cpp_bitpack_suite);
+}
@@ -0,0 +1,240 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <float.h>
+#include <math.h>
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_convert_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_convert_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_convert_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: integer narrowing under each policy
+FOSSIL_TEST(c_test_convert_int_policies) {
+    int64_t src[6] = {-129, -128, 127, 128, 300, INT64_MIN};
+    int8_t dst[6];
+    size_t fail = 0;
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_I8, src, FOSSIL_TYPE_KIND_I64, 6,
+                                        FOSSIL_TYPE_CONVERT_WRAP, &fail) == 0);
+    ASSUME_ITS_TRUE(dst[0] == 127 && dst[1] == -128 && dst[3] == -128 && dst[4] == 44 && dst[5] == 0);
+    ASSUME_ITS_TRUE(fail == FOSSIL_TYPE_RANGE_NPOS);
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_I8, src, FOSSIL_TYPE_KIND_I64, 6,
+                                        FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[0] == -128 && dst[2] == 127 && dst[3] == 127 && dst[4] == 127 && dst[5] == -128);
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_I8, src + 1, FOSSIL_TYPE_KIND_I64, 5,
+                                        FOSSIL_TYPE_CONVERT_CHECKED, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == 2);
+    ASSUME_ITS_TRUE(dst[0] == -128 && dst[1] == 127);
+}
+
+// Test: signedness changes saturate at the right end
+FOSSIL_TEST(c_test_convert_signedness) {
+    uint64_t big[3] = {0, 5, UINT64_MAX};
+    int16_t neg[3] = {-1, 0, 32767};
+    int32_t i32s[3];
+    uint8_t u8s[3];
+
+    ASSUME_ITS_TRUE(fossil_type_convert(i32s, FOSSIL_TYPE_KIND_I32, big, FOSSIL_TYPE_KIND_U64, 3,
+                                        FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(i32s[0] == 0 && i32s[1] == 5 && i32s[2] == INT32_MAX);
+    ASSUME_ITS_TRUE(fossil_type_convert(u8s, FOSSIL_TYPE_KIND_U8, neg, FOSSIL_TYPE_KIND_I16, 3,
+                                        FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(u8s[0] == 0 && u8s[1] == 0 && u8s[2] == 255);
+    ASSUME_ITS_TRUE(fossil_type_convert(u8s, FOSSIL_TYPE_KIND_U8, neg, FOSSIL_TYPE_KIND_I16, 3,
+                                        FOSSIL_TYPE_CONVERT_WRAP, NULL) == 0);
+    ASSUME_ITS_TRUE(u8s[0] == 255 && u8s[2] == 255);
+}
+
+// Test: float to integer handles NaN, infinities and fractions
+FOSSIL_TEST(c_test_convert_float_to_int) {
+    double src[6] = {NAN, INFINITY, -INFINITY, 3.7, -3.7, 1e10};
+    int32_t dst[6];
+    size_t fail = 0;
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_I32, src, FOSSIL_TYPE_KIND_F64, 6,
+                                        FOSSIL_TYPE_CONVERT_WRAP, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[0] == 0 && dst[1] == 0 && dst[2] == 0);
+    ASSUME_ITS_TRUE(dst[3] == 3 && dst[4] == -3 && dst[5] == 1410065408);
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_I32, src, FOSSIL_TYPE_KIND_F64, 6,
+                                        FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[0] == 0 && dst[1] == INT32_MAX && dst[2] == INT32_MIN);
+    ASSUME_ITS_TRUE(dst[3] == 3 && dst[4] == -3 && dst[5] == INT32_MAX);
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_I32, src, FOSSIL_TYPE_KIND_F64, 6,
+                                        FOSSIL_TYPE_CONVERT_CHECKED, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == 0);
+}
+
+// Test: CHECKED accepts negative fractions that truncate into range, like every policy
+FOSSIL_TEST(c_test_convert_float_checked_fractions) {
+    double src[5] = {-0.5, -0.999, 255.5, 255.999, -1.0};
+    float fsrc[3] = {-128.5f, 127.5f, -129.0f};
+    uint8_t dst[5] = {9, 9, 9, 9, 9};
+    int8_t sdst[3] = {9, 9, 9};
+    size_t fail = 0;
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_U8, src, FOSSIL_TYPE_KIND_F64, 5,
+                                        FOSSIL_TYPE_CONVERT_CHECKED, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == 4);
+    ASSUME_ITS_TRUE(dst[0] == 0 && dst[1] == 0 && dst[2] == 255 && dst[3] == 255 && dst[4] == 9);
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_U8, src, FOSSIL_TYPE_KIND_F64, 4,
+                                        FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[0] == 0 && dst[1] == 0 && dst[2] == 255 && dst[3] == 255);
+
+    ASSUME_ITS_TRUE(fossil_type_convert(sdst, FOSSIL_TYPE_KIND_I8, fsrc, FOSSIL_TYPE_KIND_F32, 3,
+                                        FOSSIL_TYPE_CONVERT_CHECKED, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == 2 && sdst[0] == -128 && sdst[1] == 127 && sdst[2] == 9);
+}
+
+// Test: 64-bit float wrap and saturate beyond the int64 range
+FOSSIL_TEST(c_test_convert_float_to_u64) {
+    double src[4] = {-1.0, 18446744073709555712.0, 1e20, -5.0};
+    uint64_t dst[4];
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_U64, src, FOSSIL_TYPE_KIND_F64, 4,
+                                        FOSSIL_TYPE_CONVERT_WRAP, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[0] == UINT64_MAX && dst[1] == 4096u && dst[3] == (uint64_t)-5);
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_U64, src, FOSSIL_TYPE_KIND_F64, 4,
+                                        FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[0] == 0 && dst[1] == UINT64_MAX && dst[2] == UINT64_MAX && dst[3] == 0);
+}
+
+// Test: f64 to f32 overflows or clamps, special values carry over
+FOSSIL_TEST(c_test_convert_float_narrowing) {
+    double src[4] = {1e39, -1e39, NAN, -INFINITY};
+    float dst[4];
+    size_t fail = 0;
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_F32, src, FOSSIL_TYPE_KIND_F64, 4,
+                                        FOSSIL_TYPE_CONVERT_WRAP, NULL) == 0);
+    ASSUME_ITS_TRUE(isinf(dst[0]) && dst[0] > 0 && isinf(dst[1]) && dst[1] < 0);
+    ASSUME_ITS_TRUE(isnan(dst[2]) && isinf(dst[3]));
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_F32, src, FOSSIL_TYPE_KIND_F64, 4,
+                                        FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[0] == FLT_MAX && dst[1] == -FLT_MAX && isnan(dst[2]) && isinf(dst[3]));
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_F32, src + 2, FOSSIL_TYPE_KIND_F64, 2,
+                                        FOSSIL_TYPE_CONVERT_CHECKED, &fail) == 0);
+}
+
+// Test: a checked conversion stops at the first violation past the first chunk
+FOSSIL_TEST(c_test_convert_checked_stops) {
+    enum { N = 10000 };
+    static int32_t src[N];
+    static int16_t dst[N];
+    size_t fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        src[i] = (int32_t)i;
+        dst[i] = -1;
+    }
+    src[7000] = 40000;
+
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_I16, src, FOSSIL_TYPE_KIND_I32, N,
+                                        FOSSIL_TYPE_CONVERT_CHECKED, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == 7000);
+    ASSUME_ITS_TRUE(dst[6999] == 6999 && dst[7000] == -1 && dst[N - 1] == -1);
+}
+
+// Test: saturating kernels agree with a per-value clamp for every integer target
+FOSSIL_TEST(c_test_convert_matches_clamp) {
+    enum { N = 257 };
+    int64_t src[N], out[N];
+    uint64_t bytes[N];
+    uint32_t seed = 99u;
+
+    for (size_t i = 0; i < N; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        src[i] = (int64_t)(((uint64_t)seed << 32) | (seed * 2654435761u)) >> (seed % 63u);
+    }
+
+    for (int k = FOSSIL_TYPE_KIND_I8; k <= FOSSIL_TYPE_KIND_U32; k++) {
+        const fossil_type_limits *l = fossil_type_limits_get_by_kind((fossil_type_limits_kind)k);
+        int ok = 1;
+        ASSUME_ITS_TRUE(fossil_type_convert(bytes, (fossil_type_limits_kind)k, src, FOSSIL_TYPE_KIND_I64, N,
+                                            FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+        ASSUME_ITS_TRUE(fossil_type_convert(out, FOSSIL_TYPE_KIND_I64, bytes, (fossil_type_limits_kind)k, N,
+                                            FOSSIL_TYPE_CONVERT_WRAP, NULL) == 0);
+        for (size_t i = 0; i < N; i++) {
+            int64_t expect = src[i] < l->min_int ? l->min_int : src[i];
+            if (expect >= 0 && (uint64_t)expect > l->max_uint) expect = (int64_t)l->max_uint;
+            if (out[i] != expect) ok = 0;
+        }
+        ASSUME_ITS_TRUE(ok);
+    }
+}
+
+// Test: dispatch by type ID and rejected kinds
+FOSSIL_TEST(c_test_convert_dispatch) {
+    uint16_t src[3] = {1, 255, 256};
+    uint8_t dst[3];
+    size_t fail = 0;
+
+    ASSUME_ITS_TRUE(fossil_type_convert_id(dst, "u8", src, "h16", 3, FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[0] == 1 && dst[1] == 255 && dst[2] == 255);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(dst, "u8", src, "nope", 3, FOSSIL_TYPE_CONVERT_WRAP, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == FOSSIL_TYPE_RANGE_NPOS);
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_BOOL, src, FOSSIL_TYPE_KIND_U16, 3,
+                                        FOSSIL_TYPE_CONVERT_WRAP, NULL) == -1);
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_U8, src, FOSSIL_TYPE_KIND_CSTR, 3,
+                                        FOSSIL_TYPE_CONVERT_WRAP, NULL) == -1);
+    ASSUME_ITS_TRUE(fossil_type_convert(NULL, FOSSIL_TYPE_KIND_U8, src, FOSSIL_TYPE_KIND_U16, 3,
+                                        FOSSIL_TYPE_CONVERT_WRAP, NULL) == -1);
+    ASSUME_ITS_TRUE(fossil_type_convert(dst, FOSSIL_TYPE_KIND_U8, src, FOSSIL_TYPE_KIND_U16, 3,
+                                        (fossil_type_convert_policy)7, NULL) == -1);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_convert_tests) {
+    FOSSIL_ADD_TEST(c_convert_suite, c_test_convert_int_policies);
+    FOSSIL_ADD_TEST(c_convert_suite, c_test_convert_signedness);
+    FOSSIL_ADD_TEST(c_convert_suite, c_test_convert_float_to_int);
+    FOSSIL_ADD_TEST(c_convert_suite, c_test_convert_float_checked_fractions);
+    FOSSIL_ADD_TEST(c_convert_suite, c_test_convert_float_to_u64);
+    FOSSIL_ADD_TEST(c_convert_suite, c_test_convert_float_narrowing);
+    FOSSIL_ADD_TEST(c_convert_suite, c_test_convert_checked_stops);
+    FOSSIL_ADD_TEST(c_convert_suite, c_test_convert_matches_clamp);
+    FOSSIL_ADD_TEST(c_convert_suite, c_test_convert_dispatch);
+
+    FOSSIL_ADD_SUITE(c_convert_suite);
+}
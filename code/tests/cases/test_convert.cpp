@@ -0,0 +1,78 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_convert_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_convert_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_convert_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: convert picks both kinds from the element types
+FOSSIL_TEST(cpp_test_convert_template) {
+    std::vector<double> reals = {1.5, -2.5, 300.0};
+    std::vector<unsigned char> bytes(reals.size());
+    size_t fail = 0;
+
+    ASSUME_ITS_TRUE(fossil::type::convert(bytes.data(), reals.data(), reals.size(),
+                                          FOSSIL_TYPE_CONVERT_SATURATE) == 0);
+    ASSUME_ITS_TRUE(bytes[0] == 1 && bytes[1] == 0 && bytes[2] == 255);
+    ASSUME_ITS_TRUE(fossil::type::convert(bytes.data(), reals.data(), reals.size(),
+                                          FOSSIL_TYPE_CONVERT_CHECKED, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == 1);
+}
+
+// Test: native_kind maps fundamental types onto limits kinds
+FOSSIL_TEST(cpp_test_convert_native_kind) {
+    using fossil::type::native_kind;
+    static_assert(native_kind<int8_t>() == FOSSIL_TYPE_KIND_I8);
+    static_assert(native_kind<unsigned long long>() == FOSSIL_TYPE_KIND_U64);
+    static_assert(native_kind<float>() == FOSSIL_TYPE_KIND_F32);
+    ASSUME_ITS_TRUE(native_kind<short>() == FOSSIL_TYPE_KIND_I16);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_convert_tests) {
+    FOSSIL_ADD_TEST(cpp_convert_suite, cpp_test_convert_template);
+    FOSSIL_ADD_TEST(cpp_convert_suite, cpp_test_convert_native_kind);
+
+    FOSSIL_ADD_SUITE(cpp_convert_suite);
+}
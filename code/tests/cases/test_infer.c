@@ -0,0 +1,158 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_infer_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_infer_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_infer_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: i64 columns narrow to the smallest fitting integer type
+FOSSIL_TEST(c_test_infer_i64_ladder) {
+    int64_t small[3] = {0, 200, 255};
+    int64_t neg[3] = {-1, 5, 127};
+    int64_t mid[3] = {0, 40000, 65535};
+    int64_t wide[2] = {-1, 40000};
+    int64_t huge[2] = {INT64_MIN, 0};
+    fossil_type_infer_result r;
+
+    ASSUME_ITS_TRUE(fossil_type_infer_i64(small, 3, &r) == 0);
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_U8 && strcmp(r.type_id, "u8") == 0);
+    ASSUME_ITS_TRUE(r.min.i64 == 0 && r.max.i64 == 255 && r.integral);
+    ASSUME_ITS_TRUE(fossil_type_infer_i64(neg, 3, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_I8);
+    ASSUME_ITS_TRUE(fossil_type_infer_i64(mid, 3, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_U16);
+    ASSUME_ITS_TRUE(fossil_type_infer_i64(wide, 2, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_I32);
+    ASSUME_ITS_TRUE(fossil_type_infer_i64(huge, 2, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_I64);
+    ASSUME_ITS_TRUE(r.min.i64 == INT64_MIN);
+}
+
+// Test: u64 columns, including values past INT64_MAX
+FOSSIL_TEST(c_test_infer_u64) {
+    uint64_t top[3] = {UINT64_MAX, (uint64_t)INT64_MAX + 7, 9};
+    uint64_t small[300];
+    fossil_type_infer_result r;
+
+    for (size_t i = 0; i < 300; i++) small[i] = 1000 + i;
+    ASSUME_ITS_TRUE(fossil_type_infer_u64(top, 3, &r) == 0);
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_U64 && r.min.u64 == 9 && r.max.u64 == UINT64_MAX);
+    ASSUME_ITS_TRUE(fossil_type_infer_u64(small, 300, &r) == 0);
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_U16 && r.min.u64 == 1000 && r.max.u64 == 1299);
+}
+
+// Test: f64 columns narrow to integers, f32 or stay f64
+FOSSIL_TEST(c_test_infer_f64) {
+    double ints[5] = {1.0, -3.0, 100.0, 0.0, -128.0};
+    double halves[3] = {0.5, -2.25, 1e10};
+    double precise[2] = {0.1, 1.0};
+    double special[3] = {NAN, INFINITY, 1.5};
+    double big_int[2] = {16777216.0 * 64.0, 1.0};
+    double pow34[2] = {16777216.0 * 1024.0, 1.0};
+    fossil_type_infer_result r;
+
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(ints, 5, &r) == 0);
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_I8 && r.integral && r.min.f64 == -128.0);
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(halves, 3, &r) == 0);
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_F32 && !r.integral);
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(precise, 2, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_F64);
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(special, 3, &r) == 0);
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_F32 && r.min.f64 == 1.5 && isinf(r.max.f64));
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(special, 1, &r) == 0 && isnan(r.min.f64) && isnan(r.max.f64));
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(big_int, 2, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_U32);
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(pow34, 2, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_F32);
+}
+
+// Test: a long f64 column exercises the vector path and its tail
+FOSSIL_TEST(c_test_infer_f64_long) {
+    enum { N = 1027 };
+    static double col[N];
+    fossil_type_infer_result r;
+
+    for (size_t i = 0; i < N; i++) col[i] = (double)(i % 500);
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(col, N, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_U16);
+    col[N - 1] = 0.1;
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(col, N, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_F64);
+    col[N - 1] = 1e300;
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(col, N, &r) == 0 && r.kind == FOSSIL_TYPE_KIND_F64);
+    ASSUME_ITS_TRUE(r.max.f64 == 1e300 && r.integral);
+}
+
+// Test: the pool scan matches the serial scan
+FOSSIL_TEST(c_test_infer_par) {
+    size_t n = 3 * FOSSIL_TYPE_INFER_GRAIN + 17;
+    int64_t *col = (int64_t *)malloc(n * sizeof(int64_t));
+    tribool_pool pool;
+    fossil_type_infer_result serial, par;
+
+    ASSUME_ITS_TRUE(col != NULL);
+    for (size_t i = 0; i < n; i++) col[i] = (int64_t)(i * 7919u % 60000u);
+    col[2 * FOSSIL_TYPE_INFER_GRAIN + 5] = -40000;
+    ASSUME_ITS_TRUE(fossil_type_tribool_pool_init(&pool, 3) == 0);
+    ASSUME_ITS_TRUE(fossil_type_infer_i64(col, n, &serial) == 0);
+    ASSUME_ITS_TRUE(fossil_type_infer_i64_par(&pool, col, n, &par) == 0);
+    ASSUME_ITS_TRUE(serial.kind == FOSSIL_TYPE_KIND_I32 && par.kind == serial.kind);
+    ASSUME_ITS_TRUE(par.min.i64 == -40000 && par.max.i64 == serial.max.i64);
+    fossil_type_tribool_pool_free(&pool);
+    free(col);
+}
+
+// Test: empty columns and invalid arguments
+FOSSIL_TEST(c_test_infer_edges) {
+    fossil_type_infer_result r;
+
+    ASSUME_ITS_TRUE(fossil_type_infer_f64(NULL, 0, &r) == 0);
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_U8 && r.min.f64 == 0.0);
+    ASSUME_ITS_TRUE(fossil_type_infer_i64(NULL, 3, &r) == -1);
+    ASSUME_ITS_TRUE(fossil_type_infer_u64_par(NULL, NULL, 0, NULL) == -1);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_infer_tests) {
+    FOSSIL_ADD_TEST(c_infer_suite, c_test_infer_i64_ladder);
+    FOSSIL_ADD_TEST(c_infer_suite, c_test_infer_u64);
+    FOSSIL_ADD_TEST(c_infer_suite, c_test_infer_f64);
+    FOSSIL_ADD_TEST(c_infer_suite, c_test_infer_f64_long);
+    FOSSIL_ADD_TEST(c_infer_suite, c_test_infer_par);
+    FOSSIL_ADD_TEST(c_infer_suite, c_test_infer_edges);
+
+    FOSSIL_ADD_SUITE(c_infer_suite);
+}
@@ -0,0 +1,78 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_infer_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_infer_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_infer_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: infer deduces the scan from the element type
+FOSSIL_TEST(cpp_test_infer_span) {
+    std::vector<int64_t> ids = {3, 70000, 12};
+    std::vector<double> reals = {0.5, 2.0};
+
+    auto r = fossil::type::infer(std::span<const int64_t>(ids));
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_U32 && r.max.i64 == 70000);
+    r = fossil::type::infer(std::span<const double>(reals));
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_F32);
+}
+
+// Test: infer on a pool and a failed scan
+FOSSIL_TEST(cpp_test_infer_pool) {
+    fossil::type::TriboolPool pool(2);
+    std::vector<uint64_t> col(200000, 5);
+    col[150000] = 300;
+
+    auto r = fossil::type::infer(std::span<const uint64_t>(col), &pool);
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_U16 && r.min.u64 == 5 && r.max.u64 == 300);
+    r = fossil::type::infer(std::span<const uint64_t>(static_cast<const uint64_t *>(nullptr), 4));
+    ASSUME_ITS_TRUE(r.kind == FOSSIL_TYPE_KIND_COUNT && r.type_id == nullptr);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_infer_tests) {
+    FOSSIL_ADD_TEST(cpp_infer_suite, cpp_test_infer_span);
+    FOSSIL_ADD_TEST(cpp_infer_suite, cpp_test_infer_pool);
+
+    FOSSIL_ADD_SUITE(cpp_infer_suite);
+}
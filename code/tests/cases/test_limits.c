@@ -14,6 +14,7 @@
 #include <fossil/maip/framework.h>
 
 #include "fossil/type/framework.h"
+#include <float.h>
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Utilities
@@ -76,6 +77,80 @@ FOSSIL_TEST(c_test_limits_aliases) {
     }
 }
 
+// Test: every kind round-trips through its type ID
+FOSSIL_TEST(c_test_limits_kind_roundtrip) {
+    for (int k = 0; k < FOSSIL_TYPE_KIND_COUNT; ++k) {
+        const fossil_type_limits* by_kind = fossil_type_limits_get_by_kind((fossil_type_limits_kind)k);
+        ASSUME_ITS_TRUE(by_kind != NULL);
+        ASSUME_ITS_TRUE(fossil_type_limits_kind_of(by_kind->type_id) == (fossil_type_limits_kind)k);
+        ASSUME_ITS_TRUE(fossil_type_limits_get(by_kind->type_id) == by_kind);
+    }
+    ASSUME_ITS_TRUE(fossil_type_limits_get_by_kind(FOSSIL_TYPE_KIND_COUNT) == NULL);
+    ASSUME_ITS_TRUE(fossil_type_limits_get_by_kind(FOSSIL_TYPE_KIND_I16)->size == sizeof(int16_t));
+}
+
+// Test: near-miss IDs are rejected
+FOSSIL_TEST(c_test_limits_near_misses) {
+    const char* misses[] = {
+        "", "i", "i7", "i9", "i12", "i65", "f8", "f16", "x32", "I32",
+        "i32 ", "bools", "chr", "cstx", "chax", "tribooL", "tribools", "u640",
+    };
+
+    for (size_t i = 0; i < sizeof(misses)/sizeof(misses[0]); ++i) {
+        ASSUME_ITS_TRUE(fossil_type_limits_get(misses[i]) == NULL);
+        ASSUME_ITS_TRUE(fossil_type_limits_kind_of(misses[i]) == FOSSIL_TYPE_KIND_COUNT);
+    }
+    ASSUME_ITS_TRUE(fossil_type_limits_kind_of(NULL) == FOSSIL_TYPE_KIND_COUNT);
+}
+
+// Test: exact bounds hold the full 64-bit extremes
+FOSSIL_TEST(c_test_limits_exact_bounds) {
+    const fossil_type_limits* u64 = fossil_type_limits_get("u64");
+    const fossil_type_limits* i64 = fossil_type_limits_get("i64");
+    const fossil_type_limits* tri = fossil_type_limits_get("tribool");
+
+    ASSUME_ITS_TRUE(u64->max_uint == UINT64_MAX && u64->min_int == 0);
+    ASSUME_ITS_TRUE(i64->min_int == INT64_MIN && i64->max_uint == (uint64_t)INT64_MAX);
+    ASSUME_ITS_TRUE(i64->flags == (FOSSIL_TYPE_LIMITS_INTEGER | FOSSIL_TYPE_LIMITS_SIGNED));
+    ASSUME_ITS_TRUE(tri->flags & FOSSIL_TYPE_LIMITS_LOGIC);
+    ASSUME_ITS_TRUE(fossil_type_limits_get("f64")->flags == FOSSIL_TYPE_LIMITS_FLOAT);
+    ASSUME_ITS_TRUE(fossil_type_limits_get("cstr")->flags == FOSSIL_TYPE_LIMITS_VARIABLE);
+}
+
+// Test: fossil_type_fits_* at the edges of each range
+FOSSIL_TEST(c_test_limits_fits) {
+    ASSUME_ITS_TRUE(fossil_type_fits_i64(FOSSIL_TYPE_KIND_I8, -128));
+    ASSUME_ITS_FALSE(fossil_type_fits_i64(FOSSIL_TYPE_KIND_I8, -129));
+    ASSUME_ITS_FALSE(fossil_type_fits_i64(FOSSIL_TYPE_KIND_I8, 128));
+    ASSUME_ITS_FALSE(fossil_type_fits_i64(FOSSIL_TYPE_KIND_U32, -1));
+    ASSUME_ITS_TRUE(fossil_type_fits_i64(FOSSIL_TYPE_KIND_H32, 0xFFFFFFFFLL));
+    ASSUME_ITS_FALSE(fossil_type_fits_u64(FOSSIL_TYPE_KIND_B32, 0x100000000ULL));
+    ASSUME_ITS_TRUE(fossil_type_fits_u64(FOSSIL_TYPE_KIND_U64, UINT64_MAX));
+    ASSUME_ITS_FALSE(fossil_type_fits_u64(FOSSIL_TYPE_KIND_I64, (uint64_t)INT64_MAX + 1));
+    ASSUME_ITS_TRUE(fossil_type_fits_u64(FOSSIL_TYPE_KIND_I64, (uint64_t)INT64_MAX));
+    ASSUME_ITS_TRUE(fossil_type_fits_i64(FOSSIL_TYPE_KIND_TRIBOOL, 2));
+    ASSUME_ITS_FALSE(fossil_type_fits_i64(FOSSIL_TYPE_KIND_BOOL, 2));
+    ASSUME_ITS_TRUE(fossil_type_fits_i64(FOSSIL_TYPE_KIND_F32, INT64_MIN));
+    ASSUME_ITS_FALSE(fossil_type_fits_i64(FOSSIL_TYPE_KIND_CSTR, 0));
+    ASSUME_ITS_FALSE(fossil_type_fits_u64(FOSSIL_TYPE_KIND_COUNT, 0));
+    ASSUME_ITS_FALSE(fossil_type_limits_fits_i64(NULL, 0));
+}
+
+// Test: f32/f64 records describe the finite value range in every field
+FOSSIL_TEST(c_test_limits_float_range) {
+    const fossil_type_limits* f32 = fossil_type_limits_get("f32");
+    const fossil_type_limits* f64 = fossil_type_limits_get("f64");
+
+    ASSUME_ITS_TRUE(f32->max_value == (long double)FLT_MAX && f32->min_value == -(long double)FLT_MAX);
+    ASSUME_ITS_TRUE(f64->max_value == (long double)DBL_MAX && f64->min_value == -(long double)DBL_MAX);
+    ASSUME_ITS_TRUE(f32->min_int == INT64_MIN && f32->max_uint == UINT64_MAX);
+    ASSUME_ITS_TRUE(fossil_type_limits_fits_i64(f32, INT64_MIN));
+    ASSUME_ITS_TRUE(fossil_type_limits_fits_i64(f32, (int64_t)1 << 40));
+    ASSUME_ITS_TRUE(fossil_type_limits_fits_u64(f32, UINT64_MAX));
+    ASSUME_ITS_TRUE(fossil_type_limits_fits_i64(f64, INT64_MAX));
+    ASSUME_ITS_TRUE(fossil_type_limits_fits_u64(f64, UINT64_MAX));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -83,6 +158,11 @@ FOSSIL_TEST_GROUP(c_limits_tests) {
     FOSSIL_ADD_TEST(c_limits_suite, c_test_limits_unknown_type);
     FOSSIL_ADD_TEST(c_limits_suite, c_test_limits_null_input);
     FOSSIL_ADD_TEST(c_limits_suite, c_test_limits_aliases);
+    FOSSIL_ADD_TEST(c_limits_suite, c_test_limits_kind_roundtrip);
+    FOSSIL_ADD_TEST(c_limits_suite, c_test_limits_near_misses);
+    FOSSIL_ADD_TEST(c_limits_suite, c_test_limits_exact_bounds);
+    FOSSIL_ADD_TEST(c_limits_suite, c_test_limits_fits);
+    FOSSIL_ADD_TEST(c_limits_suite, c_test_limits_float_range);
 
     FOSSIL_ADD_SUITE(c_limits_suite);
 }
@@ -94,6 +94,88 @@ FOSSIL_TEST(cpp_test_limits_class_scoped_usage) {
     ASSUME_ITS_TRUE(sz == sizeof(int16_t));
 }
 
+static size_t limits_size_of(const fossil::type::Limits& lim) {
+    return lim.size();
+}
+
+// Test: Limits is a plain class that can be named as a parameter type
+FOSSIL_TEST(cpp_test_limits_class_as_parameter) {
+    fossil::type::Limits lim("u32");
+    ASSUME_ITS_TRUE(limits_size_of(lim) == sizeof(uint32_t));
+    ASSUME_ITS_TRUE(limits_size_of(fossil::type::Limits("cstr")) == sizeof(char*));
+}
+
+// Test: Limits class built from a kind matches the string lookup
+FOSSIL_TEST(cpp_test_limits_class_by_kind) {
+    fossil::type::Limits by_kind(FOSSIL_TYPE_KIND_U32);
+    fossil::type::Limits by_id("u32");
+    fossil::type::Limits bad(FOSSIL_TYPE_KIND_COUNT);
+
+    ASSUME_ITS_TRUE(by_kind.valid());
+    ASSUME_ITS_TRUE(by_kind.max() == by_id.max());
+    ASSUME_ITS_TRUE(by_kind.size() == sizeof(uint32_t));
+    ASSUME_ITS_FALSE(bad.valid());
+    ASSUME_ITS_TRUE(bad.size() == 0);
+}
+
+// Test: TypeLimits<T> bounds are constant expressions of the native type
+FOSSIL_TEST(cpp_test_limits_template_constexpr) {
+    using namespace fossil::type;
+    static_assert(TypeLimits<I8>::min() == -128 && TypeLimits<I8>::max() == 127);
+    static_assert(TypeLimits<U64>::max() == UINT64_MAX);
+    static_assert(TypeLimits<I64>::min() == INT64_MIN);
+    static_assert(std::is_same_v<TypeLimits<H16>::value_type, uint16_t>);
+    static_assert(TypeLimits<B32>::size() == 4);
+
+    ASSUME_ITS_TRUE(TypeLimits<I16>::max() == Limits("i16").max());
+    ASSUME_ITS_TRUE(TypeLimits<U8>::size() == Limits(FOSSIL_TYPE_KIND_U8).size());
+}
+
+// Test: TypeLimits<T>::contains compares across signedness and width exactly
+FOSSIL_TEST(cpp_test_limits_template_contains) {
+    using namespace fossil::type;
+    static_assert(TypeLimits<U8>::contains(255) && !TypeLimits<U8>::contains(256));
+    static_assert(!TypeLimits<U32>::contains(-1));
+    static_assert(TypeLimits<I64>::contains(INT64_MIN));
+    static_assert(!TypeLimits<I64>::contains(UINT64_MAX));
+    static_assert(TypeLimits<U64>::contains(UINT64_MAX));
+    static_assert(!TypeLimits<I8>::contains(INT64_MIN));
+
+    ASSUME_ITS_TRUE(TypeLimits<I32>::contains(2147483647.0));
+    ASSUME_ITS_FALSE(TypeLimits<I32>::contains(2147483648.0));
+    ASSUME_ITS_FALSE(TypeLimits<U64>::contains(18446744073709551616.0));
+    ASSUME_ITS_FALSE(TypeLimits<F32>::contains(1e39));
+    ASSUME_ITS_FALSE(TypeLimits<F64>::contains(std::numeric_limits<double>::quiet_NaN()));
+}
+
+// Test: TypeTraits describe every wrapper type
+FOSSIL_TEST(cpp_test_limits_type_traits) {
+    using namespace fossil::type;
+    static_assert(TypeTraits<H16>::kind == FOSSIL_TYPE_KIND_H16);
+    static_assert(TypeTraits<I32>::is_signed && TypeTraits<I32>::is_integer);
+    static_assert(!TypeTraits<U32>::is_signed);
+    static_assert(TypeTraits<F64>::is_floating && TypeTraits<F64>::alignment == alignof(double));
+    static_assert(TypeTraits<Ptr>::id == nullptr && TypeTraits<Ptr>::kind == FOSSIL_TYPE_KIND_COUNT);
+
+    ASSUME_ITS_TRUE(strcmp(TypeTraits<H16>::id, "h16") == 0);
+    ASSUME_ITS_TRUE(fossil_type_limits_get(TypeTraits<O64>::id) ==
+                    fossil_type_limits_get_by_kind(TypeTraits<O64>::kind));
+    ASSUME_ITS_TRUE(TypeTraits<Cstr>::size == sizeof(char *));
+}
+
+// Test: Limits::fits picks the exact check from the argument's signedness
+FOSSIL_TEST(cpp_test_limits_class_fits) {
+    fossil::type::Limits u16("u16");
+    fossil::type::Limits none("nope");
+
+    ASSUME_ITS_TRUE(u16.fits(65535));
+    ASSUME_ITS_FALSE(u16.fits(65536));
+    ASSUME_ITS_FALSE(u16.fits(-1));
+    ASSUME_ITS_FALSE(u16.fits(UINT64_MAX));
+    ASSUME_ITS_TRUE(u16.flags() == FOSSIL_TYPE_LIMITS_INTEGER);
+    ASSUME_ITS_FALSE(none.fits(0));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -102,6 +184,12 @@ FOSSIL_TEST_GROUP(cpp_limits_tests) {
     FOSSIL_ADD_TEST(cpp_limits_suite, cpp_test_limits_class_null_input);
     FOSSIL_ADD_TEST(cpp_limits_suite, cpp_test_limits_class_aliases);
     FOSSIL_ADD_TEST(cpp_limits_suite, cpp_test_limits_class_scoped_usage);
+    FOSSIL_ADD_TEST(cpp_limits_suite, cpp_test_limits_class_as_parameter);
+    FOSSIL_ADD_TEST(cpp_limits_suite, cpp_test_limits_class_by_kind);
+    FOSSIL_ADD_TEST(cpp_limits_suite, cpp_test_limits_template_constexpr);
+    FOSSIL_ADD_TEST(cpp_limits_suite, cpp_test_limits_template_contains);
+    FOSSIL_ADD_TEST(cpp_limits_suite, cpp_test_limits_type_traits);
+    FOSSIL_ADD_TEST(cpp_limits_suite, cpp_test_limits_class_fits);
 
     FOSSIL_ADD_SUITE(cpp_limits_suite);
 }
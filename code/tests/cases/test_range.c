@@ -0,0 +1,199 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <math.h>
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_range_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_range_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_range_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: i64 values checked against i16 across full blocks and a tail
+FOSSIL_TEST(c_test_range_i64_to_i16) {
+    int64_t src[200];
+    uint64_t bitmap[FOSSIL_TYPE_RANGE_BITMAP_WORDS(200)];
+    fossil_type_range_result r;
+
+    for (size_t i = 0; i < 200; i++) src[i] = (int64_t)i - 100;
+    src[70] = 32768;
+    src[130] = -32769;
+    src[199] = INT64_MIN;
+    src[5] = 32767;
+
+    ASSUME_ITS_TRUE(fossil_type_range_check_i64(src, 200, FOSSIL_TYPE_KIND_I16, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(r.violations == 3);
+    ASSUME_ITS_TRUE(r.first == 70);
+    ASSUME_ITS_TRUE(bitmap[1] == (1ULL << 6) && bitmap[2] == (1ULL << 2));
+    ASSUME_ITS_TRUE(bitmap[3] == (1ULL << 7) && bitmap[0] == 0);
+}
+
+// Test: unsigned and signed sources across the sign boundary
+FOSSIL_TEST(c_test_range_signedness) {
+    uint8_t u8s[3] = {0, 127, 128};
+    int8_t i8s[3] = {-1, 0, 127};
+    uint64_t u64s[3] = {0, (uint64_t)INT64_MAX, (uint64_t)INT64_MAX + 1};
+    fossil_type_range_result r;
+
+    ASSUME_ITS_TRUE(fossil_type_range_check_u8(u8s, 3, FOSSIL_TYPE_KIND_I8, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 1 && r.first == 2);
+    ASSUME_ITS_TRUE(fossil_type_range_check_i8(i8s, 3, FOSSIL_TYPE_KIND_U64, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 1 && r.first == 0);
+    ASSUME_ITS_TRUE(fossil_type_range_check_u64(u64s, 3, FOSSIL_TYPE_KIND_I64, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 1 && r.first == 2);
+    ASSUME_ITS_TRUE(fossil_type_range_check_u64(u64s, 3, FOSSIL_TYPE_KIND_H64, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 0 && r.first == FOSSIL_TYPE_RANGE_NPOS);
+}
+
+// Test: float sources reject NaN and out-of-range values for integer targets
+FOSSIL_TEST(c_test_range_float_sources) {
+    double d[6] = {2147483647.0, -2147483648.0, 2147483648.0, NAN, INFINITY, -0.5};
+    double big[4] = {1e39, -1e39, INFINITY, NAN};
+    float f[3] = {255.0f, 256.0f, -1.0f};
+    double below_i8 = -128.5;
+    fossil_type_range_result r;
+    uint64_t bitmap[1];
+
+    ASSUME_ITS_TRUE(fossil_type_range_check_f64(d, 6, FOSSIL_TYPE_KIND_I32, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(r.violations == 3 && r.first == 2);
+    ASSUME_ITS_TRUE(bitmap[0] == 0x1Cu);
+    ASSUME_ITS_TRUE(fossil_type_range_check_f64(big, 4, FOSSIL_TYPE_KIND_F32, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(r.violations == 2 && bitmap[0] == 0x3u);
+    ASSUME_ITS_TRUE(fossil_type_range_check_f64(big, 4, FOSSIL_TYPE_KIND_F64, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 0);
+    ASSUME_ITS_TRUE(fossil_type_range_check_f32(f, 3, FOSSIL_TYPE_KIND_U8, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 2 && r.first == 1);
+    ASSUME_ITS_TRUE(fossil_type_range_check_f64(d + 5, 1, FOSSIL_TYPE_KIND_U8, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 0);
+    ASSUME_ITS_TRUE(fossil_type_range_check_f64(&below_i8, 1, FOSSIL_TYPE_KIND_I8, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 0);
+}
+
+// Test: float sources fit exactly when they truncate into the target range
+FOSSIL_TEST(c_test_range_float_truncation) {
+    static const double u8_cycle[8] = {-0.5, 255.5, -0.999, 255.999, -1.0, 256.0, 0.0, 128.0};
+    static const double i8_cycle[8] = {-128.5, 127.5, -128.999, 127.999, -129.0, 128.0, -1.5, 0.5};
+    double d[64];
+    float f[64];
+    fossil_type_range_result r;
+    uint64_t bitmap[1];
+    const uint64_t expect = 0x3030303030303030ULL;
+
+    // Full blocks go through the vector kernels, short tails through the scalar ones
+    for (size_t i = 0; i < 64; i++) {
+        d[i] = u8_cycle[i % 8];
+        f[i] = (float)u8_cycle[i % 8];
+    }
+    ASSUME_ITS_TRUE(fossil_type_range_check_f64(d, 64, FOSSIL_TYPE_KIND_U8, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(bitmap[0] == expect && r.violations == 16 && r.first == 4);
+    ASSUME_ITS_TRUE(fossil_type_range_check_f64(d, 8, FOSSIL_TYPE_KIND_U8, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(bitmap[0] == 0x30u);
+    ASSUME_ITS_TRUE(fossil_type_range_check_f32(f, 64, FOSSIL_TYPE_KIND_U8, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(bitmap[0] == expect);
+
+    for (size_t i = 0; i < 64; i++) {
+        d[i] = i8_cycle[i % 8];
+        f[i] = (float)i8_cycle[i % 8];
+    }
+    ASSUME_ITS_TRUE(fossil_type_range_check_f64(d, 64, FOSSIL_TYPE_KIND_I8, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(bitmap[0] == expect);
+    ASSUME_ITS_TRUE(fossil_type_range_check_f64(d, 8, FOSSIL_TYPE_KIND_I8, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(bitmap[0] == 0x30u);
+    ASSUME_ITS_TRUE(fossil_type_range_check_f32(f, 64, FOSSIL_TYPE_KIND_I8, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(bitmap[0] == expect);
+}
+
+// Test: the kernels agree with the per-value fits check for every target
+FOSSIL_TEST(c_test_range_matches_fits) {
+    enum { N = 301 };
+    int32_t i32s[N];
+    uint16_t u16s[N];
+    uint64_t bitmap[FOSSIL_TYPE_RANGE_BITMAP_WORDS(N)];
+    fossil_type_range_result r;
+    uint32_t seed = 12345u;
+
+    for (size_t i = 0; i < N; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        i32s[i] = (int32_t)seed >> (seed % 31u);
+        u16s[i] = (uint16_t)(seed >> (seed % 17u));
+    }
+
+    for (int k = 0; k < FOSSIL_TYPE_KIND_CSTR; k++) {
+        size_t expect = 0, expect_u = 0, first = FOSSIL_TYPE_RANGE_NPOS;
+        int bits_ok = 1;
+        ASSUME_ITS_TRUE(fossil_type_range_check_i32(i32s, N, (fossil_type_limits_kind)k, &r, bitmap) == 0);
+        for (size_t i = 0; i < N; i++) {
+            int bad = !fossil_type_fits_i64((fossil_type_limits_kind)k, i32s[i]);
+            if (bad && first == FOSSIL_TYPE_RANGE_NPOS) first = i;
+            expect += (size_t)bad;
+            if (((bitmap[i / 64] >> (i % 64)) & 1u) != (uint64_t)bad) bits_ok = 0;
+        }
+        ASSUME_ITS_TRUE(r.violations == expect && r.first == first && bits_ok);
+
+        ASSUME_ITS_TRUE(fossil_type_range_check_u16(u16s, N, (fossil_type_limits_kind)k, &r, NULL) == 0);
+        for (size_t i = 0; i < N; i++) expect_u += (size_t)!fossil_type_fits_u64((fossil_type_limits_kind)k, u16s[i]);
+        ASSUME_ITS_TRUE(r.violations == expect_u);
+    }
+}
+
+// Test: dynamic dispatch by source kind and argument validation
+FOSSIL_TEST(c_test_range_dispatch) {
+    uint16_t h16s[4] = {1, 255, 256, 0xFFFF};
+    fossil_type_range_result r;
+
+    ASSUME_ITS_TRUE(fossil_type_range_check(h16s, FOSSIL_TYPE_KIND_H16, 4, FOSSIL_TYPE_KIND_U8, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 2 && r.first == 2);
+    ASSUME_ITS_TRUE(fossil_type_range_check(h16s, FOSSIL_TYPE_KIND_CSTR, 4, FOSSIL_TYPE_KIND_U8, &r, NULL) == -1);
+    ASSUME_ITS_TRUE(fossil_type_range_check(h16s, FOSSIL_TYPE_KIND_U16, 4, FOSSIL_TYPE_KIND_CSTR, &r, NULL) == -1);
+    ASSUME_ITS_TRUE(fossil_type_range_check_u16(NULL, 4, FOSSIL_TYPE_KIND_U8, &r, NULL) == -1);
+    ASSUME_ITS_TRUE(fossil_type_range_check_u16(NULL, 0, FOSSIL_TYPE_KIND_U8, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 0 && r.first == FOSSIL_TYPE_RANGE_NPOS);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_range_tests) {
+    FOSSIL_ADD_TEST(c_range_suite, c_test_range_i64_to_i16);
+    FOSSIL_ADD_TEST(c_range_suite, c_test_range_signedness);
+    FOSSIL_ADD_TEST(c_range_suite, c_test_range_float_sources);
+    FOSSIL_ADD_TEST(c_range_suite, c_test_range_float_truncation);
+    FOSSIL_ADD_TEST(c_range_suite, c_test_range_matches_fits);
+    FOSSIL_ADD_TEST(c_range_suite, c_test_range_dispatch);
+
+    FOSSIL_ADD_SUITE(c_range_suite);
+}
@@ -0,0 +1,82 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_range_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_range_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_range_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: range_check picks the kernel from the element type
+FOSSIL_TEST(cpp_test_range_check_template) {
+    std::vector<long long> wide = {0, 40000, -5, 70000};
+    std::vector<unsigned short> narrow = {1, 300};
+    std::vector<uint64_t> bitmap(FOSSIL_TYPE_RANGE_BITMAP_WORDS(wide.size()));
+    fossil_type_range_result r;
+
+    ASSUME_ITS_TRUE(fossil::type::range_check(wide.data(), wide.size(), FOSSIL_TYPE_KIND_U16, &r, bitmap.data()) == 0);
+    ASSUME_ITS_TRUE(r.violations == 2 && r.first == 2);
+    ASSUME_ITS_TRUE(bitmap[0] == 0xCu);
+    ASSUME_ITS_TRUE(fossil::type::range_check(narrow.data(), narrow.size(), FOSSIL_TYPE_KIND_I8, &r) == 0);
+    ASSUME_ITS_TRUE(r.violations == 1 && r.first == 1);
+}
+
+// Test: all_fit checks against a wrapper type's traits
+FOSSIL_TEST(cpp_test_range_all_fit) {
+    using namespace fossil::type;
+    std::vector<int> small = {-100, 0, 100};
+    std::vector<double> reals = {0.5, 1e10};
+
+    ASSUME_ITS_TRUE(all_fit<I8>(small.data(), small.size()));
+    ASSUME_ITS_FALSE(all_fit<U8>(small.data(), small.size()));
+    ASSUME_ITS_TRUE(all_fit<I64>(reals.data(), reals.size()));
+    ASSUME_ITS_FALSE(all_fit<I32>(reals.data(), reals.size()));
+    ASSUME_ITS_FALSE(all_fit<Cstr>(small.data(), small.size()));
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_range_tests) {
+    FOSSIL_ADD_TEST(cpp_range_suite, cpp_test_range_check_template);
+    FOSSIL_ADD_TEST(cpp_range_suite, cpp_test_range_all_fit);
+
+    FOSSIL_ADD_SUITE(cpp_range_suite);
+}
@@ -0,0 +1,295 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_registry_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_registry_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_registry_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: registered types resolve through the limits lookups
+FOSSIL_TEST(c_test_registry_lookup) {
+    fossil_type_registration regs[2] = {
+        {"q16_16", FOSSIL_TYPE_KIND_I32, INT32_MIN, INT32_MAX, 0, 0},
+        {"color", FOSSIL_TYPE_KIND_U8, 0, 3, 0, 0},
+    };
+    ASSUME_ITS_TRUE(fossil_type_registry_add_many(regs, 2) == 0);
+    ASSUME_ITS_TRUE(fossil_type_registry_count() == 2);
+    ASSUME_ITS_TRUE(strcmp(fossil_type_registry_at(1)->limits.type_id, "color") == 0);
+    ASSUME_ITS_TRUE(fossil_type_registry_at(2) == NULL);
+
+    const fossil_type_info *info = fossil_type_registry_find("color");
+    ASSUME_ITS_TRUE(info != NULL && info->kind == FOSSIL_TYPE_KIND_U8);
+    ASSUME_ITS_TRUE(info->alignment == 1 && info->limits.size == 1);
+    ASSUME_ITS_TRUE(fossil_type_registry_find("i32") == NULL);
+    ASSUME_ITS_TRUE(fossil_type_registry_find("colour") == NULL);
+
+    const fossil_type_limits *l = fossil_type_limits_get("color");
+    ASSUME_ITS_TRUE(l == &info->limits && l->max_uint == 3);
+    ASSUME_ITS_TRUE(fossil_type_limits_fits_u64(l, 3) && !fossil_type_limits_fits_u64(l, 4));
+    ASSUME_ITS_TRUE(!fossil_type_limits_fits_i64(l, -1));
+    ASSUME_ITS_TRUE(fossil_type_limits_kind_of("q16_16") == FOSSIL_TYPE_KIND_I32);
+    ASSUME_ITS_TRUE(fossil_type_limits_get("q16_16")->min_int == INT32_MIN);
+    ASSUME_ITS_TRUE(fossil_type_limits_get("i32") == fossil_type_limits_get_by_kind(FOSSIL_TYPE_KIND_I32));
+    fossil_type_registry_reset();
+    ASSUME_ITS_TRUE(fossil_type_registry_count() == 0 && fossil_type_limits_get("color") == NULL);
+}
+
+// Test: type-ID entry points dispatch registered IDs to their storage kind
+FOSSIL_TEST(c_test_registry_dispatch) {
+    fossil_type_registration reg = {"order_id", FOSSIL_TYPE_KIND_U64, 0, UINT64_MAX, 0, 0};
+    uint32_t src[3] = {7, 8, 9};
+    uint64_t dst[3] = {0, 0, 0};
+    fossil_type_bitpack p;
+
+    ASSUME_ITS_TRUE(fossil_type_registry_add(&reg) == 0);
+    ASSUME_ITS_TRUE(fossil_type_limits_get("order_id")->max_uint == UINT64_MAX);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(dst, "order_id", src, "u32", 3, FOSSIL_TYPE_CONVERT_CHECKED, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[2] == 9);
+    fossil_type_bitpack_init(&p);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode_id(&p, dst, "order_id", 3, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.kind == FOSSIL_TYPE_KIND_U64 && p.blocks[0].width == 2);
+    fossil_type_bitpack_free(&p);
+
+    /* A size the dispatchers would ignore is never published. */
+    fossil_type_registration padded = {"padded_id", FOSSIL_TYPE_KIND_U32, 0, 9, 8, 0};
+    uint32_t narrow[3] = {0, 0, 0};
+    ASSUME_ITS_TRUE(fossil_type_registry_add(&padded) == -1);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(narrow, "padded_id", src, "u32", 3, FOSSIL_TYPE_CONVERT_WRAP, NULL) == -1);
+    padded.size = sizeof(uint32_t);
+    ASSUME_ITS_TRUE(fossil_type_registry_add(&padded) == 0);
+    ASSUME_ITS_TRUE(fossil_type_limits_get("padded_id")->size == sizeof(uint32_t));
+    ASSUME_ITS_TRUE(fossil_type_convert_id(narrow, "padded_id", src, "u32", 3, FOSSIL_TYPE_CONVERT_CHECKED, NULL) == 0);
+    ASSUME_ITS_TRUE(narrow[2] == 9);
+    fossil_type_registry_reset();
+}
+
+// Test: type-ID entry points hold values to a registered type's own bounds
+FOSSIL_TEST(c_test_registry_enforced) {
+    fossil_type_registration regs[2] = {
+        {"percent", FOSSIL_TYPE_KIND_U8, 0, 100, 0, 0},
+        {"port", FOSSIL_TYPE_KIND_U16, 1, 65535, 0, 0},
+    };
+    uint32_t src[3] = {50, 200, 255};
+    int32_t signed_src[3] = {-7, 0, 80};
+    double fsrc[4] = {-3.0, 100.9, 1e9, NAN};
+    uint8_t dst[4] = {0, 0, 0, 0};
+    uint16_t ports[3] = {9, 9, 9};
+    size_t fail = 0;
+    fossil_type_bitpack p;
+
+    ASSUME_ITS_TRUE(fossil_type_registry_add_many(regs, 2) == 0);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(dst, "percent", src, "u32", 3, FOSSIL_TYPE_CONVERT_CHECKED, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == 1 && dst[0] == 50 && dst[1] == 0);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(dst, "percent", src, "u32", 3, FOSSIL_TYPE_CONVERT_SATURATE, &fail) == 0);
+    ASSUME_ITS_TRUE(fail == FOSSIL_TYPE_RANGE_NPOS && dst[0] == 50 && dst[1] == 100 && dst[2] == 100);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(dst, "percent", src, "u32", 3, FOSSIL_TYPE_CONVERT_WRAP, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[1] == 200 && dst[2] == 255);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(dst, "percent", fsrc, "f64", 4, FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(dst[0] == 0 && dst[1] == 100 && dst[2] == 100 && dst[3] == 0);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(dst, "percent", fsrc + 1, "f64", 2, FOSSIL_TYPE_CONVERT_CHECKED, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == 1 && dst[0] == 100);
+
+    ASSUME_ITS_TRUE(fossil_type_convert_id(ports, "port", signed_src, "i32", 3, FOSSIL_TYPE_CONVERT_CHECKED, &fail) == -1);
+    ASSUME_ITS_TRUE(fail == 0 && ports[0] == 9);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(ports, "port", signed_src, "i32", 3, FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(ports[0] == 1 && ports[1] == 1 && ports[2] == 80);
+
+    fossil_type_bitpack_init(&p);
+    dst[0] = 50;
+    dst[1] = 100;
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode_id(&p, dst, "percent", 2, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    ASSUME_ITS_TRUE(p.kind == FOSSIL_TYPE_KIND_U8 && p.count == 2);
+    dst[1] = 101;
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode_id(&p, dst, "percent", 2, FOSSIL_TYPE_BITPACK_BLOCK) == -1);
+    ASSUME_ITS_TRUE(p.count == 2);
+    ASSUME_ITS_TRUE(fossil_type_bitpack_encode_id(&p, dst, "u8", 2, FOSSIL_TYPE_BITPACK_BLOCK) == 0);
+    fossil_type_bitpack_free(&p);
+    fossil_type_registry_reset();
+}
+
+// Test: range checks against registered bounds the source cannot reach or round to
+FOSSIL_TEST(c_test_registry_range_limits) {
+    fossil_type_registration regs[3] = {
+        {"high", FOSSIL_TYPE_KIND_U16, 300, 400, 0, 0},
+        {"above_2_24", FOSSIL_TYPE_KIND_U32, 16777217, UINT32_MAX, 0, 0},
+        {"to_2_24", FOSSIL_TYPE_KIND_U32, 0, 16777216, 0, 0},
+    };
+    uint8_t bytes[70];
+    int8_t small[2] = {-1, 127};
+    float near[2] = {16777216.0f, 16777218.0f};
+    uint16_t out[70];
+    uint64_t bitmap[2] = {0, 0};
+    fossil_type_range_result r;
+
+    for (size_t i = 0; i < 70; i++) bytes[i] = (uint8_t)(i * 3);
+    ASSUME_ITS_TRUE(fossil_type_registry_add_many(regs, 3) == 0);
+    const fossil_type_limits *high = fossil_type_limits_get("high");
+    ASSUME_ITS_TRUE(fossil_type_range_check_limits(bytes, FOSSIL_TYPE_KIND_U8, 70, high, &r, bitmap) == 0);
+    ASSUME_ITS_TRUE(r.violations == 70 && r.first == 0);
+    ASSUME_ITS_TRUE(bitmap[0] == UINT64_MAX && bitmap[1] == 0x3Fu);
+    ASSUME_ITS_TRUE(fossil_type_range_check_limits(small, FOSSIL_TYPE_KIND_I8, 2, high, &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 2);
+    ASSUME_ITS_TRUE(fossil_type_convert_id(out, "high", bytes, "u8", 70, FOSSIL_TYPE_CONVERT_SATURATE, NULL) == 0);
+    ASSUME_ITS_TRUE(out[0] == 300 && out[69] == 300);
+
+    ASSUME_ITS_TRUE(fossil_type_range_check_limits(near, FOSSIL_TYPE_KIND_F32, 2, fossil_type_limits_get("above_2_24"), &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 1 && r.first == 0);
+    ASSUME_ITS_TRUE(fossil_type_range_check_limits(near, FOSSIL_TYPE_KIND_F32, 2, fossil_type_limits_get("to_2_24"), &r, NULL) == 0);
+    ASSUME_ITS_TRUE(r.violations == 1 && r.first == 1);
+    ASSUME_ITS_TRUE(fossil_type_range_check_limits(near, FOSSIL_TYPE_KIND_F32, 2, NULL, &r, NULL) == -1);
+    fossil_type_registry_reset();
+}
+
+// Test: bounds, sizes and alignment derived from the description
+FOSSIL_TEST(c_test_registry_bounds) {
+    fossil_type_registration port = {"port", FOSSIL_TYPE_KIND_U16, 1, 65535, 0, 0};
+    fossil_type_registration wide = {"small_i32", FOSSIL_TYPE_KIND_I32, -10, 10, 4, 2};
+
+    ASSUME_ITS_TRUE(fossil_type_registry_add(&port) == 0);
+    ASSUME_ITS_TRUE(fossil_type_registry_add(&wide) == 0);
+
+    const fossil_type_limits *l = fossil_type_limits_get("port");
+    ASSUME_ITS_TRUE(l->min_int == 1 && l->max_uint == 65535);
+    ASSUME_ITS_TRUE(!fossil_type_limits_fits_u64(l, 0) && !fossil_type_limits_fits_i64(l, 0));
+    ASSUME_ITS_TRUE(fossil_type_limits_fits_u64(l, 1) && fossil_type_limits_fits_i64(l, 65535));
+
+    ASSUME_ITS_TRUE(l->min_value == 1 && l->max_value == 65535);
+
+    fossil_type_registration top = {"upper_half", FOSSIL_TYPE_KIND_U64, INT64_MAX, UINT64_MAX, 0, 0};
+    ASSUME_ITS_TRUE(fossil_type_registry_add(&top) == 0);
+    l = fossil_type_limits_get("upper_half");
+    ASSUME_ITS_TRUE(fossil_type_limits_fits_u64(l, UINT64_MAX) && fossil_type_limits_fits_u64(l, INT64_MAX));
+    ASSUME_ITS_TRUE(!fossil_type_limits_fits_u64(l, (uint64_t)INT64_MAX - 1) && !fossil_type_limits_fits_i64(l, -1));
+
+    const fossil_type_info *info = fossil_type_registry_find("small_i32");
+    ASSUME_ITS_TRUE(info->limits.size == 4 && info->alignment == 2);
+    ASSUME_ITS_TRUE(info->limits.min_int == -10 && (info->limits.flags & FOSSIL_TYPE_LIMITS_SIGNED));
+    fossil_type_registry_reset();
+}
+
+// Test: invalid or conflicting descriptions are rejected as a whole
+FOSSIL_TEST(c_test_registry_rejects) {
+    fossil_type_registration ok = {"level", FOSSIL_TYPE_KIND_U8, 0, 9, 0, 0};
+    fossil_type_registration bad[] = {
+        {"i32", FOSSIL_TYPE_KIND_I32, 0, 1, 0, 0},
+        {"level", FOSSIL_TYPE_KIND_U8, 0, 1, 0, 0},
+        {"", FOSSIL_TYPE_KIND_U8, 0, 1, 0, 0},
+        {NULL, FOSSIL_TYPE_KIND_U8, 0, 1, 0, 0},
+        {"big", FOSSIL_TYPE_KIND_I8, 0, 128, 0, 0},
+        {"low", FOSSIL_TYPE_KIND_I8, -129, 0, 0, 0},
+        {"unsigned_neg", FOSSIL_TYPE_KIND_U8, -1, 1, 0, 0},
+        {"flip", FOSSIL_TYPE_KIND_I8, 3, 1, 0, 0},
+        {"unit", FOSSIL_TYPE_KIND_F64, 0, 1, 0, 0},
+        {"flag", FOSSIL_TYPE_KIND_BOOL, 0, 1, 0, 0},
+        {"text", FOSSIL_TYPE_KIND_CSTR, 0, 0, 0, 0},
+        {"nokind", FOSSIL_TYPE_KIND_COUNT, 0, 1, 0, 0},
+        {"short", FOSSIL_TYPE_KIND_I32, 0, 1, 2, 0},
+        {"padded", FOSSIL_TYPE_KIND_I32, 0, 1, 8, 8},
+        {"odd", FOSSIL_TYPE_KIND_I32, 0, 1, 0, 3},
+        {"loose", FOSSIL_TYPE_KIND_I32, 0, 1, 0, 8},
+    };
+    fossil_type_registration pair[2] = {
+        {"fresh", FOSSIL_TYPE_KIND_U8, 0, 1, 0, 0},
+        {"fresh", FOSSIL_TYPE_KIND_U8, 0, 1, 0, 0},
+    };
+
+    ASSUME_ITS_TRUE(fossil_type_registry_add(&ok) == 0);
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        ASSUME_ITS_TRUE(fossil_type_registry_add(&bad[i]) == -1);
+    }
+    ASSUME_ITS_TRUE(fossil_type_registry_add_many(pair, 2) == -1);
+    ASSUME_ITS_TRUE(fossil_type_registry_find("fresh") == NULL);
+    ASSUME_ITS_TRUE(fossil_type_registry_add(NULL) == -1);
+    ASSUME_ITS_TRUE(fossil_type_registry_add_many(pair, 0) == -1);
+    ASSUME_ITS_TRUE(fossil_type_registry_count() == 1);
+    ASSUME_ITS_TRUE(fossil_type_registry_find(NULL) == NULL);
+    fossil_type_registry_reset();
+}
+
+typedef struct registry_job {
+    int failures;
+} registry_job;
+
+static void registry_worker(void *ctx, size_t chunk, size_t begin, size_t end) {
+    registry_job *job = (registry_job *)ctx;
+    (void)chunk;
+    for (size_t i = begin; i < end; i++) {
+        char id[16];
+        snprintf(id, sizeof(id), "dyn_%zu", i);
+        fossil_type_registration reg = {id, FOSSIL_TYPE_KIND_U32, 0, i, 0, 0};
+        const fossil_type_limits *l;
+        if (fossil_type_registry_add(&reg) != 0) job->failures++;
+        l = fossil_type_limits_get(id);
+        if (!l || l->max_uint != i) job->failures++;
+        if (fossil_type_limits_get("u32") != fossil_type_limits_get_by_kind(FOSSIL_TYPE_KIND_U32)) job->failures++;
+    }
+}
+
+// Test: registrations from several threads all land, and lookups see them
+FOSSIL_TEST(c_test_registry_concurrent) {
+    tribool_pool pool;
+    registry_job job = {0};
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_pool_init(&pool, 4) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_pool_for(&pool, 200, 1, registry_worker, &job) == 0);
+    fossil_type_tribool_pool_free(&pool);
+
+    ASSUME_ITS_TRUE(job.failures == 0);
+    ASSUME_ITS_TRUE(fossil_type_registry_count() == 200);
+    ASSUME_ITS_TRUE(fossil_type_limits_get("dyn_199")->max_uint == 199);
+    fossil_type_registry_reset();
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_registry_tests) {
+    FOSSIL_ADD_TEST(c_registry_suite, c_test_registry_lookup);
+    FOSSIL_ADD_TEST(c_registry_suite, c_test_registry_dispatch);
+    FOSSIL_ADD_TEST(c_registry_suite, c_test_registry_enforced);
+    FOSSIL_ADD_TEST(c_registry_suite, c_test_registry_range_limits);
+    FOSSIL_ADD_TEST(c_registry_suite, c_test_registry_bounds);
+    FOSSIL_ADD_TEST(c_registry_suite, c_test_registry_rejects);
+    FOSSIL_ADD_TEST(c_registry_suite, c_test_registry_concurrent);
+
+    FOSSIL_ADD_SUITE(c_registry_suite);
+}
@@ -0,0 +1,86 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_registry_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_registry_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_registry_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TypeRegistry entries are visible through Limits
+FOSSIL_TEST(cpp_test_TypeRegistry_limits) {
+    using fossil::type::TypeRegistry;
+    fossil_type_registration reg{"percent", FOSSIL_TYPE_KIND_U8, 0, 100, 0, 0};
+
+    ASSUME_ITS_TRUE(TypeRegistry::add(reg));
+    ASSUME_ITS_TRUE(!TypeRegistry::add(reg));
+    ASSUME_ITS_TRUE(TypeRegistry::find("percent") != nullptr);
+
+    fossil::type::Limits lim("percent");
+    ASSUME_ITS_TRUE(lim.valid() && lim.max() == 100);
+    ASSUME_ITS_TRUE(lim.fits(100) && !lim.fits(101));
+    fossil_type_registry_reset();
+}
+
+// Test: TypeRegistry batch registration is all or nothing
+FOSSIL_TEST(cpp_test_TypeRegistry_batch) {
+    using fossil::type::TypeRegistry;
+    std::vector<fossil_type_registration> regs{
+        {"celsius_x10", FOSSIL_TYPE_KIND_I16, -2731, 10000, 0, 0},
+        {"u8", FOSSIL_TYPE_KIND_U8, 0, 1, 0, 0},
+    };
+
+    ASSUME_ITS_TRUE(!TypeRegistry::add(std::span<const fossil_type_registration>(regs)));
+    ASSUME_ITS_TRUE(TypeRegistry::size() == 0);
+    regs.pop_back();
+    ASSUME_ITS_TRUE(TypeRegistry::add(std::span<const fossil_type_registration>(regs)));
+    ASSUME_ITS_TRUE(TypeRegistry::size() == 1 && TypeRegistry::at(0)->kind == FOSSIL_TYPE_KIND_I16);
+    fossil_type_registry_reset();
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_registry_tests) {
+    FOSSIL_ADD_TEST(cpp_registry_suite, cpp_test_TypeRegistry_limits);
+    FOSSIL_ADD_TEST(cpp_registry_suite, cpp_test_TypeRegistry_batch);
+
+    FOSSIL_ADD_SUITE(cpp_registry_suite);
+}
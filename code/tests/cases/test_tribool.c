@@ -118,6 +118,54 @@ FOSSIL_TEST(c_test_tribool_not_logic) {
     ASSUME_ITS_TRUE(fossil_type_tribool_not(u) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
 }
 
+// Test: One-byte storage round-trips and canonicalizes
+FOSSIL_TEST(c_test_tribool8_conversion) {
+    ASSUME_ITS_TRUE(sizeof(tribool8) == 1);
+    ASSUME_ITS_TRUE(fossil_type_tribool8_from(FOSSIL_TYPE_TRIBOOL_TRUE) == 1);
+    ASSUME_ITS_TRUE(fossil_type_tribool8_from(FOSSIL_TYPE_TRIBOOL_FALSE) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool8_from(FOSSIL_TYPE_TRIBOOL_UNKNOWN) == 2);
+    ASSUME_ITS_TRUE(fossil_type_tribool8_from((tribool)7) == 2);
+    ASSUME_ITS_TRUE(fossil_type_tribool8_to(1) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool8_to(0) == FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool8_to(2) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool8_to(0xFF) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+}
+
+// Test: Bulk narrow/widen match the scalar conversions
+FOSSIL_TEST(c_test_tribool_narrow_widen) {
+    tribool src[77], back[77];
+    tribool8 bytes[77];
+    int ok = 1;
+
+    for (size_t i = 0; i < 77; i++) src[i] = (tribool)((i * 7u) % 5u); // includes out-of-range 3, 4
+    fossil_type_tribool_narrow(bytes, src, 77);
+    for (size_t i = 0; i < 77; i++) ok &= bytes[i] == fossil_type_tribool8_from(src[i]);
+
+    bytes[40] = 0x80;
+    fossil_type_tribool_widen(back, bytes, 77);
+    for (size_t i = 0; i < 77; i++) ok &= back[i] == fossil_type_tribool8_to(bytes[i]);
+    ASSUME_ITS_TRUE(ok);
+    ASSUME_ITS_TRUE(back[40] == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+}
+
+// Test: Inline engine agrees with the exported functions, including out-of-range input
+FOSSIL_TEST(c_test_tribool_inline_engine) {
+    int ok = 1;
+
+    for (int a = 0; a < 5; a++) {
+        ok &= fossil_type_tribool_inline_not((tribool)a) == fossil_type_tribool_not((tribool)a);
+        ok &= fossil_type_tribool_inline_is_unknown((tribool)a) == fossil_type_tribool_is_unknown((tribool)a);
+        for (int b = 0; b < 5; b++) {
+            ok &= fossil_type_tribool_inline_and((tribool)a, (tribool)b) == fossil_type_tribool_and((tribool)a, (tribool)b);
+            ok &= fossil_type_tribool_inline_or((tribool)a, (tribool)b) == fossil_type_tribool_or((tribool)a, (tribool)b);
+        }
+    }
+    ASSUME_ITS_TRUE(ok);
+    ASSUME_ITS_TRUE(fossil_type_tribool_inline_and(FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_UNKNOWN) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_inline_or(FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_UNKNOWN) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_and((tribool)4, FOSSIL_TYPE_TRIBOOL_TRUE) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -127,6 +175,9 @@ FOSSIL_TEST_GROUP(c_tribool_tests) {
     FOSSIL_ADD_TEST(c_tribool_suite, c_test_tribool_and_logic);
     FOSSIL_ADD_TEST(c_tribool_suite, c_test_tribool_or_logic);
     FOSSIL_ADD_TEST(c_tribool_suite, c_test_tribool_not_logic);
+    FOSSIL_ADD_TEST(c_tribool_suite, c_test_tribool8_conversion);
+    FOSSIL_ADD_TEST(c_tribool_suite, c_test_tribool_narrow_widen);
+    FOSSIL_ADD_TEST(c_tribool_suite, c_test_tribool_inline_engine);
 
     FOSSIL_ADD_SUITE(c_tribool_suite);
 }
@@ -144,6 +144,42 @@ FOSSIL_TEST(cpp_test_Tribool_conversion_operator) {
     ASSUME_ITS_TRUE(raw_u == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
 }
 
+// Test: Tribool wraps one-byte storage
+FOSSIL_TEST(cpp_test_Tribool_storage) {
+    using fossil::type::Tribool;
+    Tribool values[3] = {Tribool(FOSSIL_TYPE_TRIBOOL_TRUE), Tribool(FOSSIL_TYPE_TRIBOOL_FALSE),
+                         Tribool(FOSSIL_TYPE_TRIBOOL_UNKNOWN)};
+    tribool8 bytes[3] = {0, 0, 0};
+    Tribool back[3];
+
+    ASSUME_ITS_TRUE(Tribool(tribool8{1}).is_true());
+    ASSUME_ITS_TRUE(Tribool(tribool8{9}).is_unknown());
+    ASSUME_ITS_TRUE(values[0].to_storage() == 1);
+
+    ASSUME_ITS_TRUE(Tribool::narrow(bytes, values));
+    ASSUME_ITS_TRUE(bytes[0] == 1 && bytes[1] == 0 && bytes[2] == 2);
+    ASSUME_ITS_TRUE(Tribool::widen(back, bytes));
+    ASSUME_ITS_TRUE(back[0].is_true() && back[1].is_false() && back[2].is_unknown());
+    ASSUME_ITS_FALSE(Tribool::widen(std::span<Tribool>(back, 2), bytes));
+}
+
+// Test: Tribool logic folds at compile time
+FOSSIL_TEST(cpp_test_Tribool_constexpr) {
+    using fossil::type::Tribool;
+    constexpr Tribool t(FOSSIL_TYPE_TRIBOOL_TRUE);
+    constexpr Tribool f(FOSSIL_TYPE_TRIBOOL_FALSE);
+    constexpr Tribool u;
+
+    static_assert((t && u).is_unknown(), "TRUE AND UNKNOWN is UNKNOWN");
+    static_assert((f && u).is_false(), "FALSE AND UNKNOWN is FALSE");
+    static_assert((t || u).is_true(), "TRUE OR UNKNOWN is TRUE");
+    static_assert((!u).is_unknown(), "NOT UNKNOWN is UNKNOWN");
+    static_assert(Tribool(tribool8{1}).to_storage() == 1, "byte storage round-trips");
+
+    constexpr Tribool r = !(t && f) || u;
+    ASSUME_ITS_TRUE(r.is_true());
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -155,6 +191,8 @@ FOSSIL_TEST_GROUP(cpp_tribool_tests) {
     FOSSIL_ADD_TEST(cpp_tribool_suite, cpp_test_Tribool_and_operator);
     FOSSIL_ADD_TEST(cpp_tribool_suite, cpp_test_Tribool_or_operator);
     FOSSIL_ADD_TEST(cpp_tribool_suite, cpp_test_Tribool_conversion_operator);
+    FOSSIL_ADD_TEST(cpp_tribool_suite, cpp_test_Tribool_storage);
+    FOSSIL_ADD_TEST(cpp_tribool_suite, cpp_test_Tribool_constexpr);
 
     FOSSIL_ADD_SUITE(cpp_tribool_suite);
 }
@@ -0,0 +1,122 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_atomic_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_atomic_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_atomic_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: A value resolves once and keeps the first winner
+FOSSIL_TEST(c_test_atomic_tribool_resolve_once) {
+    atomic_tribool a = FOSSIL_TYPE_ATOMIC_TRIBOOL_INIT;
+    tribool seen = FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_load(&a) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_try_resolve(&a, FOSSIL_TYPE_TRIBOOL_UNKNOWN, &seen) == 0);
+    ASSUME_ITS_TRUE(seen == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_try_resolve(&a, FOSSIL_TYPE_TRIBOOL_TRUE, &seen) == 1);
+    ASSUME_ITS_TRUE(seen == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_try_resolve(&a, FOSSIL_TYPE_TRIBOOL_FALSE, &seen) == 0);
+    ASSUME_ITS_TRUE(seen == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_load(&a) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_wait(&a) == FOSSIL_TYPE_TRIBOOL_TRUE);
+
+    fossil_type_atomic_tribool_init(&a, FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_try_resolve(&a, FOSSIL_TYPE_TRIBOOL_TRUE, NULL) == 0);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_load(NULL) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+}
+
+// Test: Array slots resolve independently, including neighbours in one word
+FOSSIL_TEST(c_test_atomic_tribool_array_slots) {
+    atomic_tribool_array arr;
+    tribool seen = FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_init(&arr, 70) == 0);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_length(&arr) == 70);
+    for (size_t i = 0; i < 70; i++) {
+        ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_load(&arr, i) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    }
+    for (size_t i = 0; i < 70; i += 3) {
+        tribool v = (i % 2) ? FOSSIL_TYPE_TRIBOOL_TRUE : FOSSIL_TYPE_TRIBOOL_FALSE;
+        ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_try_resolve(&arr, i, v, NULL) == 1);
+    }
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_try_resolve(&arr, 3, FOSSIL_TYPE_TRIBOOL_FALSE, &seen) == 0);
+    ASSUME_ITS_TRUE(seen == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_try_resolve(&arr, 70, FOSSIL_TYPE_TRIBOOL_TRUE, NULL) == 0);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_wait(&arr, 70) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_wait(&arr, 69) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    for (size_t i = 0; i < 70; i++) {
+        tribool want = (i % 3) ? FOSSIL_TYPE_TRIBOOL_UNKNOWN
+                     : (i % 2) ? FOSSIL_TYPE_TRIBOOL_TRUE : FOSSIL_TYPE_TRIBOOL_FALSE;
+        ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_load(&arr, i) == want);
+    }
+    fossil_type_atomic_tribool_array_free(&arr);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_length(&arr) == 0);
+}
+
+// Test: Snapshot copies slots into a packed vector
+FOSSIL_TEST(c_test_atomic_tribool_array_snapshot) {
+    atomic_tribool_array arr;
+    tribool_vec v;
+
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_init(&arr, 40) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_init(&v, 0) == 0);
+    fossil_type_atomic_tribool_array_try_resolve(&arr, 1, FOSSIL_TYPE_TRIBOOL_TRUE, NULL);
+    fossil_type_atomic_tribool_array_try_resolve(&arr, 39, FOSSIL_TYPE_TRIBOOL_FALSE, NULL);
+    ASSUME_ITS_TRUE(fossil_type_atomic_tribool_array_snapshot(&arr, &v) == 0);
+    ASSUME_ITS_TRUE(v.length == 40);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 0) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 1) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 39) == FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_unknown(&v) == 38);
+    fossil_type_tribool_vec_free(&v);
+    fossil_type_atomic_tribool_array_free(&arr);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_atomic_tests) {
+    FOSSIL_ADD_TEST(c_tribool_atomic_suite, c_test_atomic_tribool_resolve_once);
+    FOSSIL_ADD_TEST(c_tribool_atomic_suite, c_test_atomic_tribool_array_slots);
+    FOSSIL_ADD_TEST(c_tribool_atomic_suite, c_test_atomic_tribool_array_snapshot);
+
+    FOSSIL_ADD_SUITE(c_tribool_atomic_suite);
+}
@@ -0,0 +1,99 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <thread>
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_atomic_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_atomic_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_atomic_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Racing threads resolve an AtomicTribool exactly once and wake the waiter
+FOSSIL_TEST(cpp_test_AtomicTribool_race) {
+    using fossil::type::Tribool;
+    fossil::type::AtomicTribool a;
+    std::atomic<int> wins{0};
+    Tribool waited;
+
+    std::thread waiter([&] { waited = a.wait(); });
+    std::vector<std::thread> racers;
+    for (int i = 0; i < 4; i++) {
+        racers.emplace_back([&, i] {
+            Tribool v(i % 2 ? FOSSIL_TYPE_TRIBOOL_TRUE : FOSSIL_TYPE_TRIBOOL_FALSE);
+            if (a.try_resolve(v)) wins++;
+        });
+    }
+    for (auto& t : racers) t.join();
+    waiter.join();
+
+    ASSUME_ITS_TRUE(wins.load() == 1);
+    ASSUME_ITS_TRUE(a.is_resolved());
+    ASSUME_ITS_TRUE(waited.is_true() == a.load().is_true());
+}
+
+// Test: Threads resolving disjoint slots of one word never lose an update
+FOSSIL_TEST(cpp_test_AtomicTriboolArray_disjoint) {
+    using fossil::type::Tribool;
+    fossil::type::AtomicTriboolArray arr(64);
+    Tribool waited;
+
+    std::thread waiter([&] { waited = arr.wait(63); });
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < 4; t++) {
+        workers.emplace_back([&, t] {
+            for (size_t i = t; i < 64; i += 4) arr.try_resolve(i, Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+        });
+    }
+    for (auto& t : workers) t.join();
+    waiter.join();
+
+    ASSUME_ITS_TRUE(waited.is_true());
+    ASSUME_ITS_TRUE(arr.snapshot().count_true() == 64);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_atomic_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_atomic_suite, cpp_test_AtomicTribool_race);
+    FOSSIL_ADD_TEST(cpp_tribool_atomic_suite, cpp_test_AtomicTriboolArray_disjoint);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_atomic_suite);
+}
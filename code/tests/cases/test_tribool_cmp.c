@@ -0,0 +1,192 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <math.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_cmp_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_cmp_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_cmp_suite) {
+    // Teardown code here
+}
+
+#define C_TRIBOOL_CMP_ROWS 150
+
+// Scalar SQL reference for one row
+static tribool c_tribool_cmp_expect(fossil_type_cmp_op op, double x, int x_valid, double y, int y_valid) {
+    int r = 0;
+    if (!x_valid || !y_valid) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    switch (op) {
+        case FOSSIL_TYPE_CMP_LT: r = x < y; break;
+        case FOSSIL_TYPE_CMP_LE: r = x <= y; break;
+        case FOSSIL_TYPE_CMP_EQ: r = x == y; break;
+        case FOSSIL_TYPE_CMP_NE: r = x != y; break;
+        case FOSSIL_TYPE_CMP_GT: r = x > y; break;
+        case FOSSIL_TYPE_CMP_GE: r = x >= y; break;
+    }
+    return r ? FOSSIL_TYPE_TRIBOOL_TRUE : FOSSIL_TYPE_TRIBOOL_FALSE;
+}
+
+static int c_tribool_cmp_valid(const b64 *bits, size_t i) {
+    return (int)((bits[i / 64] >> (i % 64)) & 1u);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Column-vs-column comparisons for every type and operator
+FOSSIL_TEST(c_test_tribool_cmp_columns) {
+    static i32 ai[C_TRIBOOL_CMP_ROWS], bi[C_TRIBOOL_CMP_ROWS];
+    static i64 al[C_TRIBOOL_CMP_ROWS], bl[C_TRIBOOL_CMP_ROWS];
+    static f32 af[C_TRIBOOL_CMP_ROWS], bf[C_TRIBOOL_CMP_ROWS];
+    static f64 ad[C_TRIBOOL_CMP_ROWS], bd[C_TRIBOOL_CMP_ROWS];
+    b64 av[3] = {0xF0F0F0F0FFFFFFFFULL, ~0ULL, 0x3FFFFULL};
+    b64 bv[3] = {~0ULL, 0xFFFFFFFF00FFFFFFULL, ~0ULL};
+    tribool_vec v;
+    int ok = 1;
+
+    for (size_t i = 0; i < C_TRIBOOL_CMP_ROWS; i++) {
+        ai[i] = (i32)((i * 7) % 11) - 5;
+        bi[i] = (i32)((i * 3) % 7) - 3;
+        al[i] = (i64)ai[i] * 4000000000LL;
+        bl[i] = (i64)bi[i] * 4000000000LL;
+        af[i] = (f32)ai[i] * 0.5f;
+        bf[i] = (f32)bi[i] * 0.5f;
+        ad[i] = (f64)ai[i] * 0.25;
+        bd[i] = (f64)bi[i] * 0.25;
+    }
+    fossil_type_tribool_vec_init(&v, 0);
+
+    for (int op = FOSSIL_TYPE_CMP_LT; op <= FOSSIL_TYPE_CMP_GE; op++) {
+        for (size_t n = 0; n <= C_TRIBOOL_CMP_ROWS; n += 13) {
+            ok &= fossil_type_tribool_cmp_i32(&v, (fossil_type_cmp_op)op, ai, av, bi, bv, n) == 0;
+            ok &= fossil_type_tribool_vec_length(&v) == n;
+            for (size_t i = 0; i < n; i++) {
+                ok &= fossil_type_tribool_vec_get(&v, i) == c_tribool_cmp_expect((fossil_type_cmp_op)op,
+                    ai[i], c_tribool_cmp_valid(av, i), bi[i], c_tribool_cmp_valid(bv, i));
+            }
+            ok &= fossil_type_tribool_cmp_i64(&v, (fossil_type_cmp_op)op, al, av, bl, NULL, n) == 0;
+            for (size_t i = 0; i < n; i++) {
+                ok &= fossil_type_tribool_vec_get(&v, i) == c_tribool_cmp_expect((fossil_type_cmp_op)op,
+                    (double)al[i], c_tribool_cmp_valid(av, i), (double)bl[i], 1);
+            }
+            ok &= fossil_type_tribool_cmp_f32(&v, (fossil_type_cmp_op)op, af, NULL, bf, bv, n) == 0;
+            for (size_t i = 0; i < n; i++) {
+                ok &= fossil_type_tribool_vec_get(&v, i) == c_tribool_cmp_expect((fossil_type_cmp_op)op,
+                    af[i], 1, bf[i], c_tribool_cmp_valid(bv, i));
+            }
+            ok &= fossil_type_tribool_cmp_f64(&v, (fossil_type_cmp_op)op, ad, av, bd, bv, n) == 0;
+            for (size_t i = 0; i < n; i++) {
+                ok &= fossil_type_tribool_vec_get(&v, i) == c_tribool_cmp_expect((fossil_type_cmp_op)op,
+                    ad[i], c_tribool_cmp_valid(av, i), bd[i], c_tribool_cmp_valid(bv, i));
+            }
+        }
+    }
+    ASSUME_ITS_TRUE(ok);
+    fossil_type_tribool_vec_free(&v);
+}
+
+// Test: Constants, BETWEEN and NaN
+FOSSIL_TEST(c_test_tribool_cmp_constants) {
+    static f64 a[C_TRIBOOL_CMP_ROWS];
+    b64 valid[3] = {~0ULL, ~0ULL, ~2ULL};
+    tribool_vec v;
+    int ok = 1;
+
+    for (size_t i = 0; i < C_TRIBOOL_CMP_ROWS; i++) a[i] = (f64)i;
+    a[70] = (f64)NAN;
+    fossil_type_tribool_vec_init(&v, 0);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_cmp_f64_scalar(&v, FOSSIL_TYPE_CMP_GE, a, valid, 100.0, C_TRIBOOL_CMP_ROWS) == 0);
+    for (size_t i = 0; i < C_TRIBOOL_CMP_ROWS; i++) {
+        ok &= fossil_type_tribool_vec_get(&v, i) == c_tribool_cmp_expect(FOSSIL_TYPE_CMP_GE, a[i],
+            c_tribool_cmp_valid(valid, i), 100.0, 1);
+    }
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 70) == FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 129) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_cmp_f64_scalar(&v, FOSSIL_TYPE_CMP_NE, a, NULL, 1.0, C_TRIBOOL_CMP_ROWS) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 70) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 1) == FOSSIL_TYPE_TRIBOOL_FALSE);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_between_f64(&v, a, valid, 10.0, 20.0, C_TRIBOOL_CMP_ROWS) == 0);
+    for (size_t i = 0; i < C_TRIBOOL_CMP_ROWS; i++) {
+        tribool want = !c_tribool_cmp_valid(valid, i) ? FOSSIL_TYPE_TRIBOOL_UNKNOWN
+                     : (a[i] >= 10.0 && a[i] <= 20.0) ? FOSSIL_TYPE_TRIBOOL_TRUE : FOSSIL_TYPE_TRIBOOL_FALSE;
+        ok &= fossil_type_tribool_vec_get(&v, i) == want;
+    }
+    ASSUME_ITS_TRUE(ok);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_cmp_f64_scalar(&v, (fossil_type_cmp_op)42, a, NULL, 1.0, 4) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_cmp_i32(NULL, FOSSIL_TYPE_CMP_EQ, NULL, NULL, NULL, NULL, 0) == -1);
+    fossil_type_tribool_vec_free(&v);
+}
+
+// Test: IN-list with and without a NULL entry
+FOSSIL_TEST(c_test_tribool_cmp_in_list) {
+    i64 a[100];
+    i64 list[3] = {5, 17, 99};
+    b64 valid[2] = {~(1ULL << 17), ~0ULL};
+    tribool_vec v;
+
+    for (size_t i = 0; i < 100; i++) a[i] = (i64)i;
+    fossil_type_tribool_vec_init(&v, 0);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_in_i64(&v, a, valid, list, 3, 0, 100) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 5) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 99) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 17) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 6) == FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_true(&v) == 2);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_in_i64(&v, a, NULL, list, 3, 1, 100) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 17) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 6) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_unknown(&v) == 97);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_in_i64(&v, a, NULL, NULL, 0, 0, 100) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_false(&v) == 100);
+    fossil_type_tribool_vec_free(&v);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_cmp_tests) {
+    FOSSIL_ADD_TEST(c_tribool_cmp_suite, c_test_tribool_cmp_columns);
+    FOSSIL_ADD_TEST(c_tribool_cmp_suite, c_test_tribool_cmp_constants);
+    FOSSIL_ADD_TEST(c_tribool_cmp_suite, c_test_tribool_cmp_in_list);
+
+    FOSSIL_ADD_SUITE(c_tribool_cmp_suite);
+}
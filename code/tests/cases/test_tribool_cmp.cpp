@@ -0,0 +1,80 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_cmp_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_cmp_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_cmp_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Typed C++ comparison helpers
+FOSSIL_TEST(cpp_test_tribool_cmp_templates) {
+    std::vector<i32> a = {1, 5, 9, 12};
+    std::vector<i32> b = {2, 5, 3, 12};
+    b64 valid = 0x7; // row 3 is NULL
+
+    fossil::type::TriboolVec lt = fossil::type::compare<i32>(FOSSIL_TYPE_CMP_LT, a, &valid, b, nullptr);
+    ASSUME_ITS_TRUE(lt.get(0).is_true());
+    ASSUME_ITS_TRUE(lt.get(1).is_false());
+    ASSUME_ITS_TRUE(lt.get(3).is_unknown());
+
+    fossil::type::TriboolVec eq = fossil::type::compare<i32>(FOSSIL_TYPE_CMP_EQ, a, nullptr, 9);
+    ASSUME_ITS_TRUE(eq.count_true() == 1);
+
+    std::vector<f32> f = {0.5f, 1.5f, 2.5f};
+    ASSUME_ITS_TRUE(fossil::type::between<f32>(f, nullptr, 1.0f, 2.0f).count_true() == 1);
+
+    std::vector<f32> list = {2.5f};
+    fossil::type::TriboolVec in = fossil::type::in<f32>(f, nullptr, list, true);
+    ASSUME_ITS_TRUE(in.get(2).is_true());
+    ASSUME_ITS_TRUE(in.get(0).is_unknown());
+
+    std::vector<i32> shorter = {1};
+    ASSUME_ITS_TRUE(fossil::type::compare<i32>(FOSSIL_TYPE_CMP_LT, a, nullptr, shorter, nullptr).size() == 0);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_cmp_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_cmp_suite, cpp_test_tribool_cmp_templates);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_cmp_suite);
+}
@@ -0,0 +1,235 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include "tribool_sample.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_connective_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_connective_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_connective_suite) {
+    // Teardown code here
+}
+
+// Connective truth tables indexed [a][b] in FALSE, TRUE, UNKNOWN order
+#define F FOSSIL_TYPE_TRIBOOL_FALSE
+#define T FOSSIL_TYPE_TRIBOOL_TRUE
+#define U FOSSIL_TYPE_TRIBOOL_UNKNOWN
+static const tribool c_conn_xor[3][3]         = {{F, T, U}, {T, F, U}, {U, U, U}};
+static const tribool c_conn_implies[3][3]     = {{T, T, T}, {F, T, U}, {U, T, U}};
+static const tribool c_conn_equiv[3][3]       = {{T, F, U}, {F, T, U}, {U, U, U}};
+static const tribool c_conn_luk_xor[3][3]     = {{F, T, U}, {T, F, U}, {U, U, F}};
+static const tribool c_conn_luk_implies[3][3] = {{T, T, T}, {F, T, U}, {U, T, T}};
+static const tribool c_conn_luk_equiv[3][3]   = {{T, F, U}, {F, T, U}, {U, U, T}};
+static const tribool c_conn_consensus[3][3]   = {{F, U, U}, {U, T, U}, {U, U, U}};
+static const tribool c_conn_merge[3][3]       = {{F, U, F}, {U, T, T}, {F, T, U}};
+#undef F
+#undef T
+#undef U
+
+typedef tribool (*c_conn_scalar_fn)(tribool, tribool);
+typedef int (*c_conn_vec_fn)(tribool_vec *, const tribool_vec *, const tribool_vec *);
+
+typedef struct {
+    const tribool (*table)[3];
+    c_conn_scalar_fn scalar;
+    c_conn_vec_fn vec;
+} c_conn_case;
+
+static const c_conn_case c_conn_cases[] = {
+    {c_conn_xor, fossil_type_tribool_xor, fossil_type_tribool_vec_xor},
+    {c_conn_implies, fossil_type_tribool_implies, fossil_type_tribool_vec_implies},
+    {c_conn_equiv, fossil_type_tribool_equiv, fossil_type_tribool_vec_equiv},
+    {c_conn_luk_xor, fossil_type_tribool_luk_xor, fossil_type_tribool_vec_luk_xor},
+    {c_conn_luk_implies, fossil_type_tribool_luk_implies, fossil_type_tribool_vec_luk_implies},
+    {c_conn_luk_equiv, fossil_type_tribool_luk_equiv, fossil_type_tribool_vec_luk_equiv},
+    {c_conn_consensus, fossil_type_tribool_consensus, fossil_type_tribool_vec_consensus},
+    {c_conn_merge, fossil_type_tribool_merge, fossil_type_tribool_vec_merge},
+};
+
+#define C_CONN_CASES (sizeof(c_conn_cases) / sizeof(c_conn_cases[0]))
+
+static void c_conn_fill(tribool_vec *v, size_t seed, size_t n) {
+    fossil_type_tribool_vec_init(v, n);
+    for (size_t i = 0; i < n; i++) fossil_type_tribool_vec_set(v, i, test_tribool_scrambled(seed, 7u, i));
+}
+
+// Reference threshold straight from the definition
+static tribool c_conn_threshold_ref(const tribool *v, size_t n, size_t k) {
+    size_t t = 0, maybe = 0;
+    for (size_t i = 0; i < n; i++) {
+        t += v[i] == FOSSIL_TYPE_TRIBOOL_TRUE;
+        maybe += v[i] != FOSSIL_TYPE_TRIBOOL_FALSE;
+    }
+    if (t >= k) return FOSSIL_TYPE_TRIBOOL_TRUE;
+    return maybe >= k ? FOSSIL_TYPE_TRIBOOL_UNKNOWN : FOSSIL_TYPE_TRIBOOL_FALSE;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Scalar, inline and table forms agree on all nine operand pairs
+FOSSIL_TEST(c_test_tribool_connective_truth_tables) {
+    for (size_t c = 0; c < C_CONN_CASES; c++) {
+        for (int a = 0; a < 3; a++) {
+            for (int b = 0; b < 3; b++) {
+                ASSUME_ITS_EQUAL_I32(c_conn_cases[c].table[a][b],
+                                     c_conn_cases[c].scalar((tribool)a, (tribool)b));
+            }
+        }
+    }
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_UNKNOWN,
+                         fossil_type_tribool_inline_merge(FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_FALSE));
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_TRUE,
+                         fossil_type_tribool_inline_luk_implies(FOSSIL_TYPE_TRIBOOL_UNKNOWN, FOSSIL_TYPE_TRIBOOL_UNKNOWN));
+}
+
+// Test: Packed connectives match the scalar ones lane by lane, tail included
+FOSSIL_TEST(c_test_tribool_connective_vec_matches_scalar) {
+    const size_t lengths[] = {1, 31, 32, 33, 127, 128, 129, 1000};
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        size_t n = lengths[l];
+        tribool_vec a, b, r;
+        c_conn_fill(&a, 1, n);
+        c_conn_fill(&b, 2, n);
+        fossil_type_tribool_vec_init(&r, 0);
+        for (size_t c = 0; c < C_CONN_CASES; c++) {
+            ASSUME_ITS_EQUAL_I32(0, c_conn_cases[c].vec(&r, &a, &b));
+            ASSUME_ITS_TRUE(r.length == n);
+            int ok = 1;
+            for (size_t i = 0; i < n; i++) {
+                tribool want = c_conn_cases[c].scalar(fossil_type_tribool_vec_get(&a, i),
+                                                      fossil_type_tribool_vec_get(&b, i));
+                if (fossil_type_tribool_vec_get(&r, i) != want) ok = 0;
+            }
+            ASSUME_ITS_TRUE(ok);
+            // Padding lanes stay zero
+            uint64_t tail = (n % 32) ? (1ULL << (2 * (n % 32))) - 1 : ~0ULL;
+            ASSUME_ITS_TRUE((r.words[FOSSIL_TYPE_TRIBOOL_VEC_WORDS(n) - 1] & ~tail) == 0);
+        }
+        fossil_type_tribool_vec_free(&a);
+        fossil_type_tribool_vec_free(&b);
+        fossil_type_tribool_vec_free(&r);
+    }
+}
+
+// Test: Packed connectives reject mismatched lengths and allow dst to alias
+FOSSIL_TEST(c_test_tribool_connective_vec_args) {
+    tribool_vec a, b;
+    c_conn_fill(&a, 3, 40);
+    c_conn_fill(&b, 4, 41);
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_vec_xor(&a, &a, &b));
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_vec_merge(NULL, &a, &a));
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_vec_equiv(&a, &a, &a));
+    // x <-> x is TRUE wherever x is known
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_false(&a) == 0);
+    fossil_type_tribool_vec_free(&a);
+    fossil_type_tribool_vec_free(&b);
+}
+
+// Test: Array threshold and majority follow the definition
+FOSSIL_TEST(c_test_tribool_connective_threshold) {
+    tribool v[9];
+    for (size_t seed = 0; seed < 50; seed++) {
+        for (size_t i = 0; i < 9; i++) v[i] = test_tribool_scrambled(seed, 7u, i);
+        for (size_t k = 0; k <= 10; k++) {
+            ASSUME_ITS_EQUAL_I32(c_conn_threshold_ref(v, 9, k), fossil_type_tribool_threshold(v, 9, k));
+        }
+        ASSUME_ITS_EQUAL_I32(c_conn_threshold_ref(v, 9, 5), fossil_type_tribool_majority(v, 9));
+    }
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_FALSE, fossil_type_tribool_majority(v, 0));
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_TRUE, fossil_type_tribool_threshold(NULL, 0, 0));
+}
+
+// Test: Packed threshold matches the array form lane by lane
+FOSSIL_TEST(c_test_tribool_connective_vec_threshold) {
+    enum { INPUTS = 7, LANES = 100 };
+    tribool_vec in[INPUTS], r;
+    const tribool_vec *ptrs[INPUTS];
+    for (size_t i = 0; i < INPUTS; i++) {
+        c_conn_fill(&in[i], 10 + i, LANES);
+        ptrs[i] = &in[i];
+    }
+    fossil_type_tribool_vec_init(&r, 0);
+    for (size_t k = 0; k <= INPUTS + 1; k++) {
+        ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_vec_threshold(&r, ptrs, INPUTS, k));
+        int ok = 1;
+        for (size_t lane = 0; lane < LANES; lane++) {
+            tribool column[INPUTS];
+            for (size_t i = 0; i < INPUTS; i++) column[i] = fossil_type_tribool_vec_get(&in[i], lane);
+            if (fossil_type_tribool_vec_get(&r, lane) != fossil_type_tribool_threshold(column, INPUTS, k)) ok = 0;
+        }
+        ASSUME_ITS_TRUE(ok);
+    }
+    // Counters are sized to the input count, so check every count and a k past any count
+    for (size_t n = 1; n <= INPUTS; n++) {
+        size_t ks[2] = {n / 2 + 1, (size_t)-1};
+        for (size_t j = 0; j < 2; j++) {
+            ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_vec_threshold(&r, ptrs, n, ks[j]));
+            int ok = 1;
+            for (size_t lane = 0; lane < LANES; lane++) {
+                tribool column[INPUTS];
+                for (size_t i = 0; i < n; i++) column[i] = fossil_type_tribool_vec_get(&in[i], lane);
+                if (fossil_type_tribool_vec_get(&r, lane) != fossil_type_tribool_threshold(column, n, ks[j])) ok = 0;
+            }
+            ASSUME_ITS_TRUE(ok);
+        }
+    }
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_vec_majority(&r, ptrs, INPUTS));
+    ASSUME_ITS_TRUE(r.length == LANES);
+
+    // dst may be one of the inputs
+    tribool want = fossil_type_tribool_vec_get(&r, 42);
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_vec_majority(&in[0], ptrs, INPUTS));
+    ASSUME_ITS_EQUAL_I32(want, fossil_type_tribool_vec_get(&in[0], 42));
+
+    fossil_type_tribool_vec_resize(&in[1], LANES + 1);
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_vec_majority(&r, ptrs, INPUTS));
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_vec_majority(&r, ptrs, 0));
+
+    for (size_t i = 0; i < INPUTS; i++) fossil_type_tribool_vec_free(&in[i]);
+    fossil_type_tribool_vec_free(&r);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_connective_tests) {
+    FOSSIL_ADD_TEST(c_tribool_connective_suite, c_test_tribool_connective_truth_tables);
+    FOSSIL_ADD_TEST(c_tribool_connective_suite, c_test_tribool_connective_vec_matches_scalar);
+    FOSSIL_ADD_TEST(c_tribool_connective_suite, c_test_tribool_connective_vec_args);
+    FOSSIL_ADD_TEST(c_tribool_connective_suite, c_test_tribool_connective_threshold);
+    FOSSIL_ADD_TEST(c_tribool_connective_suite, c_test_tribool_connective_vec_threshold);
+
+    FOSSIL_ADD_SUITE(c_tribool_connective_suite);
+}
@@ -0,0 +1,120 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_connective_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_connective_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_connective_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Tribool connective operators and members
+FOSSIL_TEST(cpp_test_Tribool_connectives) {
+    using fossil::type::Tribool;
+    constexpr Tribool t(true), f(false), u;
+
+    static_assert((t ^ f).is_true());
+    static_assert(f.implies(u).is_true());
+    static_assert(u.luk_implies(u).is_true());
+    ASSUME_ITS_TRUE((t ^ t).is_false());
+    ASSUME_ITS_TRUE((t ^ u).is_unknown());
+    ASSUME_ITS_TRUE(t.implies(f).is_false());
+    ASSUME_ITS_TRUE(u.implies(u).is_unknown());
+    ASSUME_ITS_TRUE(f.equiv(f).is_true());
+    ASSUME_ITS_TRUE(u.luk_equiv(u).is_true());
+    ASSUME_ITS_TRUE(u.luk_xor(u).is_false());
+    ASSUME_ITS_TRUE(t.consensus(t).is_true());
+    ASSUME_ITS_TRUE(t.consensus(f).is_unknown());
+    ASSUME_ITS_TRUE(u.merge(f).is_false());
+    ASSUME_ITS_TRUE(t.merge(f).is_unknown());
+}
+
+// Test: Tribool threshold and majority over spans
+FOSSIL_TEST(cpp_test_Tribool_threshold) {
+    using fossil::type::Tribool;
+    std::vector<Tribool> votes = {Tribool(true), Tribool(true), Tribool(), Tribool(false), Tribool(false)};
+
+    ASSUME_ITS_TRUE(Tribool::threshold(votes, 2).is_true());
+    ASSUME_ITS_TRUE(Tribool::threshold(votes, 3).is_unknown());
+    ASSUME_ITS_TRUE(Tribool::threshold(votes, 4).is_false());
+    ASSUME_ITS_TRUE(Tribool::majority(votes).is_unknown());
+    votes[2] = Tribool(true);
+    ASSUME_ITS_TRUE(Tribool::majority(votes).is_true());
+}
+
+// Test: TriboolVec connectives and majority
+FOSSIL_TEST(cpp_test_TriboolVec_connectives) {
+    using fossil::type::Tribool;
+    using fossil::type::TriboolVec;
+    TriboolVec a(3), b(3), c(3);
+    a.set(0, Tribool(true));  a.set(1, Tribool(false)); a.set(2, Tribool());
+    b.set(0, Tribool(false)); b.set(1, Tribool(false)); b.set(2, Tribool());
+    c.set(0, Tribool(true));  c.set(1, Tribool(true));  c.set(2, Tribool(false));
+
+    TriboolVec x = a ^ b;
+    ASSUME_ITS_TRUE(x.get(0).is_true());
+    ASSUME_ITS_TRUE(x.get(1).is_false());
+    ASSUME_ITS_TRUE(x.get(2).is_unknown());
+    ASSUME_ITS_TRUE(a.luk_xor(b).get(2).is_false());
+    ASSUME_ITS_TRUE(a.implies(b).get(0).is_false());
+    ASSUME_ITS_TRUE(a.equiv(b).get(1).is_true());
+    ASSUME_ITS_TRUE(a.luk_implies(b).get(2).is_true());
+    ASSUME_ITS_TRUE(a.luk_equiv(b).get(2).is_true());
+    ASSUME_ITS_TRUE(a.consensus(b).get(1).is_false());
+    ASSUME_ITS_TRUE(a.merge(c).get(2).is_false());
+
+    const tribool_vec *inputs[] = {a.raw(), b.raw(), c.raw()};
+    TriboolVec m = TriboolVec::majority(inputs);
+    ASSUME_ITS_TRUE(m.size() == 3);
+    ASSUME_ITS_TRUE(m.get(0).is_true());
+    ASSUME_ITS_TRUE(m.get(1).is_false());
+    ASSUME_ITS_TRUE(m.get(2).is_unknown());
+    ASSUME_ITS_TRUE(TriboolVec::threshold(inputs, 1).get(2).is_unknown());
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_connective_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_connective_suite, cpp_test_Tribool_connectives);
+    FOSSIL_ADD_TEST(cpp_tribool_connective_suite, cpp_test_Tribool_threshold);
+    FOSSIL_ADD_TEST(cpp_tribool_connective_suite, cpp_test_TriboolVec_connectives);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_connective_suite);
+}
@@ -0,0 +1,187 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include "tribool_sample.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_expr_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_expr_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_expr_suite) {
+    // Teardown code here
+}
+
+#define C_TRIBOOL_EXPR_ROWS 1000
+#define C_TRIBOOL_EXPR_COLS 6
+
+// Reference: evaluates every node for one row in id order with the scalar ops
+static tribool c_tribool_expr_eval_row(const tribool_expr *e, tribool_expr_id root, size_t row, tribool *scratch) {
+    for (size_t id = 0; id <= root; id++) {
+        const fossil_type_tribool_expr_node *n = &e->nodes[id];
+        switch (n->op) {
+        case FOSSIL_TYPE_TRIBOOL_OP_CONST: scratch[id] = (tribool)n->a; break;
+        case FOSSIL_TYPE_TRIBOOL_OP_INPUT: scratch[id] = test_tribool_scrambled(n->a, 17u, row); break;
+        case FOSSIL_TYPE_TRIBOOL_OP_NOT: scratch[id] = fossil_type_tribool_not(scratch[n->a]); break;
+        case FOSSIL_TYPE_TRIBOOL_OP_AND: scratch[id] = fossil_type_tribool_and(scratch[n->a], scratch[n->b]); break;
+        default: scratch[id] = fossil_type_tribool_or(scratch[n->a], scratch[n->b]); break;
+        }
+    }
+    return scratch[root];
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Shared subexpressions get one id and constants fold
+FOSSIL_TEST(c_test_tribool_expr_fold_and_share) {
+    tribool_expr e;
+    fossil_type_tribool_expr_init(&e);
+    tribool_expr_id x = fossil_type_tribool_expr_input(&e, 0);
+    tribool_expr_id y = fossil_type_tribool_expr_input(&e, 1);
+    tribool_expr_id t = fossil_type_tribool_expr_const(&e, FOSSIL_TYPE_TRIBOOL_TRUE);
+    tribool_expr_id f = fossil_type_tribool_expr_const(&e, FOSSIL_TYPE_TRIBOOL_FALSE);
+    tribool_expr_id u = fossil_type_tribool_expr_const(&e, FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    tribool_expr_id xy = fossil_type_tribool_expr_and(&e, x, y);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_and(&e, y, x) == xy);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_input(&e, 0) == x);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_and(&e, x, f) == f);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_and(&e, t, x) == x);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_or(&e, x, t) == t);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_or(&e, f, x) == x);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_and(&e, u, t) == u);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_not(&e, u) == u);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_not(&e, t) == f);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_not(&e, fossil_type_tribool_expr_not(&e, x)) == x);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_or(&e, x, xy) == x);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_and(&e, x, x) == x);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_and(&e, x, fossil_type_tribool_expr_not(&e, x)) != f);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_and(&e, x, 9999) == FOSSIL_TYPE_TRIBOOL_EXPR_INVALID);
+    ASSUME_ITS_TRUE(fossil_type_tribool_expr_count(&e) == 8);
+    fossil_type_tribool_expr_free(&e);
+}
+
+// Test: A compiled random DAG agrees with row-by-row scalar evaluation
+FOSSIL_TEST(c_test_tribool_expr_program_matches_scalar) {
+    static tribool scratch[512];
+    tribool_expr e;
+    tribool_program p;
+    tribool_vec cols[C_TRIBOOL_EXPR_COLS], out;
+    const tribool_vec *inputs[C_TRIBOOL_EXPR_COLS];
+    tribool_expr_id ids[200];
+    size_t n = 0;
+
+    fossil_type_tribool_expr_init(&e);
+    fossil_type_tribool_program_init(&p);
+    for (u32 c = 0; c < C_TRIBOOL_EXPR_COLS; c++) ids[n++] = fossil_type_tribool_expr_input(&e, c);
+    ids[n++] = fossil_type_tribool_expr_const(&e, FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    for (unsigned k = 0; n < 200; k++) {
+        tribool_expr_id a = ids[(k * 7u + 3u) % n], b = ids[(k * 13u + 1u) % n];
+        tribool_expr_id r = k % 3 == 0 ? fossil_type_tribool_expr_and(&e, a, b)
+                          : k % 3 == 1 ? fossil_type_tribool_expr_or(&e, a, b)
+                          : fossil_type_tribool_expr_not(&e, a);
+        ids[n++] = r;
+    }
+    tribool_expr_id root = ids[0];
+    for (size_t i = 1; i < n; i++) root = ids[i] > root ? ids[i] : root;
+
+    for (size_t c = 0; c < C_TRIBOOL_EXPR_COLS; c++) {
+        fossil_type_tribool_vec_init(&cols[c], C_TRIBOOL_EXPR_ROWS);
+        for (size_t r = 0; r < C_TRIBOOL_EXPR_ROWS; r++) fossil_type_tribool_vec_set(&cols[c], r, test_tribool_scrambled(c, 17u, r));
+        inputs[c] = &cols[c];
+    }
+    fossil_type_tribool_vec_init(&out, 0);
+
+    ASSUME_ITS_TRUE(root < 512);
+    ASSUME_ITS_TRUE(fossil_type_tribool_program_compile(&p, &e, root) == 0);
+    ASSUME_ITS_TRUE(p.registers < p.length);
+    ASSUME_ITS_TRUE(fossil_type_tribool_program_run(&p, &out, inputs, C_TRIBOOL_EXPR_COLS) == 0);
+    ASSUME_ITS_TRUE(out.length == C_TRIBOOL_EXPR_ROWS);
+    int agree = 1;
+    for (size_t r = 0; r < C_TRIBOOL_EXPR_ROWS; r++) {
+        agree &= fossil_type_tribool_vec_get(&out, r) == c_tribool_expr_eval_row(&e, root, r, scratch);
+    }
+    ASSUME_ITS_TRUE(agree);
+
+    for (size_t c = 0; c < C_TRIBOOL_EXPR_COLS; c++) fossil_type_tribool_vec_free(&cols[c]);
+    fossil_type_tribool_vec_free(&out);
+    fossil_type_tribool_program_free(&p);
+    fossil_type_tribool_expr_free(&e);
+}
+
+// Test: Long chains reuse registers and the output may alias an input
+FOSSIL_TEST(c_test_tribool_expr_program_registers) {
+    tribool_expr e;
+    tribool_program p;
+    tribool_vec a, b;
+    const tribool_vec *inputs[2] = { &a, &b };
+
+    fossil_type_tribool_expr_init(&e);
+    fossil_type_tribool_program_init(&p);
+    tribool_expr_id acc = fossil_type_tribool_expr_input(&e, 0);
+    for (int i = 0; i < 100; i++) {
+        acc = fossil_type_tribool_expr_not(&e, fossil_type_tribool_expr_or(&e, acc, fossil_type_tribool_expr_input(&e, 1)));
+    }
+    ASSUME_ITS_TRUE(fossil_type_tribool_program_compile(&p, &e, acc) == 0);
+    ASSUME_ITS_TRUE(p.length == 200);
+    ASSUME_ITS_TRUE(p.registers == 1);
+    ASSUME_ITS_TRUE(p.inputs == 2);
+
+    fossil_type_tribool_vec_init(&a, 70);
+    fossil_type_tribool_vec_init(&b, 70);
+    fossil_type_tribool_vec_fill(&a, FOSSIL_TYPE_TRIBOOL_TRUE);
+    fossil_type_tribool_vec_fill(&b, FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_program_run(&p, &a, inputs, 2) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_true(&a) == 70);
+
+    fossil_type_tribool_vec_resize(&b, 3);
+    ASSUME_ITS_TRUE(fossil_type_tribool_program_run(&p, &a, inputs, 2) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_program_run(&p, &a, inputs, 1) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_program_compile(&p, &e, 100000) == -1);
+
+    fossil_type_tribool_vec_free(&a);
+    fossil_type_tribool_vec_free(&b);
+    fossil_type_tribool_program_free(&p);
+    fossil_type_tribool_expr_free(&e);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_expr_tests) {
+    FOSSIL_ADD_TEST(c_tribool_expr_suite, c_test_tribool_expr_fold_and_share);
+    FOSSIL_ADD_TEST(c_tribool_expr_suite, c_test_tribool_expr_program_matches_scalar);
+    FOSSIL_ADD_TEST(c_tribool_expr_suite, c_test_tribool_expr_program_registers);
+
+    FOSSIL_ADD_SUITE(c_tribool_expr_suite);
+}
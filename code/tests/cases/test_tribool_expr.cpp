@@ -0,0 +1,81 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_expr_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_expr_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_expr_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TriboolExpr compiled into a TriboolProgram over two columns
+FOSSIL_TEST(cpp_test_TriboolProgram_run) {
+    using fossil::type::Tribool;
+    fossil::type::TriboolExpr e;
+    auto x = e.input(0);
+    auto y = e.input(1);
+    auto rule = e.logical_or(e.logical_and(x, y), e.logical_not(y));
+
+    fossil::type::TriboolProgram p;
+    ASSUME_ITS_TRUE(p.compile(e, rule));
+    ASSUME_ITS_TRUE(p.size() == 3);
+    ASSUME_ITS_TRUE(e.logical_and(y, x) == e.logical_and(x, y));
+
+    fossil::type::TriboolVec a(3), b(3);
+    a.set(0, Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    a.set(1, Tribool(FOSSIL_TYPE_TRIBOOL_FALSE));
+    a.set(2, Tribool(FOSSIL_TYPE_TRIBOOL_UNKNOWN));
+    b.fill(Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    const tribool_vec* cols[] = { a.raw(), b.raw() };
+
+    fossil::type::TriboolVec r = p.run(cols);
+    ASSUME_ITS_TRUE(r.size() == 3);
+    ASSUME_ITS_TRUE(r.get(0).is_true());
+    ASSUME_ITS_TRUE(r.get(1).is_false());
+    ASSUME_ITS_TRUE(r.get(2).is_unknown());
+    ASSUME_ITS_TRUE(p.run(std::span<const tribool_vec* const>(cols, 1)).size() == 0);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_expr_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_expr_suite, cpp_test_TriboolProgram_run);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_expr_suite);
+}
@@ -0,0 +1,164 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_graph_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_graph_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_graph_suite) {
+    // Teardown code here
+}
+
+// Recomputes node id from scratch with the scalar ops
+static tribool c_tribool_graph_full(const tribool_graph *g, u32 id) {
+    const fossil_type_tribool_graph_node *n = &g->nodes[id];
+    const u32 *ops = g->operands + n->operand_first;
+    tribool acc;
+    switch (n->op) {
+    case FOSSIL_TYPE_TRIBOOL_OP_INPUT: return n->value;
+    case FOSSIL_TYPE_TRIBOOL_OP_NOT: return fossil_type_tribool_not(c_tribool_graph_full(g, ops[0]));
+    case FOSSIL_TYPE_TRIBOOL_OP_AND:
+        acc = FOSSIL_TYPE_TRIBOOL_TRUE;
+        for (u32 i = 0; i < n->operand_count; i++) acc = fossil_type_tribool_and(acc, c_tribool_graph_full(g, ops[i]));
+        return acc;
+    default:
+        acc = FOSSIL_TYPE_TRIBOOL_FALSE;
+        for (u32 i = 0; i < n->operand_count; i++) acc = fossil_type_tribool_or(acc, c_tribool_graph_full(g, ops[i]));
+        return acc;
+    }
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Nodes take their value on creation and follow input changes
+FOSSIL_TEST(c_test_tribool_graph_basic) {
+    tribool_graph g;
+    fossil_type_tribool_graph_init(&g);
+    u32 a = fossil_type_tribool_graph_input(&g, FOSSIL_TYPE_TRIBOOL_TRUE);
+    u32 b = fossil_type_tribool_graph_input(&g, FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    u32 ab[2] = { a, b };
+    u32 both = fossil_type_tribool_graph_and(&g, ab, 2);
+    u32 either = fossil_type_tribool_graph_or(&g, ab, 2);
+    u32 neither = fossil_type_tribool_graph_not(&g, either);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_value(&g, both) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_value(&g, either) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_value(&g, neither) == FOSSIL_TYPE_TRIBOOL_FALSE);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_set(&g, a, FOSSIL_TYPE_TRIBOOL_FALSE) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_value(&g, a) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_update(&g) == 4);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_value(&g, both) == FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_value(&g, either) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_value(&g, neither) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_set(&g, both, FOSSIL_TYPE_TRIBOOL_TRUE) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_not(&g, 99) == FOSSIL_TYPE_TRIBOOL_GRAPH_INVALID);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_update(&g) == 0);
+    fossil_type_tribool_graph_free(&g);
+}
+
+// Test: A FALSE operand stops propagation at its AND
+FOSSIL_TEST(c_test_tribool_graph_short_circuit) {
+    tribool_graph g;
+    fossil_type_tribool_graph_init(&g);
+    u32 gate = fossil_type_tribool_graph_input(&g, FOSSIL_TYPE_TRIBOOL_FALSE);
+    u32 y1 = fossil_type_tribool_graph_input(&g, FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    u32 y2 = fossil_type_tribool_graph_input(&g, FOSSIL_TYPE_TRIBOOL_FALSE);
+    u32 ys[2] = { y1, y2 };
+    u32 any = fossil_type_tribool_graph_or(&g, ys, 2);
+    u32 guarded[2] = { gate, any };
+    u32 pinned = fossil_type_tribool_graph_and(&g, guarded, 2);
+    u32 top = fossil_type_tribool_graph_not(&g, pinned);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_set(&g, y1, FOSSIL_TYPE_TRIBOOL_TRUE) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_update(&g) == 3);
+
+    fossil_type_tribool_graph_stats s = fossil_type_tribool_graph_get_stats(&g);
+    ASSUME_ITS_TRUE(s.last_recomputed == 3);
+    ASSUME_ITS_TRUE(s.last_changed == 2);
+    ASSUME_ITS_TRUE(s.updates == 1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_value(&g, top) == FOSSIL_TYPE_TRIBOOL_TRUE);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_set(&g, y2, FOSSIL_TYPE_TRIBOOL_FALSE) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_update(&g) == 0);
+    fossil_type_tribool_graph_free(&g);
+}
+
+// Test: Random edits agree with recomputing every node from scratch
+FOSSIL_TEST(c_test_tribool_graph_matches_full) {
+    tribool_graph g;
+    u32 ids[300];
+    unsigned x = 12345u;
+    fossil_type_tribool_graph_init(&g);
+    for (u32 i = 0; i < 300; i++) {
+        x = x * 1103515245u + 12345u;
+        if (i < 40) {
+            ids[i] = fossil_type_tribool_graph_input(&g, (tribool)((x >> 16) % 3u));
+            continue;
+        }
+        u32 ops[4] = { ids[(x >> 3) % i], ids[(x >> 9) % i], ids[(x >> 15) % i], ids[(x >> 21) % i] };
+        unsigned kind = (x >> 28) % 3u;
+        ids[i] = kind == 0 ? fossil_type_tribool_graph_not(&g, ops[0])
+               : kind == 1 ? fossil_type_tribool_graph_and(&g, ops, 1 + (x >> 5) % 4u)
+               : fossil_type_tribool_graph_or(&g, ops, 1 + (x >> 5) % 4u);
+    }
+
+    int agree = 1;
+    size_t total = 0;
+    for (int round = 0; round < 50; round++) {
+        for (int k = 0; k < 3; k++) {
+            x = x * 1103515245u + 12345u;
+            fossil_type_tribool_graph_set(&g, ids[(x >> 8) % 40u], (tribool)((x >> 20) % 3u));
+        }
+        total += fossil_type_tribool_graph_update(&g);
+        for (u32 i = 0; i < 300; i++) agree &= fossil_type_tribool_graph_value(&g, i) == c_tribool_graph_full(&g, i);
+    }
+    ASSUME_ITS_TRUE(agree);
+    ASSUME_ITS_TRUE(fossil_type_tribool_graph_get_stats(&g).recomputed == total);
+    ASSUME_ITS_TRUE(total < 50u * 300u);
+    fossil_type_tribool_graph_free(&g);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_graph_tests) {
+    FOSSIL_ADD_TEST(c_tribool_graph_suite, c_test_tribool_graph_basic);
+    FOSSIL_ADD_TEST(c_tribool_graph_suite, c_test_tribool_graph_short_circuit);
+    FOSSIL_ADD_TEST(c_tribool_graph_suite, c_test_tribool_graph_matches_full);
+
+    FOSSIL_ADD_SUITE(c_tribool_graph_suite);
+}
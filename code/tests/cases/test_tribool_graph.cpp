@@ -0,0 +1,78 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_graph_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_graph_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_graph_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TriboolGraph recomputes only what an input change reaches
+FOSSIL_TEST(cpp_test_TriboolGraph_update) {
+    using fossil::type::Tribool;
+    fossil::type::TriboolGraph g;
+    auto a = g.input(Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    auto b = g.input(Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    auto c = g.input(Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    const fossil::type::TriboolGraph::Id ab[] = { a, b };
+    auto left = g.logical_and(ab);
+    auto right = g.logical_not(c);
+    const fossil::type::TriboolGraph::Id lr[] = { left, right };
+    auto top = g.logical_or(lr);
+
+    ASSUME_ITS_TRUE(g.value(top).is_true());
+    ASSUME_ITS_TRUE(g.set(c, Tribool(FOSSIL_TYPE_TRIBOOL_FALSE)));
+    ASSUME_ITS_TRUE(g.update() == 3);
+    ASSUME_ITS_TRUE(g.value(top).is_true());
+    ASSUME_ITS_TRUE(g.set(a, Tribool(FOSSIL_TYPE_TRIBOOL_UNKNOWN)));
+    ASSUME_ITS_TRUE(g.update() == 3);
+    ASSUME_ITS_TRUE(g.stats().last_changed == 2);
+    ASSUME_ITS_TRUE(g.value(left).is_unknown());
+    ASSUME_ITS_TRUE(g.stats().recomputed == 6);
+    ASSUME_ITS_TRUE(!g.set(top, Tribool(FOSSIL_TYPE_TRIBOOL_TRUE)));
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_graph_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_graph_suite, cpp_test_TriboolGraph_update);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_graph_suite);
+}
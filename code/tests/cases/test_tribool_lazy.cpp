@@ -0,0 +1,121 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_lazy_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_lazy_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_lazy_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: AND skips its right side only when the left side is FALSE
+FOSSIL_TEST(cpp_test_lazy_and_short_circuits) {
+    using fossil::type::Tribool;
+    using fossil::type::lazy;
+    int calls = 0;
+    auto counted = [&calls](Tribool t) { return lazy([&calls, t] { calls++; return t; }); };
+
+    Tribool r = (lazy([] { return Tribool(false); }) && counted(Tribool(true))).eval();
+    ASSUME_ITS_TRUE(r.is_false());
+    ASSUME_ITS_TRUE(calls == 0);
+
+    r = (lazy([] { return Tribool(); }) && counted(Tribool(false))).eval();
+    ASSUME_ITS_TRUE(r.is_false());
+    ASSUME_ITS_TRUE(calls == 1);
+
+    r = (lazy([] { return true; }) && counted(Tribool())).eval();
+    ASSUME_ITS_TRUE(r.is_unknown());
+    ASSUME_ITS_TRUE(calls == 2);
+}
+
+// Test: OR skips its right side only when the left side is TRUE
+FOSSIL_TEST(cpp_test_lazy_or_short_circuits) {
+    using fossil::type::Tribool;
+    using fossil::type::lazy;
+    int calls = 0;
+    auto right = lazy([&calls] { calls++; return FOSSIL_TYPE_TRIBOOL_FALSE; });
+
+    ASSUME_ITS_TRUE((Tribool(true) || right).eval().is_true());
+    ASSUME_ITS_TRUE(calls == 0);
+    ASSUME_ITS_TRUE((Tribool() || right).eval().is_unknown());
+    ASSUME_ITS_TRUE((false || right).eval().is_false());
+    ASSUME_ITS_TRUE(calls == 2);
+}
+
+// Test: Nested lazy expressions match the eager operators on every input
+FOSSIL_TEST(cpp_test_lazy_matches_eager) {
+    using fossil::type::Tribool;
+    using fossil::type::lazy;
+    const Tribool values[3] = {Tribool(false), Tribool(true), Tribool()};
+    bool ok = true;
+    for (Tribool a : values) {
+        for (Tribool b : values) {
+            for (Tribool c : values) {
+                auto la = lazy([a] { return a; });
+                auto lb = lazy([b] { return b; });
+                auto lc = lazy([c] { return c; });
+                Tribool lazy_r = ((la && (!lb || lc)) || (!la && lb)).eval();
+                Tribool eager_r = (a && (!b || c)) || (!a && b);
+                ok = ok && lazy_r.is_true() == eager_r.is_true() && lazy_r.is_false() == eager_r.is_false();
+            }
+        }
+    }
+    ASSUME_ITS_TRUE(ok);
+}
+
+// Test: Expressions over constexpr callables evaluate at compile time
+FOSSIL_TEST(cpp_test_lazy_constexpr) {
+    using fossil::type::Tribool;
+    using fossil::type::lazy;
+    constexpr auto rule = lazy([] { return Tribool(false); }) && lazy([] { return Tribool(); });
+    static_assert(rule.eval().is_false());
+    static_assert((!rule || Tribool()).eval().is_true());
+    ASSUME_ITS_TRUE(rule.eval().is_false());
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_lazy_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_lazy_suite, cpp_test_lazy_and_short_circuits);
+    FOSSIL_ADD_TEST(cpp_tribool_lazy_suite, cpp_test_lazy_or_short_circuits);
+    FOSSIL_ADD_TEST(cpp_tribool_lazy_suite, cpp_test_lazy_matches_eager);
+    FOSSIL_ADD_TEST(cpp_tribool_lazy_suite, cpp_test_lazy_constexpr);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_lazy_suite);
+}
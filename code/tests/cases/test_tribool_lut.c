@@ -0,0 +1,167 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include "tribool_sample.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_lut_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_lut_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_lut_suite) {
+    // Teardown code here
+}
+
+// A five-input rule built from the scalar ops: (a AND b) OR (c XOR d) OR NOT e
+static tribool c_lut_rule(const tribool *in, void *user) {
+    int *calls = (int *)user;
+    if (calls) (*calls)++;
+    tribool ab = fossil_type_tribool_and(in[0], in[1]);
+    tribool cd = fossil_type_tribool_xor(in[2], in[3]);
+    return fossil_type_tribool_or(fossil_type_tribool_or(ab, cd), fossil_type_tribool_not(in[4]));
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Rows are indexed with input 0 as the least significant base-3 digit
+FOSSIL_TEST(c_test_tribool_lut_row_order) {
+    // Two-input table: TRUE only for (in0 = UNKNOWN, in1 = TRUE), row 2 + 3 * 1 = 5
+    tribool table[9];
+    for (size_t r = 0; r < 9; r++) table[r] = FOSSIL_TYPE_TRIBOOL_FALSE;
+    table[5] = FOSSIL_TYPE_TRIBOOL_TRUE;
+    table[8] = (tribool)7; // stored as UNKNOWN
+
+    tribool_lut lut;
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_lut_compile(&lut, 2, table));
+    ASSUME_ITS_TRUE(lut.arity == 2 && lut.rows == 9);
+    tribool in[2] = {FOSSIL_TYPE_TRIBOOL_UNKNOWN, FOSSIL_TYPE_TRIBOOL_TRUE};
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_TRUE, fossil_type_tribool_lut_eval(&lut, in));
+    in[0] = FOSSIL_TYPE_TRIBOOL_TRUE;
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_FALSE, fossil_type_tribool_lut_eval(&lut, in));
+    in[0] = FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    in[1] = FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_UNKNOWN, fossil_type_tribool_lut_eval(&lut, in));
+
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_lut_compile(&lut, 6, table));
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_lut_compile(NULL, 2, table));
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_lut_compile_fn(&lut, 2, NULL, NULL));
+}
+
+// Test: A sampled callback is called once per row and matches it everywhere
+FOSSIL_TEST(c_test_tribool_lut_compile_fn) {
+    tribool_lut lut;
+    int calls = 0;
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_lut_compile_fn(&lut, 5, c_lut_rule, &calls));
+    ASSUME_ITS_EQUAL_I32(243, calls);
+    int ok = 1;
+    for (unsigned r = 0; r < 243; r++) {
+        tribool in[5];
+        unsigned x = r;
+        for (int i = 0; i < 5; i++, x /= 3) in[i] = (tribool)(x % 3);
+        if (fossil_type_tribool_lut_eval(&lut, in) != c_lut_rule(in, NULL)) ok = 0;
+    }
+    ASSUME_ITS_TRUE(ok);
+}
+
+// Test: The packed evaluator matches the scalar one for every arity and length
+FOSSIL_TEST(c_test_tribool_lut_run_matches_eval) {
+    const size_t lengths[] = {1, 31, 32, 33, 100, 1000};
+    tribool_vec cols[5], r;
+    const tribool_vec *inputs[5];
+    fossil_type_tribool_vec_init(&r, 0);
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        size_t n = lengths[l];
+        for (size_t c = 0; c < 5; c++) {
+            fossil_type_tribool_vec_init(&cols[c], n);
+            for (size_t i = 0; i < n; i++) fossil_type_tribool_vec_set(&cols[c], i, test_tribool_scrambled(c, 3u, i));
+            inputs[c] = &cols[c];
+        }
+        for (size_t arity = 1; arity <= 5; arity++) {
+            tribool table[243];
+            for (size_t row = 0; row < 243; row++) table[row] = test_tribool_scrambled(arity + 9, 3u, row);
+            tribool_lut lut;
+            fossil_type_tribool_lut_compile(&lut, arity, table);
+            ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_lut_run(&lut, &r, inputs, arity));
+            ASSUME_ITS_TRUE(r.length == n);
+            int ok = 1;
+            for (size_t i = 0; i < n; i++) {
+                tribool in[5];
+                for (size_t c = 0; c < arity; c++) in[c] = fossil_type_tribool_vec_get(&cols[c], i);
+                if (fossil_type_tribool_vec_get(&r, i) != fossil_type_tribool_lut_eval(&lut, in)) ok = 0;
+            }
+            ASSUME_ITS_TRUE(ok);
+            uint64_t tail = (n % 32) ? (1ULL << (2 * (n % 32))) - 1 : ~0ULL;
+            ASSUME_ITS_TRUE((r.words[FOSSIL_TYPE_TRIBOOL_VEC_WORDS(n) - 1] & ~tail) == 0);
+        }
+        for (size_t c = 0; c < 5; c++) fossil_type_tribool_vec_free(&cols[c]);
+    }
+    fossil_type_tribool_vec_free(&r);
+}
+
+// Test: The packed evaluator checks its inputs and allows dst to alias one
+FOSSIL_TEST(c_test_tribool_lut_run_args) {
+    tribool table[3] = {FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_UNKNOWN};
+    tribool_lut lut;
+    tribool_vec a, b;
+    fossil_type_tribool_lut_compile(&lut, 1, table);
+    fossil_type_tribool_vec_init(&a, 40);
+    fossil_type_tribool_vec_init(&b, 41);
+    fossil_type_tribool_vec_fill(&a, FOSSIL_TYPE_TRIBOOL_FALSE);
+    const tribool_vec *inputs[2] = {&a, &b};
+
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_lut_run(&lut, &a, inputs, 2));
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_lut_run(&lut, NULL, inputs, 1));
+    // The table is NOT and a holds only FALSE
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_lut_run(&lut, &a, inputs, 1));
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_true(&a) == 40);
+
+    // A constant of no inputs fills dst at its current length
+    fossil_type_tribool_lut_compile(&lut, 0, table);
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_lut_run(&lut, &b, NULL, 0));
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_true(&b) == 41);
+
+    fossil_type_tribool_vec_free(&a);
+    fossil_type_tribool_vec_free(&b);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_lut_tests) {
+    FOSSIL_ADD_TEST(c_tribool_lut_suite, c_test_tribool_lut_row_order);
+    FOSSIL_ADD_TEST(c_tribool_lut_suite, c_test_tribool_lut_compile_fn);
+    FOSSIL_ADD_TEST(c_tribool_lut_suite, c_test_tribool_lut_run_matches_eval);
+    FOSSIL_ADD_TEST(c_tribool_lut_suite, c_test_tribool_lut_run_args);
+
+    FOSSIL_ADD_SUITE(c_tribool_lut_suite);
+}
@@ -0,0 +1,100 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_lut_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_lut_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_lut_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TriboolLut compiled from a truth table
+FOSSIL_TEST(cpp_test_TriboolLut_table) {
+    using fossil::type::TriboolLut;
+    TriboolLut lut;
+    const tribool nand[9] = {
+        FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_TRUE,
+        FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_UNKNOWN,
+        FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_UNKNOWN, FOSSIL_TYPE_TRIBOOL_UNKNOWN,
+    };
+
+    ASSUME_ITS_TRUE(lut.arity() == 0);
+    ASSUME_ITS_FALSE(lut.compile(2, std::span<const tribool>(nand, 8)));
+    ASSUME_ITS_TRUE(lut.compile(2, nand));
+    ASSUME_ITS_TRUE(lut.arity() == 2);
+
+    const tribool tt[2] = {FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_TRUE};
+    const tribool fu[2] = {FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_UNKNOWN};
+    ASSUME_ITS_TRUE(lut(tt).is_false());
+    ASSUME_ITS_TRUE(lut(fu).is_true());
+    ASSUME_ITS_TRUE(lut(std::span<const tribool>(tt, 1)).is_unknown());
+}
+
+// Test: TriboolLut compiled from a lambda and run over packed columns
+FOSSIL_TEST(cpp_test_TriboolLut_lambda_run) {
+    using fossil::type::Tribool;
+    using fossil::type::TriboolLut;
+    using fossil::type::TriboolVec;
+    TriboolLut lut;
+    int calls = 0;
+    ASSUME_ITS_TRUE(lut.compile_fn(3, [&calls](const tribool *in) {
+        calls++;
+        return (Tribool(in[0]) && Tribool(in[1])).implies(Tribool(in[2]));
+    }));
+    ASSUME_ITS_TRUE(calls == 27);
+
+    TriboolVec a(2), b(2), c(2);
+    a.set(0, Tribool(true)); b.set(0, Tribool(true)); c.set(0, Tribool(false));
+    a.set(1, Tribool());     b.set(1, Tribool(true)); c.set(1, Tribool(true));
+    const tribool_vec *inputs[] = {a.raw(), b.raw(), c.raw()};
+    TriboolVec r = lut.run(inputs);
+    ASSUME_ITS_TRUE(r.size() == 2);
+    ASSUME_ITS_TRUE(r.get(0).is_false());
+    ASSUME_ITS_TRUE(r.get(1).is_true());
+    ASSUME_ITS_TRUE(lut.run(std::span<const tribool_vec* const>(inputs, 2)).size() == 0);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_lut_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_lut_suite, cpp_test_TriboolLut_table);
+    FOSSIL_ADD_TEST(cpp_tribool_lut_suite, cpp_test_TriboolLut_lambda_run);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_lut_suite);
+}
@@ -0,0 +1,171 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include "tribool_sample.h"
+#include <string.h>
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_par_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_par_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_par_suite) {
+    // Teardown code here
+}
+
+static void c_par_fill(tribool_vec *v, size_t seed, size_t n) {
+    fossil_type_tribool_vec_init(v, n);
+    for (size_t i = 0; i < n; i++) fossil_type_tribool_vec_set(v, i, test_tribool_scrambled(seed, 5u, i));
+}
+
+typedef struct {
+    unsigned char *hits;
+    size_t *chunk_begin;
+} c_par_cover;
+
+// Marks every item of a chunk; chunks never overlap, so no atomics are needed
+static void c_par_mark(void *ctx, size_t chunk, size_t begin, size_t end) {
+    c_par_cover *cover = (c_par_cover *)ctx;
+    cover->chunk_begin[chunk] = begin;
+    for (size_t i = begin; i < end; i++) cover->hits[i]++;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: pool_for visits every item exactly once, chunk by chunk
+FOSSIL_TEST(c_test_tribool_par_for_covers) {
+    enum { ITEMS = 10007, GRAIN = 13 };
+    static unsigned char hits[ITEMS];
+    static size_t chunk_begin[ITEMS / GRAIN + 1];
+    c_par_cover cover = { hits, chunk_begin };
+    tribool_pool pool;
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_pool_init(&pool, 4));
+    ASSUME_ITS_TRUE(pool.threads >= 1 && pool.threads <= 4);
+
+    for (int round = 0; round < 20; round++) {
+        memset(hits, 0, sizeof(hits));
+        ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_pool_for(&pool, ITEMS, GRAIN, c_par_mark, &cover));
+        int ok = 1;
+        for (size_t i = 0; i < ITEMS; i++) if (hits[i] != 1) ok = 0;
+        for (size_t c = 0; c < ITEMS / GRAIN + 1; c++) if (chunk_begin[c] != c * GRAIN) ok = 0;
+        ASSUME_ITS_TRUE(ok);
+    }
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_pool_for(&pool, ITEMS, GRAIN, NULL, &cover));
+    fossil_type_tribool_pool_free(&pool);
+    fossil_type_tribool_pool_free(&pool);
+
+    // Without a pool the chunks run on the caller
+    memset(hits, 0, sizeof(hits));
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_pool_for(NULL, ITEMS, GRAIN, c_par_mark, &cover));
+    ASSUME_ITS_TRUE(hits[0] == 1 && hits[ITEMS - 1] == 1);
+}
+
+// Test: Parallel element-wise ops match the serial ones for any thread count
+FOSSIL_TEST(c_test_tribool_par_ops_match_serial) {
+    const size_t threads[] = {1, 2, 3, 8};
+    tribool_vec a, b, want, got;
+    c_par_fill(&a, 1, 5000);
+    c_par_fill(&b, 2, 5000);
+    fossil_type_tribool_vec_init(&want, 0);
+    fossil_type_tribool_vec_init(&got, 0);
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        tribool_pool pool;
+        fossil_type_tribool_pool_init(&pool, threads[t]);
+        fossil_type_tribool_pool_set_grain(&pool, 3);
+
+        fossil_type_tribool_vec_and(&want, &a, &b);
+        ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_vec_and_par(&pool, &got, &a, &b));
+        ASSUME_ITS_TRUE(memcmp(want.words, got.words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(5000) * 8) == 0);
+        fossil_type_tribool_vec_or(&want, &a, &b);
+        ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_vec_or_par(&pool, &got, &a, &b));
+        ASSUME_ITS_TRUE(memcmp(want.words, got.words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(5000) * 8) == 0);
+        fossil_type_tribool_vec_not(&want, &a);
+        ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_vec_not_par(&pool, &got, &a));
+        ASSUME_ITS_TRUE(memcmp(want.words, got.words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(5000) * 8) == 0);
+
+        fossil_type_tribool_pool_free(&pool);
+    }
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_vec_and_par(NULL, &got, &a, &b));
+    fossil_type_tribool_vec_resize(&b, 4999);
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_vec_or_par(NULL, &got, &a, &b));
+    fossil_type_tribool_vec_free(&a);
+    fossil_type_tribool_vec_free(&b);
+    fossil_type_tribool_vec_free(&want);
+    fossil_type_tribool_vec_free(&got);
+}
+
+// Test: Parallel reductions give the serial answer for any thread count
+FOSSIL_TEST(c_test_tribool_par_reductions) {
+    tribool_vec v;
+    c_par_fill(&v, 3, 20000);
+    tribool_pool pool;
+    fossil_type_tribool_pool_init(&pool, 4);
+    fossil_type_tribool_pool_set_grain(&pool, 2);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_true_par(&pool, &v) == fossil_type_tribool_vec_count_true(&v));
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_false_par(&pool, &v) == fossil_type_tribool_vec_count_false(&v));
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_unknown_par(&pool, &v) == fossil_type_tribool_vec_count_unknown(&v));
+
+    // A partial last word: padding lanes must not count as FALSE
+    tribool_vec odd;
+    c_par_fill(&odd, 5, 19999);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_false_par(&pool, &odd) == fossil_type_tribool_vec_count_false(&odd));
+    fossil_type_tribool_vec_free(&odd);
+
+    ASSUME_ITS_EQUAL_I32(fossil_type_tribool_vec_all(&v), fossil_type_tribool_vec_all_par(&pool, &v));
+    ASSUME_ITS_EQUAL_I32(fossil_type_tribool_vec_any(&v), fossil_type_tribool_vec_any_par(&pool, &v));
+
+    // All TRUE but one UNKNOWN lane near the end, then one FALSE lane at the start
+    fossil_type_tribool_vec_fill(&v, FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_TRUE, fossil_type_tribool_vec_all_par(&pool, &v));
+    fossil_type_tribool_vec_set(&v, 19990, FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_UNKNOWN, fossil_type_tribool_vec_all_par(&pool, &v));
+    fossil_type_tribool_vec_set(&v, 3, FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_FALSE, fossil_type_tribool_vec_all_par(&pool, &v));
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_TRUE, fossil_type_tribool_vec_any_par(&pool, &v));
+
+    fossil_type_tribool_pool_free(&pool);
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_TRUE, fossil_type_tribool_vec_all_par(NULL, NULL));
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_true_par(NULL, &v) == 19998);
+    fossil_type_tribool_vec_free(&v);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_par_tests) {
+    FOSSIL_ADD_TEST(c_tribool_par_suite, c_test_tribool_par_for_covers);
+    FOSSIL_ADD_TEST(c_tribool_par_suite, c_test_tribool_par_ops_match_serial);
+    FOSSIL_ADD_TEST(c_tribool_par_suite, c_test_tribool_par_reductions);
+
+    FOSSIL_ADD_SUITE(c_tribool_par_suite);
+}
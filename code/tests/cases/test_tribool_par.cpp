@@ -0,0 +1,90 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_par_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_par_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_par_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TriboolPool runs a lambda over every item
+FOSSIL_TEST(cpp_test_TriboolPool_parallel_for) {
+    fossil::type::TriboolPool pool(3);
+    std::vector<int> hits(1000, 0);
+    ASSUME_ITS_TRUE(pool.threads() >= 1);
+    pool.parallel_for(hits.size(), 7, [&hits](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) hits[i]++;
+    });
+    bool ok = true;
+    for (int h : hits) ok = ok && h == 1;
+    ASSUME_ITS_TRUE(ok);
+}
+
+// Test: TriboolPool bulk operations and reductions
+FOSSIL_TEST(cpp_test_TriboolPool_ops) {
+    using fossil::type::Tribool;
+    using fossil::type::TriboolVec;
+    fossil::type::TriboolPool pool(2);
+    pool.set_grain(1);
+    TriboolVec a(100), b(100);
+    a.fill(Tribool(true));
+    b.fill(Tribool(false));
+    b.set(50, Tribool());
+
+    ASSUME_ITS_TRUE(pool.logical_and(a, b).get(0).is_false());
+    ASSUME_ITS_TRUE(pool.logical_and(a, b).get(50).is_unknown());
+    ASSUME_ITS_TRUE(pool.logical_or(a, b).get(0).is_true());
+    ASSUME_ITS_TRUE(pool.logical_not(b).get(0).is_true());
+    ASSUME_ITS_TRUE(pool.all(a).is_true());
+    ASSUME_ITS_TRUE(pool.any(b).is_unknown());
+    ASSUME_ITS_TRUE(pool.count_true(a) == 100);
+    ASSUME_ITS_TRUE(pool.count_false(b) == 99);
+    ASSUME_ITS_TRUE(pool.count_unknown(b) == 1);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_par_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_par_suite, cpp_test_TriboolPool_parallel_for);
+    FOSSIL_ADD_TEST(cpp_tribool_par_suite, cpp_test_TriboolPool_ops);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_par_suite);
+}
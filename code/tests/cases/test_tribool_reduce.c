@@ -0,0 +1,176 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include "tribool_sample.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_reduce_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_reduce_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_reduce_suite) {
+    // Teardown code here
+}
+
+#define C_TRIBOOL_REDUCE_MAX 1000
+
+// Fills values with `fill`, then plants `mark` at index `at` (if in range)
+static void c_tribool_reduce_fill(tribool *values, size_t count, tribool fill, size_t at, tribool mark) {
+    for (size_t i = 0; i < count; i++) values[i] = fill;
+    if (at < count) values[at] = mark;
+}
+
+// Scalar reference fold with fossil_type_tribool_and/or
+static tribool c_tribool_reduce_fold(const tribool *values, size_t count, int use_and) {
+    tribool acc = use_and ? FOSSIL_TYPE_TRIBOOL_TRUE : FOSSIL_TYPE_TRIBOOL_FALSE;
+    for (size_t i = 0; i < count; i++) {
+        acc = use_and ? fossil_type_tribool_and(acc, values[i]) : fossil_type_tribool_or(acc, values[i]);
+    }
+    return acc;
+}
+
+// Checks the array, packed and sliced reductions against the reference; returns 1 on agreement
+static int c_tribool_reduce_agree(const tribool *values, size_t count) {
+    tribool_vec v;
+    tribool_slice s[FOSSIL_TYPE_TRIBOOL_SLICE_COUNT(C_TRIBOOL_REDUCE_MAX)];
+    size_t t = 0, f = 0, u = 0, first = FOSSIL_TYPE_TRIBOOL_NPOS;
+    tribool all = c_tribool_reduce_fold(values, count, 1);
+    tribool any = c_tribool_reduce_fold(values, count, 0);
+    int ok = 1;
+
+    for (size_t i = 0; i < count; i++) {
+        if (values[i] == FOSSIL_TYPE_TRIBOOL_TRUE) t++;
+        else if (values[i] == FOSSIL_TYPE_TRIBOOL_FALSE) f++;
+        else {
+            u++;
+            if (first == FOSSIL_TYPE_TRIBOOL_NPOS) first = i;
+        }
+    }
+
+    ok &= fossil_type_tribool_all(values, count) == all;
+    ok &= fossil_type_tribool_any(values, count) == any;
+    ok &= fossil_type_tribool_none(values, count) == fossil_type_tribool_not(any);
+    ok &= fossil_type_tribool_count_true(values, count) == t;
+    ok &= fossil_type_tribool_count_false(values, count) == f;
+    ok &= fossil_type_tribool_count_unknown(values, count) == u;
+    ok &= fossil_type_tribool_find_first_unknown(values, count) == first;
+
+    fossil_type_tribool_vec_init(&v, 0);
+    fossil_type_tribool_vec_pack(&v, values, count);
+    ok &= fossil_type_tribool_vec_all(&v) == all;
+    ok &= fossil_type_tribool_vec_any(&v) == any;
+    ok &= fossil_type_tribool_vec_none(&v) == fossil_type_tribool_not(any);
+    ok &= fossil_type_tribool_vec_count_true(&v) == t;
+    ok &= fossil_type_tribool_vec_count_false(&v) == f;
+    ok &= fossil_type_tribool_vec_count_unknown(&v) == u;
+    ok &= fossil_type_tribool_vec_find_first_unknown(&v) == first;
+    fossil_type_tribool_vec_free(&v);
+
+    // Lanes past count are UNKNOWN and must be ignored
+    fossil_type_tribool_slices_pack(s, values, count);
+    ok &= fossil_type_tribool_slices_all(s, count) == all;
+    ok &= fossil_type_tribool_slices_any(s, count) == any;
+    ok &= fossil_type_tribool_slices_none(s, count) == fossil_type_tribool_not(any);
+    ok &= fossil_type_tribool_slices_count_true(s, count) == t;
+    ok &= fossil_type_tribool_slices_count_false(s, count) == f;
+    ok &= fossil_type_tribool_slices_count_unknown(s, count) == u;
+    ok &= fossil_type_tribool_slices_find_first_unknown(s, count) == first;
+    return ok;
+}
+
+static const size_t c_tribool_reduce_sizes[] = {0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 257, 999, 1000};
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Empty inputs reduce to the identities
+FOSSIL_TEST(c_test_tribool_reduce_empty) {
+    tribool one = FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_all(&one, 0) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_any(&one, 0) == FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_none(NULL, 0) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_count_unknown(NULL, 5) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_find_first_unknown(&one, 0) == FOSSIL_TYPE_TRIBOOL_NPOS);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_all(NULL) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_find_first_unknown(NULL) == FOSSIL_TYPE_TRIBOOL_NPOS);
+    ASSUME_ITS_TRUE(fossil_type_tribool_slices_any(NULL, 0) == FOSSIL_TYPE_TRIBOOL_FALSE);
+}
+
+// Test: A single planted value decides the result at every position
+FOSSIL_TEST(c_test_tribool_reduce_planted) {
+    static tribool values[C_TRIBOOL_REDUCE_MAX];
+    const tribool fills[] = {FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_FALSE};
+    const tribool marks[] = {FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_UNKNOWN};
+    int ok = 1;
+
+    for (size_t n = 0; n < sizeof(c_tribool_reduce_sizes) / sizeof(c_tribool_reduce_sizes[0]); n++) {
+        size_t count = c_tribool_reduce_sizes[n];
+        for (size_t fi = 0; fi < 2; fi++) {
+            for (size_t mi = 0; mi < 3; mi++) {
+                for (size_t at = 0; at <= count; at += (count / 7) + 1) {
+                    c_tribool_reduce_fill(values, count, fills[fi], at, marks[mi]);
+                    ok &= c_tribool_reduce_agree(values, count);
+                }
+                c_tribool_reduce_fill(values, count, fills[fi], count ? count - 1 : 0, marks[mi]);
+                ok &= c_tribool_reduce_agree(values, count);
+            }
+        }
+    }
+    ASSUME_ITS_TRUE(ok);
+}
+
+// Test: Mixed inputs agree across array, packed and sliced forms
+FOSSIL_TEST(c_test_tribool_reduce_mixed) {
+    static tribool values[C_TRIBOOL_REDUCE_MAX];
+    int ok = 1;
+
+    for (size_t n = 0; n < sizeof(c_tribool_reduce_sizes) / sizeof(c_tribool_reduce_sizes[0]); n++) {
+        size_t count = c_tribool_reduce_sizes[n];
+        for (size_t i = 0; i < count; i++) values[i] = test_tribool_mix(i, 0x5bd1u);
+        ok &= c_tribool_reduce_agree(values, count);
+    }
+    ASSUME_ITS_TRUE(ok);
+    ASSUME_ITS_TRUE(fossil_type_tribool_count_true(values, 9) + fossil_type_tribool_count_false(values, 9) +
+                    fossil_type_tribool_count_unknown(values, 9) == 9);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_reduce_tests) {
+    FOSSIL_ADD_TEST(c_tribool_reduce_suite, c_test_tribool_reduce_empty);
+    FOSSIL_ADD_TEST(c_tribool_reduce_suite, c_test_tribool_reduce_planted);
+    FOSSIL_ADD_TEST(c_tribool_reduce_suite, c_test_tribool_reduce_mixed);
+
+    FOSSIL_ADD_SUITE(c_tribool_reduce_suite);
+}
@@ -0,0 +1,98 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_reduce_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_reduce_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_reduce_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Span reductions over Tribool and raw tribool storage
+FOSSIL_TEST(cpp_test_Tribool_span_reductions) {
+    using fossil::type::Tribool;
+    std::vector<Tribool> values(100, Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+
+    ASSUME_ITS_TRUE(Tribool::all(values).is_true());
+    ASSUME_ITS_TRUE(Tribool::any(values).is_true());
+    ASSUME_ITS_TRUE(Tribool::none(values).is_false());
+
+    values[70] = Tribool(FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(Tribool::all(values).is_unknown());
+    ASSUME_ITS_TRUE(Tribool::find_first_unknown(values) == 70);
+    ASSUME_ITS_TRUE(Tribool::count_unknown(values) == 1);
+
+    values[3] = Tribool(FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(Tribool::all(values).is_false());
+    ASSUME_ITS_TRUE(Tribool::count_true(values) == 98);
+    ASSUME_ITS_TRUE(Tribool::count_false(values) == 1);
+
+    tribool raw[] = {FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_UNKNOWN, FOSSIL_TYPE_TRIBOOL_FALSE};
+    ASSUME_ITS_TRUE(Tribool::any(raw).is_unknown());
+    ASSUME_ITS_TRUE(Tribool::none(raw).is_unknown());
+}
+
+// Test: TriboolVec reduction members
+FOSSIL_TEST(cpp_test_TriboolVec_reductions) {
+    fossil::type::TriboolVec v(200);
+
+    ASSUME_ITS_TRUE(v.all().is_unknown());
+    ASSUME_ITS_TRUE(v.count_unknown() == 200);
+    ASSUME_ITS_TRUE(v.find_first_unknown() == 0);
+
+    v.fill(fossil::type::Tribool(FOSSIL_TYPE_TRIBOOL_FALSE));
+    ASSUME_ITS_TRUE(v.any().is_false());
+    ASSUME_ITS_TRUE(v.none().is_true());
+    ASSUME_ITS_TRUE(v.find_first_unknown() == FOSSIL_TYPE_TRIBOOL_NPOS);
+
+    v.set(199, fossil::type::Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    ASSUME_ITS_TRUE(v.any().is_true());
+    ASSUME_ITS_TRUE(v.count_true() == 1);
+    ASSUME_ITS_TRUE(v.count_false() == 199);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_reduce_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_reduce_suite, cpp_test_Tribool_span_reductions);
+    FOSSIL_ADD_TEST(cpp_tribool_reduce_suite, cpp_test_TriboolVec_reductions);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_reduce_suite);
+}
@@ -0,0 +1,142 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include "tribool_sample.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_rle_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_rle_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_rle_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Appends merge equal neighbours and the run index answers lookups
+FOSSIL_TEST(c_test_tribool_rle_append_get) {
+    tribool_rle r;
+    fossil_type_tribool_rle_init(&r);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_append_run(&r, FOSSIL_TYPE_TRIBOOL_UNKNOWN, 1000000) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_append(&r, FOSSIL_TYPE_TRIBOOL_TRUE) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_append(&r, FOSSIL_TYPE_TRIBOOL_TRUE) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_append_run(&r, (tribool)9, 5) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_append_run(&r, FOSSIL_TYPE_TRIBOOL_FALSE, 0) == 0);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_length(&r) == 1000007);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_runs(&r) == 3);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_get(&r, 999999) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_get(&r, 1000000) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_get(&r, 1000002) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_find_run(&r, 1000001) == 1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_find_run(&r, 1000007) == FOSSIL_TYPE_TRIBOOL_NPOS);
+
+    fossil_type_tribool_rle_free(&r);
+}
+
+// Test: Run-level logic matches row-wise scalar logic
+FOSSIL_TEST(c_test_tribool_rle_logic_matches_scalar) {
+    static tribool xa[500], xb[500], out[500];
+    tribool_rle a, b, r;
+    int ok = 1;
+
+    for (size_t i = 0; i < 500; i++) {
+        xa[i] = test_tribool_sparse(i, 1);
+        xb[i] = test_tribool_sparse(i, 3);
+    }
+    fossil_type_tribool_rle_init(&a);
+    fossil_type_tribool_rle_init(&b);
+    fossil_type_tribool_rle_init(&r);
+    fossil_type_tribool_rle_pack(&a, xa, 500);
+    fossil_type_tribool_rle_pack(&b, xb, 500);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_runs(&a) < 500);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_and(&r, &a, &b) == 0);
+    fossil_type_tribool_rle_unpack(&r, out);
+    for (size_t i = 0; i < 500; i++) ok &= out[i] == fossil_type_tribool_and(xa[i], xb[i]);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_or(&r, &a, &b) == 0);
+    fossil_type_tribool_rle_unpack(&r, out);
+    for (size_t i = 0; i < 500; i++) ok &= out[i] == fossil_type_tribool_or(xa[i], xb[i]);
+
+    // In place on the first operand
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_not(&a, &a) == 0);
+    fossil_type_tribool_rle_unpack(&a, out);
+    for (size_t i = 0; i < 500; i++) ok &= out[i] == fossil_type_tribool_not(xa[i]);
+
+    // Results never hold two equal neighbouring runs
+    for (size_t i = 1; i < r.runs; i++) ok &= r.values[i] != r.values[i - 1];
+    ASSUME_ITS_TRUE(ok);
+
+    fossil_type_tribool_rle_free(&a);
+    fossil_type_tribool_rle_free(&b);
+    fossil_type_tribool_rle_free(&r);
+}
+
+// Test: Expanding into a packed vector and rejecting mismatched lengths
+FOSSIL_TEST(c_test_tribool_rle_to_vec) {
+    tribool_rle a, b;
+    tribool_vec v;
+    int ok = 1;
+
+    fossil_type_tribool_rle_init(&a);
+    fossil_type_tribool_rle_init(&b);
+    fossil_type_tribool_vec_init(&v, 0);
+    fossil_type_tribool_rle_append_run(&a, FOSSIL_TYPE_TRIBOOL_FALSE, 31);
+    fossil_type_tribool_rle_append_run(&a, FOSSIL_TYPE_TRIBOOL_TRUE, 70);
+    fossil_type_tribool_rle_append_run(&a, FOSSIL_TYPE_TRIBOOL_UNKNOWN, 3);
+    fossil_type_tribool_rle_append_run(&b, FOSSIL_TYPE_TRIBOOL_TRUE, 10);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_to_vec(&v, &a) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_length(&v) == 104);
+    for (size_t i = 0; i < 104; i++) ok &= fossil_type_tribool_vec_get(&v, i) == fossil_type_tribool_rle_get(&a, i);
+    ASSUME_ITS_TRUE(ok);
+    ASSUME_ITS_TRUE(fossil_type_tribool_rle_and(&b, &a, &b) == -1);
+
+    fossil_type_tribool_rle_free(&a);
+    fossil_type_tribool_rle_free(&b);
+    fossil_type_tribool_vec_free(&v);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_rle_tests) {
+    FOSSIL_ADD_TEST(c_tribool_rle_suite, c_test_tribool_rle_append_get);
+    FOSSIL_ADD_TEST(c_tribool_rle_suite, c_test_tribool_rle_logic_matches_scalar);
+    FOSSIL_ADD_TEST(c_tribool_rle_suite, c_test_tribool_rle_to_vec);
+
+    FOSSIL_ADD_SUITE(c_tribool_rle_suite);
+}
@@ -0,0 +1,80 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <utility>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_rle_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_rle_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_rle_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TriboolRle append, lookup and operators
+FOSSIL_TEST(cpp_test_TriboolRle_operators) {
+    using fossil::type::Tribool;
+    using fossil::type::TriboolRle;
+    TriboolRle a, b;
+
+    a.append(Tribool(), 100);
+    a.append(Tribool(FOSSIL_TYPE_TRIBOOL_TRUE), 10);
+    b.append(Tribool(FOSSIL_TYPE_TRIBOOL_FALSE), 50);
+    b.append(Tribool(), 60);
+
+    TriboolRle r_and = a && b;
+    TriboolRle r_or = a || b;
+    TriboolRle r_not = !a;
+
+    ASSUME_ITS_TRUE(r_and.size() == 110);
+    ASSUME_ITS_TRUE(r_and.get(10).is_false());
+    ASSUME_ITS_TRUE(r_and.get(60).is_unknown());
+    ASSUME_ITS_TRUE(r_and.runs() == 2);
+    ASSUME_ITS_TRUE(r_or.get(105).is_true());
+    ASSUME_ITS_TRUE(r_not.get(105).is_false());
+
+    TriboolRle moved = std::move(r_or);
+    ASSUME_ITS_TRUE(moved.size() == 110 && r_or.size() == 0);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_rle_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_rle_suite, cpp_test_TriboolRle_operators);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_rle_suite);
+}
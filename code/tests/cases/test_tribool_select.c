@@ -0,0 +1,162 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_select_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_select_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_select_suite) {
+    // Teardown code here
+}
+
+#define C_TRIBOOL_SELECT_MAX 1000
+
+// Deterministic mix of all three values with long TRUE and FALSE stretches
+static void c_tribool_select_fill(tribool *values, size_t count, unsigned seed) {
+    unsigned x = seed * 2654435761u + 1u;
+    for (size_t i = 0; i < count; i++) {
+        x = x * 1103515245u + 12345u;
+        unsigned r = (x >> 16) % 8u;
+        values[i] = r < 3 ? FOSSIL_TYPE_TRIBOOL_TRUE : r < 6 ? FOSSIL_TYPE_TRIBOOL_FALSE : FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+        if ((i / 100) % 3 == 1) values[i] = FOSSIL_TYPE_TRIBOOL_TRUE;
+    }
+}
+
+// Scalar reference selection
+static size_t c_tribool_select_ref(u32 *dst, const tribool *values, size_t count, tribool match) {
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (values[i] == match) dst[n++] = (u32)i;
+    }
+    return n;
+}
+
+// Returns 1 when the first n entries of a and b agree
+static int c_tribool_select_same(const u32 *a, const u32 *b, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] != b[i]) return 0;
+    }
+    return 1;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Array selection matches the scalar reference for every value and many lengths
+FOSSIL_TEST(c_test_tribool_select_array) {
+    static tribool values[C_TRIBOOL_SELECT_MAX];
+    static u32 got[C_TRIBOOL_SELECT_MAX], want[C_TRIBOOL_SELECT_MAX];
+    const tribool matches[3] = { FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_UNKNOWN };
+    const size_t lengths[] = { 0, 1, 7, 8, 63, 64, 65, 128, 200, 511, C_TRIBOOL_SELECT_MAX };
+
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        c_tribool_select_fill(values, lengths[l], (unsigned)l);
+        for (size_t m = 0; m < 3; m++) {
+            size_t n = fossil_type_tribool_select(got, values, lengths[l], matches[m]);
+            ASSUME_ITS_TRUE(n == c_tribool_select_ref(want, values, lengths[l], matches[m]));
+            ASSUME_ITS_TRUE(c_tribool_select_same(got, want, n));
+        }
+    }
+}
+
+// Test: Packed vector selection agrees with array selection
+FOSSIL_TEST(c_test_tribool_select_vec) {
+    static tribool values[C_TRIBOOL_SELECT_MAX];
+    static u32 got[C_TRIBOOL_SELECT_MAX], want[C_TRIBOOL_SELECT_MAX];
+    const tribool matches[3] = { FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_UNKNOWN };
+    const size_t lengths[] = { 0, 5, 32, 33, 64, 97, 256, 999 };
+    tribool_vec v;
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_init(&v, 0) == 0);
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        c_tribool_select_fill(values, lengths[l], (unsigned)l + 7u);
+        ASSUME_ITS_TRUE(fossil_type_tribool_vec_pack(&v, values, lengths[l]) == 0);
+        for (size_t m = 0; m < 3; m++) {
+            size_t n = fossil_type_tribool_vec_select(got, &v, matches[m]);
+            ASSUME_ITS_TRUE(n == c_tribool_select_ref(want, values, lengths[l], matches[m]));
+            ASSUME_ITS_TRUE(c_tribool_select_same(got, want, n));
+        }
+    }
+    fossil_type_tribool_vec_free(&v);
+}
+
+// Test: Split selection yields the TRUE and UNKNOWN lists in one pass
+FOSSIL_TEST(c_test_tribool_select_split) {
+    static tribool values[C_TRIBOOL_SELECT_MAX];
+    static u32 t[C_TRIBOOL_SELECT_MAX], u[C_TRIBOOL_SELECT_MAX], want[C_TRIBOOL_SELECT_MAX];
+    size_t nu = 0;
+    tribool_vec v;
+
+    c_tribool_select_fill(values, 333, 3);
+    size_t nt = fossil_type_tribool_select_split(t, u, &nu, values, 333);
+    ASSUME_ITS_TRUE(nt == c_tribool_select_ref(want, values, 333, FOSSIL_TYPE_TRIBOOL_TRUE));
+    ASSUME_ITS_TRUE(c_tribool_select_same(t, want, nt));
+    ASSUME_ITS_TRUE(nu == c_tribool_select_ref(want, values, 333, FOSSIL_TYPE_TRIBOOL_UNKNOWN));
+    ASSUME_ITS_TRUE(c_tribool_select_same(u, want, nu));
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_init(&v, 0) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_pack(&v, values, 333) == 0);
+    nu = 0;
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_select_split(t, u, &nu, &v) == nt);
+    ASSUME_ITS_TRUE(nu == c_tribool_select_ref(want, values, 333, FOSSIL_TYPE_TRIBOOL_UNKNOWN));
+    ASSUME_ITS_TRUE(c_tribool_select_same(u, want, nu));
+    fossil_type_tribool_vec_free(&v);
+}
+
+// Test: Invalid arguments select nothing and a kernel name is reported
+FOSSIL_TEST(c_test_tribool_select_invalid) {
+    tribool values[2] = { FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_TRUE };
+    u32 out[2];
+    size_t nu = 5;
+    const char *kernel = fossil_type_tribool_select_kernel();
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_select(NULL, values, 2, FOSSIL_TYPE_TRIBOOL_TRUE) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_select(out, NULL, 2, FOSSIL_TYPE_TRIBOOL_TRUE) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_select_split(out, NULL, &nu, values, 2) == 0);
+    ASSUME_ITS_TRUE(nu == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_select(out, NULL, FOSSIL_TYPE_TRIBOOL_TRUE) == 0);
+    ASSUME_ITS_TRUE(kernel != NULL && kernel[0] != '\0');
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_select_tests) {
+    FOSSIL_ADD_TEST(c_tribool_select_suite, c_test_tribool_select_array);
+    FOSSIL_ADD_TEST(c_tribool_select_suite, c_test_tribool_select_vec);
+    FOSSIL_ADD_TEST(c_tribool_select_suite, c_test_tribool_select_split);
+    FOSSIL_ADD_TEST(c_tribool_select_suite, c_test_tribool_select_invalid);
+
+    FOSSIL_ADD_SUITE(c_tribool_select_suite);
+}
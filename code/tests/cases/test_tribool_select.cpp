@@ -0,0 +1,86 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_select_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_select_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_select_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: select over a span of Tribool values
+FOSSIL_TEST(cpp_test_tribool_select_span) {
+    using fossil::type::Tribool;
+    std::vector<Tribool> values(100, Tribool(FOSSIL_TYPE_TRIBOOL_FALSE));
+    values[3] = Tribool(FOSSIL_TYPE_TRIBOOL_TRUE);
+    values[70] = Tribool(FOSSIL_TYPE_TRIBOOL_TRUE);
+    values[99] = Tribool(FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+
+    std::vector<u32> t = fossil::type::select(values);
+    std::vector<u32> u = fossil::type::select(values, Tribool(FOSSIL_TYPE_TRIBOOL_UNKNOWN));
+    std::vector<u32> f = fossil::type::select(values, Tribool(FOSSIL_TYPE_TRIBOOL_FALSE));
+
+    ASSUME_ITS_TRUE(t == std::vector<u32>({3, 70}));
+    ASSUME_ITS_TRUE(u == std::vector<u32>({99}));
+    ASSUME_ITS_TRUE(f.size() == 97);
+}
+
+// Test: select over a packed TriboolVec
+FOSSIL_TEST(cpp_test_tribool_select_vec) {
+    using fossil::type::Tribool;
+    fossil::type::TriboolVec v(80);
+    v.fill(Tribool(FOSSIL_TYPE_TRIBOOL_FALSE));
+    v.set(0, Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    v.set(64, Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    v.set(79, Tribool(FOSSIL_TYPE_TRIBOOL_UNKNOWN));
+
+    ASSUME_ITS_TRUE(fossil::type::select(v) == std::vector<u32>({0, 64}));
+    ASSUME_ITS_TRUE(fossil::type::select(v, Tribool(FOSSIL_TYPE_TRIBOOL_UNKNOWN)) == std::vector<u32>({79}));
+    ASSUME_ITS_TRUE(fossil::type::select(fossil::type::TriboolVec()).empty());
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_select_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_select_suite, cpp_test_tribool_select_span);
+    FOSSIL_ADD_TEST(cpp_tribool_select_suite, cpp_test_tribool_select_vec);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_select_suite);
+}
@@ -0,0 +1,125 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include "tribool_sample.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_slice_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_slice_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_slice_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Slice lane access and plane normalization
+FOSSIL_TEST(c_test_tribool_slice_access) {
+    tribool_slice s = fossil_type_tribool_slice_make(0x5, 0xF);
+    ASSUME_ITS_TRUE(s.truth == 0x5);
+    ASSUME_ITS_TRUE(fossil_type_tribool_slice_get(s, 0) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_slice_get(s, 1) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+
+    fossil_type_tribool_slice_set(&s, 1, FOSSIL_TYPE_TRIBOOL_FALSE);
+    fossil_type_tribool_slice_set(&s, 63, FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_slice_get(s, 1) == FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_slice_get(s, 63) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_slice_get(s, 64) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+
+    tribool_slice f = fossil_type_tribool_slice_fill(FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(f.known == ~0ULL && f.truth == 0);
+}
+
+// Test: Plane AND/OR/NOT agree with the scalar operations
+FOSSIL_TEST(c_test_tribool_slice_logic_matches_scalar) {
+    enum { N = 200 };
+    tribool a[N], b[N], out[N];
+    tribool_slice sa[4], sb[4], sr[4];
+    for (size_t i = 0; i < N; i++) {
+        a[i] = test_tribool_mix(i, 3);
+        b[i] = test_tribool_mix(i, 9);
+    }
+    fossil_type_tribool_slices_pack(sa, a, N);
+    fossil_type_tribool_slices_pack(sb, b, N);
+
+    fossil_type_tribool_slices_and(sr, sa, sb, 4);
+    fossil_type_tribool_slices_unpack(out, sr, N);
+    for (size_t i = 0; i < N; i++) ASSUME_ITS_TRUE(out[i] == fossil_type_tribool_and(a[i], b[i]));
+
+    fossil_type_tribool_slices_or(sr, sa, sb, 4);
+    fossil_type_tribool_slices_unpack(out, sr, N);
+    for (size_t i = 0; i < N; i++) ASSUME_ITS_TRUE(out[i] == fossil_type_tribool_or(a[i], b[i]));
+
+    fossil_type_tribool_slices_not(sr, sa, 4);
+    fossil_type_tribool_slices_unpack(out, sr, N);
+    for (size_t i = 0; i < N; i++) ASSUME_ITS_TRUE(out[i] == fossil_type_tribool_not(a[i]));
+}
+
+// Test: Conversion between packed vectors and slices
+FOSSIL_TEST(c_test_tribool_slice_vec_conversion) {
+    enum { N = 150 };
+    tribool src[N];
+    tribool_slice slices[3];
+    tribool_vec v, back;
+    for (size_t i = 0; i < N; i++) src[i] = test_tribool_mix(i, 5);
+
+    fossil_type_tribool_vec_init(&v, 0);
+    fossil_type_tribool_vec_init(&back, 0);
+    fossil_type_tribool_vec_pack(&v, src, N);
+
+    fossil_type_tribool_vec_to_slices(slices, &v);
+    for (size_t i = 0; i < N; i++) {
+        ASSUME_ITS_TRUE(fossil_type_tribool_slice_get(slices[i / 64], (unsigned)(i % 64)) == src[i]);
+    }
+    ASSUME_ITS_TRUE(fossil_type_tribool_slice_get(slices[2], 40) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_from_slices(&back, slices, N) == 0);
+    for (size_t i = 0; i < N; i++) {
+        ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&back, i) == src[i]);
+    }
+
+    fossil_type_tribool_vec_free(&v);
+    fossil_type_tribool_vec_free(&back);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_slice_tests) {
+    FOSSIL_ADD_TEST(c_tribool_slice_suite, c_test_tribool_slice_access);
+    FOSSIL_ADD_TEST(c_tribool_slice_suite, c_test_tribool_slice_logic_matches_scalar);
+    FOSSIL_ADD_TEST(c_tribool_slice_suite, c_test_tribool_slice_vec_conversion);
+
+    FOSSIL_ADD_SUITE(c_tribool_slice_suite);
+}
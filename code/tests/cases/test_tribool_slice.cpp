@@ -0,0 +1,87 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_slice_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_slice_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_slice_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TriboolSlice built from Flags planes
+FOSSIL_TEST(cpp_test_TriboolSlice_flags) {
+    using fossil::type::Flags;
+    fossil::type::TriboolSlice s(Flags(0x3), Flags(0x1));
+
+    ASSUME_ITS_TRUE(s.get(0).is_true());
+    ASSUME_ITS_TRUE(s.get(1).is_false());
+    ASSUME_ITS_TRUE(s.get(2).is_unknown());
+    ASSUME_ITS_TRUE(s.known() == Flags(0x3));
+    ASSUME_ITS_TRUE(s.truth() == Flags(0x1));
+}
+
+// Test: TriboolSlice lane-wise operators
+FOSSIL_TEST(cpp_test_TriboolSlice_operators) {
+    using fossil::type::Flags;
+    using fossil::type::TriboolSlice;
+    TriboolSlice a(Flags(0x3), Flags(0x1)); // T, F, U...
+    TriboolSlice b(Flags(0x6), Flags(0x6)); // U, T, T, U...
+
+    TriboolSlice r_and = a && b;
+    TriboolSlice r_or = a || b;
+    TriboolSlice r_not = !a;
+
+    ASSUME_ITS_TRUE(r_and.get(0).is_unknown());
+    ASSUME_ITS_TRUE(r_and.get(1).is_false());
+    ASSUME_ITS_TRUE(r_and.get(2).is_unknown());
+    ASSUME_ITS_TRUE(r_or.get(0).is_true());
+    ASSUME_ITS_TRUE(r_or.get(1).is_true());
+    ASSUME_ITS_TRUE(r_or.get(3).is_unknown());
+    ASSUME_ITS_TRUE(r_not.get(0).is_false());
+    ASSUME_ITS_TRUE(r_not.get(1).is_true());
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_slice_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_slice_suite, cpp_test_TriboolSlice_flags);
+    FOSSIL_ADD_TEST(cpp_tribool_slice_suite, cpp_test_TriboolSlice_operators);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_slice_suite);
+}
@@ -0,0 +1,272 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <string.h>
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_table_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_table_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_table_suite) {
+    // Teardown code here
+}
+
+// Deterministic pseudo-random stream for the replica workloads
+static unsigned c_table_next(unsigned *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+// Each replica observes its own random slots; replica r only writes r's opinion
+static void c_table_workload(tribool_table *t, unsigned seed, size_t length, size_t writes) {
+    unsigned state = seed;
+    for (size_t i = 0; i < writes; i++) {
+        size_t slot = c_table_next(&state) % length;
+        tribool value = (c_table_next(&state) & 1u) ? FOSSIL_TYPE_TRIBOOL_TRUE : FOSSIL_TYPE_TRIBOOL_FALSE;
+        fossil_type_tribool_table_observe(t, slot, value);
+    }
+}
+
+static int c_table_same(const tribool_table *a, const tribool_table *b) {
+    if (a->length != b->length) return 0;
+    return memcmp(a->words, b->words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(a->length) * sizeof(uint64_t)) == 0;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Observations, conflicts and read policies of a single slot
+FOSSIL_TEST(c_test_tribool_table_observe) {
+    tribool_table t;
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_init(&t, 40));
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_UNKNOWN, fossil_type_tribool_table_get(&t, 3, FOSSIL_TYPE_TRIBOOL_CONFLICT_TRUE));
+
+    fossil_type_tribool_table_observe(&t, 3, FOSSIL_TYPE_TRIBOOL_TRUE);
+    fossil_type_tribool_table_observe(&t, 3, FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_TRUE, fossil_type_tribool_table_get(&t, 3, FOSSIL_TYPE_TRIBOOL_CONFLICT_FALSE));
+    ASSUME_ITS_FALSE(fossil_type_tribool_table_is_conflict(&t, 3));
+
+    fossil_type_tribool_table_observe(&t, 3, FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_table_is_conflict(&t, 3));
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_UNKNOWN, fossil_type_tribool_table_get(&t, 3, FOSSIL_TYPE_TRIBOOL_CONFLICT_UNKNOWN));
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_TRUE, fossil_type_tribool_table_get(&t, 3, FOSSIL_TYPE_TRIBOOL_CONFLICT_TRUE));
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_FALSE, fossil_type_tribool_table_get(&t, 3, FOSSIL_TYPE_TRIBOOL_CONFLICT_FALSE));
+    ASSUME_ITS_TRUE(fossil_type_tribool_table_count_conflicts(&t) == 1);
+
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_table_observe(&t, 40, FOSSIL_TYPE_TRIBOOL_TRUE));
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_table_grow(&t, 39));
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_grow(&t, 100));
+    ASSUME_ITS_EQUAL_I32(FOSSIL_TYPE_TRIBOOL_UNKNOWN, fossil_type_tribool_table_get(&t, 99, FOSSIL_TYPE_TRIBOOL_CONFLICT_TRUE));
+    fossil_type_tribool_table_free(&t);
+}
+
+// Test: Merge is commutative, associative and idempotent, and counts new conflicts
+FOSSIL_TEST(c_test_tribool_table_merge_lattice) {
+    tribool_table a, b, c, ab_c, a_bc, tmp;
+    fossil_type_tribool_table_init(&a, 300);
+    fossil_type_tribool_table_init(&b, 300);
+    fossil_type_tribool_table_init(&c, 500);
+    c_table_workload(&a, 1, 300, 200);
+    c_table_workload(&b, 2, 300, 200);
+    c_table_workload(&c, 3, 500, 200);
+
+    // (a + b) + c
+    fossil_type_tribool_table_init(&ab_c, 0);
+    fossil_type_tribool_table_merge(&ab_c, &a, NULL);
+    fossil_type_tribool_table_merge(&ab_c, &b, NULL);
+    fossil_type_tribool_table_merge(&ab_c, &c, NULL);
+    // a + (c + b)
+    fossil_type_tribool_table_init(&tmp, 0);
+    fossil_type_tribool_table_merge(&tmp, &c, NULL);
+    fossil_type_tribool_table_merge(&tmp, &b, NULL);
+    fossil_type_tribool_table_init(&a_bc, 0);
+    fossil_type_tribool_table_merge(&a_bc, &a, NULL);
+    fossil_type_tribool_table_merge(&a_bc, &tmp, NULL);
+    ASSUME_ITS_TRUE(c_table_same(&ab_c, &a_bc));
+    ASSUME_ITS_TRUE(ab_c.length == 500);
+
+    size_t conflicts = 99;
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_merge(&ab_c, &ab_c, &conflicts));
+    ASSUME_ITS_TRUE(conflicts == 0);
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_merge(&ab_c, &b, &conflicts));
+    ASSUME_ITS_TRUE(conflicts == 0 && c_table_same(&ab_c, &a_bc));
+
+    // The conflicts reported by successive merges add up to the final count
+    size_t total = 0;
+    fossil_type_tribool_table_free(&tmp);
+    fossil_type_tribool_table_init(&tmp, 0);
+    fossil_type_tribool_table_merge(&tmp, &a, &conflicts);
+    total += conflicts;
+    fossil_type_tribool_table_merge(&tmp, &b, &conflicts);
+    total += conflicts;
+    fossil_type_tribool_table_merge(&tmp, &c, &conflicts);
+    total += conflicts;
+    ASSUME_ITS_TRUE(total == fossil_type_tribool_table_count_conflicts(&ab_c));
+    ASSUME_ITS_TRUE(total > 0);
+
+    fossil_type_tribool_table_free(&a);
+    fossil_type_tribool_table_free(&b);
+    fossil_type_tribool_table_free(&c);
+    fossil_type_tribool_table_free(&ab_c);
+    fossil_type_tribool_table_free(&a_bc);
+    fossil_type_tribool_table_free(&tmp);
+}
+
+// Test: Replicas exchanging only deltas converge regardless of delivery order
+FOSSIL_TEST(c_test_tribool_table_delta_convergence) {
+    enum { REPLICAS = 3, SLOTS = 1000 };
+    tribool_table r[REPLICAS], seen[REPLICAS][REPLICAS], expect;
+    tribool_delta d;
+    fossil_type_tribool_delta_init(&d);
+    fossil_type_tribool_table_init(&expect, SLOTS);
+    for (int i = 0; i < REPLICAS; i++) {
+        fossil_type_tribool_table_init(&r[i], SLOTS);
+        for (int j = 0; j < REPLICAS; j++) fossil_type_tribool_table_init(&seen[i][j], 0);
+    }
+
+    // Three rounds of local writes, each followed by delta gossip in a rotating order
+    for (unsigned round = 0; round < 3; round++) {
+        for (int i = 0; i < REPLICAS; i++) c_table_workload(&r[i], 10u * round + (unsigned)i, SLOTS, 50);
+        for (int k = 0; k < REPLICAS * REPLICAS; k++) {
+            int from = (k + (int)round) % REPLICAS, to = (k / REPLICAS + 1 + from) % REPLICAS;
+            if (from == to) continue;
+            // seen[from][to] is what from last sent to; only the difference travels
+            ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_diff(&d, &r[from], &seen[from][to]));
+            ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_apply(&r[to], &d, NULL));
+            fossil_type_tribool_table_merge(&seen[from][to], &r[from], NULL);
+        }
+    }
+    // A final full round makes everyone converge
+    for (int from = 0; from < REPLICAS; from++) {
+        for (int to = 0; to < REPLICAS; to++) {
+            fossil_type_tribool_table_diff(&d, &r[from], &seen[from][to]);
+            fossil_type_tribool_table_apply(&r[to], &d, NULL);
+            fossil_type_tribool_table_merge(&seen[from][to], &r[from], NULL);
+        }
+    }
+    for (int i = 0; i < REPLICAS; i++) fossil_type_tribool_table_merge(&expect, &r[i], NULL);
+    for (int i = 0; i < REPLICAS; i++) ASSUME_ITS_TRUE(c_table_same(&r[i], &expect));
+
+    // Nothing new to send, and re-applying an old delta changes nothing
+    // Only the header is left: length 1000 (two bytes) and a zero count
+    fossil_type_tribool_table_diff(&d, &r[0], &r[1]);
+    ASSUME_ITS_TRUE(d.size == 3);
+    fossil_type_tribool_table_diff(&d, &r[0], NULL);
+    size_t conflicts = 7;
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_apply(&r[1], &d, &conflicts));
+    ASSUME_ITS_TRUE(conflicts == 0 && c_table_same(&r[1], &expect));
+
+    fossil_type_tribool_delta_free(&d);
+    fossil_type_tribool_table_free(&expect);
+    for (int i = 0; i < REPLICAS; i++) {
+        fossil_type_tribool_table_free(&r[i]);
+        for (int j = 0; j < REPLICAS; j++) fossil_type_tribool_table_free(&seen[i][j]);
+    }
+}
+
+// Test: Delta encoding is compact and malformed deltas are rejected whole
+FOSSIL_TEST(c_test_tribool_table_delta_format) {
+    tribool_table a, b;
+    tribool_delta d;
+    fossil_type_tribool_table_init(&a, 100);
+    fossil_type_tribool_table_init(&b, 10);
+    fossil_type_tribool_delta_init(&d);
+    fossil_type_tribool_table_observe(&a, 5, FOSSIL_TYPE_TRIBOOL_TRUE);
+    fossil_type_tribool_table_observe(&a, 6, FOSSIL_TYPE_TRIBOOL_FALSE);
+    fossil_type_tribool_table_observe(&a, 99, FOSSIL_TYPE_TRIBOOL_TRUE);
+
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_diff(&d, &a, NULL));
+    // length 100, count 3, (5 << 2) | 1, (0 << 2) | 2, (92 << 2) | 1 as two bytes
+    ASSUME_ITS_TRUE(d.size == 6);
+    ASSUME_ITS_TRUE(d.bytes[0] == 100 && d.bytes[1] == 3 && d.bytes[2] == 21 && d.bytes[3] == 2);
+
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_apply(&b, &d, NULL));
+    ASSUME_ITS_TRUE(c_table_same(&a, &b));
+
+    // Truncated, trailing bytes and out-of-range slots leave the table untouched
+    tribool_table c;
+    fossil_type_tribool_table_init(&c, 0);
+    d.size--;
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_table_apply(&c, &d, NULL));
+    d.size += 2;
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_table_apply(&c, &d, NULL));
+    d.size--;
+    d.bytes[0] = 99;
+    ASSUME_ITS_EQUAL_I32(-1, fossil_type_tribool_table_apply(&c, &d, NULL));
+    ASSUME_ITS_TRUE(c.length == 0);
+
+    fossil_type_tribool_delta_free(&d);
+    fossil_type_tribool_table_free(&a);
+    fossil_type_tribool_table_free(&b);
+    fossil_type_tribool_table_free(&c);
+}
+
+// Test: Observing a packed vector and resolving back round-trips its knowns
+FOSSIL_TEST(c_test_tribool_table_vec_round_trip) {
+    tribool_vec v, out;
+    tribool_table t;
+    fossil_type_tribool_vec_init(&v, 70);
+    fossil_type_tribool_vec_init(&out, 0);
+    for (size_t i = 0; i < 70; i++) fossil_type_tribool_vec_set(&v, i, (tribool)(i % 3));
+    fossil_type_tribool_table_init(&t, 0);
+
+    size_t conflicts = 1;
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_observe_vec(&t, &v, &conflicts));
+    ASSUME_ITS_TRUE(t.length == 70 && conflicts == 0);
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_resolve(&out, &t, FOSSIL_TYPE_TRIBOOL_CONFLICT_UNKNOWN));
+    ASSUME_ITS_TRUE(memcmp(out.words, v.words, FOSSIL_TYPE_TRIBOOL_VEC_WORDS(70) * sizeof(uint64_t)) == 0);
+
+    // Flip every known lane: each becomes a conflict
+    fossil_type_tribool_vec_not(&v, &v);
+    ASSUME_ITS_EQUAL_I32(0, fossil_type_tribool_table_observe_vec(&t, &v, &conflicts));
+    ASSUME_ITS_TRUE(conflicts == 47);
+    fossil_type_tribool_table_resolve(&out, &t, FOSSIL_TYPE_TRIBOOL_CONFLICT_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_true(&out) == 47);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_count_unknown(&out) == 23);
+
+    fossil_type_tribool_vec_free(&v);
+    fossil_type_tribool_vec_free(&out);
+    fossil_type_tribool_table_free(&t);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_table_tests) {
+    FOSSIL_ADD_TEST(c_tribool_table_suite, c_test_tribool_table_observe);
+    FOSSIL_ADD_TEST(c_tribool_table_suite, c_test_tribool_table_merge_lattice);
+    FOSSIL_ADD_TEST(c_tribool_table_suite, c_test_tribool_table_delta_convergence);
+    FOSSIL_ADD_TEST(c_tribool_table_suite, c_test_tribool_table_delta_format);
+    FOSSIL_ADD_TEST(c_tribool_table_suite, c_test_tribool_table_vec_round_trip);
+
+    FOSSIL_ADD_SUITE(c_tribool_table_suite);
+}
@@ -0,0 +1,82 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_table_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_table_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_table_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TriboolTable replicas sync through deltas
+FOSSIL_TEST(cpp_test_TriboolTable_sync) {
+    using fossil::type::Tribool;
+    using fossil::type::TriboolDelta;
+    using fossil::type::TriboolTable;
+    TriboolTable a(10), b(10);
+    a.observe(1, Tribool(true));
+    b.observe(1, Tribool(false));
+    b.observe(2, Tribool(false));
+
+    TriboolDelta d;
+    ASSUME_ITS_TRUE(b.diff(d));
+    ASSUME_ITS_TRUE(a.apply(d) == 1);
+    ASSUME_ITS_TRUE(a.is_conflict(1));
+    ASSUME_ITS_TRUE(a.get(1).is_unknown());
+    ASSUME_ITS_TRUE(a.get(1, FOSSIL_TYPE_TRIBOOL_CONFLICT_FALSE).is_false());
+    ASSUME_ITS_TRUE(a.get(2).is_false());
+
+    ASSUME_ITS_TRUE(b.merge(a) == 1);
+    ASSUME_ITS_TRUE(b.count_conflicts() == 1);
+    ASSUME_ITS_TRUE(a.diff(d, &b));
+    ASSUME_ITS_TRUE(d.size() == 2);
+
+    fossil::type::TriboolVec v = a.resolve(FOSSIL_TYPE_TRIBOOL_CONFLICT_TRUE);
+    ASSUME_ITS_TRUE(v.size() == 10);
+    ASSUME_ITS_TRUE(v.get(1).is_true());
+    ASSUME_ITS_TRUE(v.get(0).is_unknown());
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_table_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_table_suite, cpp_test_TriboolTable_sync);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_table_suite);
+}
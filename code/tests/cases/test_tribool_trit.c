@@ -0,0 +1,124 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include "tribool_sample.h"
+#include <string.h>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_trit_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_trit_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_trit_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: Byte layout is little-endian base 3
+FOSSIL_TEST(c_test_tribool_trit_layout) {
+    tribool values[7] = {FOSSIL_TYPE_TRIBOOL_TRUE, FOSSIL_TYPE_TRIBOOL_UNKNOWN, FOSSIL_TYPE_TRIBOOL_FALSE,
+                         FOSSIL_TYPE_TRIBOOL_FALSE, FOSSIL_TYPE_TRIBOOL_UNKNOWN,
+                         FOSSIL_TYPE_TRIBOOL_UNKNOWN, FOSSIL_TYPE_TRIBOOL_UNKNOWN};
+    uint8_t bytes[2];
+
+    ASSUME_ITS_TRUE(FOSSIL_TYPE_TRIT_BYTES(7) == 2);
+    ASSUME_ITS_TRUE(fossil_type_tribool_trit_encode(bytes, values, 7) == 2);
+    ASSUME_ITS_TRUE(bytes[0] == 1 + 2 * 3 + 2 * 81);
+    ASSUME_ITS_TRUE(bytes[1] == 2 + 2 * 3);
+}
+
+// Test: Arrays, one-byte arrays and packed vectors round-trip at every length
+FOSSIL_TEST(c_test_tribool_trit_round_trip) {
+    static tribool src[300], back[300];
+    static tribool8 narrow[300], narrow_back[300];
+    static uint8_t a[FOSSIL_TYPE_TRIT_BYTES(300)], b[FOSSIL_TYPE_TRIT_BYTES(300)], c[FOSSIL_TYPE_TRIT_BYTES(300)];
+    tribool_vec v, w;
+    int ok = 1;
+
+    fossil_type_tribool_vec_init(&v, 0);
+    fossil_type_tribool_vec_init(&w, 0);
+    for (size_t i = 0; i < 300; i++) src[i] = test_tribool_mix(i, 0x9e37u);
+    fossil_type_tribool_narrow(narrow, src, 300);
+
+    for (size_t n = 0; n <= 300; n += (n < 70 ? 1 : 23)) {
+        size_t bytes = FOSSIL_TYPE_TRIT_BYTES(n);
+        fossil_type_tribool_vec_pack(&v, src, n);
+
+        ok &= fossil_type_tribool_trit_encode(a, src, n) == bytes;
+        ok &= fossil_type_tribool8_trit_encode(b, narrow, n) == bytes;
+        ok &= fossil_type_tribool_vec_trit_encode(c, &v) == bytes;
+        ok &= memcmp(a, b, bytes) == 0 && memcmp(a, c, bytes) == 0;
+
+        ok &= fossil_type_tribool_trit_decode(back, a, n) == 0;
+        ok &= fossil_type_tribool8_trit_decode(narrow_back, a, n) == 0;
+        ok &= fossil_type_tribool_vec_trit_decode(&w, a, n) == 0;
+        ok &= fossil_type_tribool_vec_length(&w) == n;
+        for (size_t i = 0; i < n; i++) {
+            ok &= back[i] == src[i];
+            ok &= narrow_back[i] == narrow[i];
+            ok &= fossil_type_tribool_vec_get(&w, i) == src[i];
+        }
+    }
+    ASSUME_ITS_TRUE(ok);
+
+    fossil_type_tribool_vec_free(&v);
+    fossil_type_tribool_vec_free(&w);
+}
+
+// Test: Bytes above 242 are rejected
+FOSSIL_TEST(c_test_tribool_trit_invalid) {
+    uint8_t bytes[3] = {0, 242, 243};
+    tribool out[15];
+    tribool_vec v;
+
+    fossil_type_tribool_vec_init(&v, 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_trit_decode(out, bytes, 10) == 0);
+    ASSUME_ITS_TRUE(out[9] == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_trit_decode(out, bytes, 15) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_trit_decode(&v, bytes, 11) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_trit_decode(NULL, bytes, 1) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_trit_encode(bytes, NULL, 1) == 0);
+    fossil_type_tribool_vec_free(&v);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_trit_tests) {
+    FOSSIL_ADD_TEST(c_tribool_trit_suite, c_test_tribool_trit_layout);
+    FOSSIL_ADD_TEST(c_tribool_trit_suite, c_test_tribool_trit_round_trip);
+    FOSSIL_ADD_TEST(c_tribool_trit_suite, c_test_tribool_trit_invalid);
+
+    FOSSIL_ADD_SUITE(c_tribool_trit_suite);
+}
@@ -0,0 +1,75 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_trit_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_trit_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_trit_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TritCodec round-trips spans and packed vectors
+FOSSIL_TEST(cpp_test_TritCodec_round_trip) {
+    using fossil::type::Tribool;
+    using fossil::type::TritCodec;
+    std::vector<Tribool> values(12);
+    values[0] = Tribool(FOSSIL_TYPE_TRIBOOL_TRUE);
+    values[11] = Tribool(FOSSIL_TYPE_TRIBOOL_FALSE);
+
+    std::vector<uint8_t> bytes = TritCodec::encode(values);
+    ASSUME_ITS_TRUE(bytes.size() == 3);
+
+    std::vector<Tribool> back(12);
+    ASSUME_ITS_TRUE(TritCodec::decode(back, bytes));
+    ASSUME_ITS_TRUE(back[0].is_true() && back[5].is_unknown() && back[11].is_false());
+
+    fossil::type::TriboolVec v;
+    ASSUME_ITS_TRUE(TritCodec::decode(v, bytes, 12));
+    ASSUME_ITS_TRUE(TritCodec::encode(v) == bytes);
+    ASSUME_ITS_FALSE(TritCodec::decode(v, bytes, 16));
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_trit_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_trit_suite, cpp_test_TritCodec_round_trip);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_trit_suite);
+}
@@ -0,0 +1,173 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include "tribool_sample.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(c_tribool_vec_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(c_tribool_vec_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(c_tribool_vec_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: New vectors start out UNKNOWN and support get/set
+FOSSIL_TEST(c_test_tribool_vec_init_get_set) {
+    tribool_vec v;
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_init(&v, 70) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_length(&v) == 70);
+
+    for (size_t i = 0; i < 70; i++) {
+        ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, i) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    }
+
+    fossil_type_tribool_vec_set(&v, 0, FOSSIL_TYPE_TRIBOOL_TRUE);
+    fossil_type_tribool_vec_set(&v, 31, FOSSIL_TYPE_TRIBOOL_FALSE);
+    fossil_type_tribool_vec_set(&v, 69, FOSSIL_TYPE_TRIBOOL_TRUE);
+    fossil_type_tribool_vec_set(&v, 70, FOSSIL_TYPE_TRIBOOL_TRUE);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 0) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 31) == FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 32) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 69) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 70) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+
+    fossil_type_tribool_vec_free(&v);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_length(&v) == 0);
+}
+
+// Test: Pack and unpack round trip, resize keeps existing values
+FOSSIL_TEST(c_test_tribool_vec_pack_unpack) {
+    tribool src[100];
+    tribool out[100];
+    for (size_t i = 0; i < 100; i++) src[i] = test_tribool_mix(i, 7);
+
+    tribool_vec v;
+    fossil_type_tribool_vec_init(&v, 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_pack(&v, src, 100) == 0);
+    fossil_type_tribool_vec_unpack(&v, out);
+    for (size_t i = 0; i < 100; i++) ASSUME_ITS_TRUE(out[i] == src[i]);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_resize(&v, 130) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 99) == src[99]);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 129) == FOSSIL_TYPE_TRIBOOL_UNKNOWN);
+
+    fossil_type_tribool_vec_fill(&v, FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 0) == FOSSIL_TYPE_TRIBOOL_FALSE);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&v, 129) == FOSSIL_TYPE_TRIBOOL_FALSE);
+
+    fossil_type_tribool_vec_free(&v);
+}
+
+// Test: Bulk AND/OR/NOT agree with the scalar operations
+FOSSIL_TEST(c_test_tribool_vec_logic_matches_scalar) {
+    const size_t n = 1000;
+    tribool_vec a, b, r_and, r_or, r_not;
+    fossil_type_tribool_vec_init(&a, n);
+    fossil_type_tribool_vec_init(&b, n);
+    fossil_type_tribool_vec_init(&r_and, 0);
+    fossil_type_tribool_vec_init(&r_or, 0);
+    fossil_type_tribool_vec_init(&r_not, 0);
+
+    for (size_t i = 0; i < n; i++) {
+        fossil_type_tribool_vec_set(&a, i, test_tribool_mix(i, 1));
+        fossil_type_tribool_vec_set(&b, i, test_tribool_mix(i, 2));
+    }
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_and(&r_and, &a, &b) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_or(&r_or, &a, &b) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_not(&r_not, &a) == 0);
+
+    for (size_t i = 0; i < n; i++) {
+        tribool x = test_tribool_mix(i, 1);
+        tribool y = test_tribool_mix(i, 2);
+        ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&r_and, i) == fossil_type_tribool_and(x, y));
+        ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&r_or, i) == fossil_type_tribool_or(x, y));
+        ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&r_not, i) == fossil_type_tribool_not(x));
+    }
+
+    fossil_type_tribool_vec_free(&a);
+    fossil_type_tribool_vec_free(&b);
+    fossil_type_tribool_vec_free(&r_and);
+    fossil_type_tribool_vec_free(&r_or);
+    fossil_type_tribool_vec_free(&r_not);
+}
+
+// Test: In-place operation and padding lanes after NOT
+FOSSIL_TEST(c_test_tribool_vec_in_place) {
+    tribool_vec a;
+    fossil_type_tribool_vec_init(&a, 33);
+    fossil_type_tribool_vec_fill(&a, FOSSIL_TYPE_TRIBOOL_FALSE);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_not(&a, &a) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&a, 32) == FOSSIL_TYPE_TRIBOOL_TRUE);
+    ASSUME_ITS_TRUE(a.words[1] == 1u);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_and(&a, &a, &a) == 0);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_get(&a, 0) == FOSSIL_TYPE_TRIBOOL_TRUE);
+
+    fossil_type_tribool_vec_free(&a);
+}
+
+// Test: Mismatched lengths are rejected
+FOSSIL_TEST(c_test_tribool_vec_length_mismatch) {
+    tribool_vec a, b, r;
+    fossil_type_tribool_vec_init(&a, 10);
+    fossil_type_tribool_vec_init(&b, 11);
+    fossil_type_tribool_vec_init(&r, 0);
+
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_and(&r, &a, &b) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_or(&r, &a, &b) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_and(&r, NULL, &b) == -1);
+    ASSUME_ITS_TRUE(fossil_type_tribool_vec_kernel() != NULL);
+
+    fossil_type_tribool_vec_free(&a);
+    fossil_type_tribool_vec_free(&b);
+    fossil_type_tribool_vec_free(&r);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_tribool_vec_tests) {
+    FOSSIL_ADD_TEST(c_tribool_vec_suite, c_test_tribool_vec_init_get_set);
+    FOSSIL_ADD_TEST(c_tribool_vec_suite, c_test_tribool_vec_pack_unpack);
+    FOSSIL_ADD_TEST(c_tribool_vec_suite, c_test_tribool_vec_logic_matches_scalar);
+    FOSSIL_ADD_TEST(c_tribool_vec_suite, c_test_tribool_vec_in_place);
+    FOSSIL_ADD_TEST(c_tribool_vec_suite, c_test_tribool_vec_length_mismatch);
+
+    FOSSIL_ADD_SUITE(c_tribool_vec_suite);
+}
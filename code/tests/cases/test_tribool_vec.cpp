@@ -0,0 +1,111 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/type/framework.h"
+#include <utility>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Define the test suite and add test cases
+FOSSIL_SUITE(cpp_tribool_vec_suite);
+
+// Setup function for the test suite
+FOSSIL_SETUP(cpp_tribool_vec_suite) {
+    // Setup code here
+}
+
+// Teardown function for the test suite
+FOSSIL_TEARDOWN(cpp_tribool_vec_suite) {
+    // Teardown code here
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+// Test: TriboolVec default state and element access
+FOSSIL_TEST(cpp_test_TriboolVec_access) {
+    using fossil::type::Tribool;
+    fossil::type::TriboolVec v(40);
+
+    ASSUME_ITS_TRUE(v.size() == 40);
+    ASSUME_ITS_TRUE(v.get(39).is_unknown());
+
+    v.set(39, Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    ASSUME_ITS_TRUE(v.get(39).is_true());
+    ASSUME_ITS_TRUE(v.get(40).is_unknown());
+}
+
+// Test: TriboolVec logical operators
+FOSSIL_TEST(cpp_test_TriboolVec_operators) {
+    using fossil::type::Tribool;
+    using fossil::type::TriboolVec;
+    TriboolVec a(3), b(3);
+
+    a.set(0, Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    a.set(1, Tribool(FOSSIL_TYPE_TRIBOOL_FALSE));
+    b.fill(Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+
+    TriboolVec r_and = a && b;
+    TriboolVec r_or = a || b;
+    TriboolVec r_not = !a;
+
+    ASSUME_ITS_TRUE(r_and.get(0).is_true());
+    ASSUME_ITS_TRUE(r_and.get(1).is_false());
+    ASSUME_ITS_TRUE(r_and.get(2).is_unknown());
+    ASSUME_ITS_TRUE(r_or.get(1).is_true());
+    ASSUME_ITS_TRUE(r_or.get(2).is_true());
+    ASSUME_ITS_TRUE(r_not.get(0).is_false());
+    ASSUME_ITS_TRUE(r_not.get(2).is_unknown());
+}
+
+// Test: TriboolVec copy and move semantics
+FOSSIL_TEST(cpp_test_TriboolVec_copy_move) {
+    using fossil::type::Tribool;
+    using fossil::type::TriboolVec;
+    TriboolVec a(5);
+    a.set(4, Tribool(FOSSIL_TYPE_TRIBOOL_FALSE));
+
+    TriboolVec copy = a;
+    a.set(4, Tribool(FOSSIL_TYPE_TRIBOOL_TRUE));
+    ASSUME_ITS_TRUE(copy.get(4).is_false());
+
+    TriboolVec moved = std::move(copy);
+    ASSUME_ITS_TRUE(moved.size() == 5);
+    ASSUME_ITS_TRUE(moved.get(4).is_false());
+
+    TriboolVec mismatch = a && TriboolVec(6);
+    ASSUME_ITS_TRUE(mismatch.size() == 0);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_tribool_vec_tests) {
+    FOSSIL_ADD_TEST(cpp_tribool_vec_suite, cpp_test_TriboolVec_access);
+    FOSSIL_ADD_TEST(cpp_tribool_vec_suite, cpp_test_TriboolVec_operators);
+    FOSSIL_ADD_TEST(cpp_tribool_vec_suite, cpp_test_TriboolVec_copy_move);
+
+    FOSSIL_ADD_SUITE(cpp_tribool_vec_suite);
+}
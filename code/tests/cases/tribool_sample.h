@@ -0,0 +1,45 @@
+/*
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * performance, cross-platform applications and libraries. The code contained
+ * This file is part of the Fossil Logic project, which aims to develop high-
+ * herein is subject to the terms and conditions defined in the project license.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ *
+ * Copyright (C) 2024 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TYPE_TEST_TRIBOOL_SAMPLE_H
+#define FOSSIL_TYPE_TEST_TRIBOOL_SAMPLE_H
+
+#include "fossil/type/framework.h"
+
+/*
+ * Deterministic tribool columns shared by the C suites. Not a
+ * test case itself: the runner only collects *.c and *.cpp.
+ */
+
+// Even mix of TRUE/FALSE/UNKNOWN; seed picks the sequence
+static inline tribool test_tribool_mix(size_t i, unsigned seed) {
+    return (tribool)(((i * 2654435761u) ^ seed) % 3u);
+}
+
+// Sparse column: mostly UNKNOWN with short TRUE/FALSE islands
+static inline tribool test_tribool_sparse(size_t i, unsigned seed) {
+    size_t k = (i * 2654435761u) ^ seed;
+    if ((i / 7 + seed) % 5 != 0) return FOSSIL_TYPE_TRIBOOL_UNKNOWN;
+    return (tribool)((k >> 3) & 1u);
+}
+
+// Murmur-scrambled lanes: (seed, stream) pairs give independent columns
+static inline tribool test_tribool_scrambled(size_t seed, unsigned stream, size_t i) {
+    unsigned x = (unsigned)(i * 2654435761u) ^ (unsigned)(seed * 40503u + stream);
+    x ^= x >> 13;
+    x *= 0x5bd1e995u;
+    x ^= x >> 15;
+    return (tribool)(x % 3u);
+}
+
+#endif /* FOSSIL_TYPE_TEST_TRIBOOL_SAMPLE_H */